@@ -5,24 +5,22 @@
 
 // --- Attributes ---
 layout(location = 0) in vec3 a_Position;
-layout(location = 1) in vec3 a_Normal;
-layout(location = 2) in vec3 a_Tangent;
 layout(location = 3) in vec2 a_TexCoord;
-layout(location = 4) in vec4 a_Color;
 
-layout(location = 5) in float a_NormalStrength;
-layout(location = 6) in int a_TexIndex;
-layout(location = 7) in int a_NormTexIndex;
+#ifdef INSTANCED_RENDERING
+layout(location = 1) in vec3 a_Normal;
+layout(location = 2) in vec3 a_Tangent;
 
+// Instance Attributes (mesh vertices are in local space, material comes from u_Material)
+layout(location = 4) in mat4 a_Transform;
 layout(location = 8) in int a_EntityID;
-
-// PBR Attributes
-layout(location = 9) in float a_Roughness;
-layout(location = 10) in float a_Metallic;
-layout(location = 11) in float a_AmbientOcclusionValue;
-layout(location = 12) in int a_RoughTexIndex;
-layout(location = 13) in int a_MetalTexIndex;
-layout(location = 14) in int a_AOTexIndex;
+#else
+// Batch Vertex Attributes (normal & tangent are octahedral-encoded, material is an index in u_Materials)
+layout(location = 1) in vec2 a_Normal;
+layout(location = 2) in vec2 a_Tangent;
+layout(location = 4) in uint a_MaterialIndex;
+layout(location = 5) in int a_EntityID;
+#endif
 
 // --- Varyings ---
 out vec3 v_FragPos;
@@ -35,38 +33,101 @@ out flat int v_TexIndex, v_NormTexIndex, v_RoughTexIndex, v_MetalTexIndex, v_AOT
 
 out flat int v_EntityID;
 
+#ifdef BINDLESS_TEXTURES
+out flat uint v_MaterialIndex;
+#endif
+
 // --- Uniforms ---
 uniform mat4 u_ViewProjection;
 
+#ifdef INSTANCED_RENDERING
+struct Material
+{
+	vec4 Color;
+	float NormalStrength, Roughness, Metallic, AmbientOcclusion;
+	int TexIndex, NormTexIndex, RoughTexIndex, MetalTexIndex, AOTexIndex;
+};
+
+uniform Material u_Material;
+#else
+struct MaterialData
+{
+	vec4 Color;
+	float NormalStrength, Shininess, SpecularStrength, Roughness;
+	float Metallic, AmbientOcclusion;
+	int TexIndex, NormTexIndex;
+	int SpecTexIndex, RoughTexIndex, MetalTexIndex, AOTexIndex;
+	uvec2 TextureHandles[6];		// Bindless handles (only set with bindless textures, then the indices above index them)
+};
+
+layout(std430, binding = 4) readonly buffer Materials
+{
+	MaterialData u_Materials[];
+};
+
+// Inverse of PackOctahedral() (BatchFormats.h)
+vec3 DecodeOctahedral(vec2 e)
+{
+	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	if (n.z < 0.0)
+		n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+
+	return normalize(n);
+}
+#endif
+
 
 // --- Main ---
 void main()
 {
 	// Varyings Setting
-	v_FragPos = a_Position;
 	v_TexCoord = a_TexCoord;
-	v_Color = a_Color;
-
-	v_NormalStrength = a_NormalStrength;
-	v_Roughness = a_Roughness;
-	v_Metallic = a_Metallic;
-	v_AmbientOcclusionValue = a_AmbientOcclusionValue;
-
-	v_TexIndex = a_TexIndex;
-	v_NormTexIndex = a_NormTexIndex;
-	v_RoughTexIndex = a_RoughTexIndex;
-	v_MetalTexIndex = a_MetalTexIndex;
-	v_AOTexIndex = a_AOTexIndex;
-	
 	v_EntityID = a_EntityID;
 
+#ifdef INSTANCED_RENDERING
+	vec3 position = vec3(a_Transform * vec4(a_Position, 1.0));
+	vec3 N = normalize(mat3(a_Transform) * a_Normal), T = normalize(mat3(a_Transform) * a_Tangent);
+
+	v_Color = u_Material.Color;
+	v_NormalStrength = u_Material.NormalStrength;
+	v_Roughness = u_Material.Roughness;
+	v_Metallic = u_Material.Metallic;
+	v_AmbientOcclusionValue = u_Material.AmbientOcclusion;
+
+	v_TexIndex = u_Material.TexIndex;
+	v_NormTexIndex = u_Material.NormTexIndex;
+	v_RoughTexIndex = u_Material.RoughTexIndex;
+	v_MetalTexIndex = u_Material.MetalTexIndex;
+	v_AOTexIndex = u_Material.AOTexIndex;
+#else
+	vec3 position = a_Position;
+	vec3 N = DecodeOctahedral(a_Normal), T = DecodeOctahedral(a_Tangent);
+	MaterialData material = u_Materials[a_MaterialIndex];
+#ifdef BINDLESS_TEXTURES
+	v_MaterialIndex = a_MaterialIndex;
+#endif
+
+	v_Color = material.Color;
+	v_NormalStrength = material.NormalStrength;
+	v_Roughness = material.Roughness;
+	v_Metallic = material.Metallic;
+	v_AmbientOcclusionValue = material.AmbientOcclusion;
+
+	v_TexIndex = material.TexIndex;
+	v_NormTexIndex = material.NormTexIndex;
+	v_RoughTexIndex = material.RoughTexIndex;
+	v_MetalTexIndex = material.MetalTexIndex;
+	v_AOTexIndex = material.AOTexIndex;
+#endif
+
+	v_FragPos = position;
+
 	// TBN Matrix Calculation (for normal mapping)
-	vec3 T = a_Tangent, N = a_Normal;
 	T = normalize(T - dot(T, N) * N);
 	v_TBN = mat3(T, cross(N, T), N);
 
 	// Position Calculation
-	gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+	gl_Position = u_ViewProjection * vec4(position, 1.0);
 }
 
 
@@ -76,9 +137,12 @@ void main()
 #type FRAGMENT_SHADER
 #version 460 core
 
+#ifdef BINDLESS_TEXTURES
+#extension GL_ARB_bindless_texture : require
+#endif
+
 // --- Defines ---
 #define MAX_DIR_LIGHTS 0
-#define MAX_POINT_LIGHTS 0
 #define MAX_TEXTURES 0
 
 #define PI 3.14159265359
@@ -99,6 +163,10 @@ in flat int v_TexIndex, v_NormTexIndex, v_RoughTexIndex, v_MetalTexIndex, v_AOTe
 
 in flat int v_EntityID;
 
+#ifdef BINDLESS_TEXTURES
+in flat uint v_MaterialIndex;
+#endif
+
 // --- Light Structs ---
 struct DirectionalLight
 {
@@ -115,7 +183,8 @@ struct PointLight
 	float Intensity;
 	float SpecularStrength;
 
-	float Radius, FalloffFactor;
+	float Radius, MaxRadius;				// Only Radius used in PBR, the layout is shared with the non-PBR shader
+	float FalloffFactor, AttL, AttQ;
 };
 
 // --- Uniforms ---
@@ -125,9 +194,58 @@ uniform samplerCube u_IrradianceMap, u_PrefilterSpecularMap;
 uniform sampler2D u_BRDF_LUTMap;
 uniform sampler2D u_Textures[MAX_TEXTURES];
 
-uniform const int u_DirectionalLightsNum = 0, u_PointLightsNum = 0;
-uniform DirectionalLight u_DirectionalLights[MAX_DIR_LIGHTS] = DirectionalLight[MAX_DIR_LIGHTS](DirectionalLight(vec4(1.0), vec3(0.0), 1.0, 1.0));
-uniform PointLight u_PointLights[MAX_POINT_LIGHTS] = PointLight[MAX_POINT_LIGHTS](PointLight(vec4(1.0), vec3(0.0), 1.0, 1.0, 50.0, 1.0));
+#ifdef BINDLESS_TEXTURES
+struct MaterialData
+{
+	vec4 Color;
+	float NormalStrength, Shininess, SpecularStrength, Roughness;
+	float Metallic, AmbientOcclusion;
+	int TexIndex, NormTexIndex;
+	int SpecTexIndex, RoughTexIndex, MetalTexIndex, AOTexIndex;
+	uvec2 TextureHandles[6];
+};
+
+layout(std430, binding = 4) readonly buffer Materials
+{
+	MaterialData u_Materials[];
+};
+#endif
+
+// Texture indices are slots of u_Textures, or indices of the material texture handles with bindless textures
+vec4 SampleTexture(int index, vec2 uv)
+{
+#ifdef BINDLESS_TEXTURES
+	return texture(sampler2D(u_Materials[v_MaterialIndex].TextureHandles[index]), uv);
+#else
+	return texture(u_Textures[index], uv);
+#endif
+}
+
+// --- Lights (layouts must match the lights buffers in Renderer.cpp) ---
+layout(std140, binding = 0) uniform Lights
+{
+	mat4 u_View, u_Projection;
+	vec4 u_ClusterDepthParams;		// Near, far, slice scale & slice bias
+	ivec4 u_ClusterGrid;			// Clusters in x, y & z, and 1 if the projection is perspective
+	int u_DirectionalLightsNum;
+	DirectionalLight u_DirectionalLights[MAX_DIR_LIGHTS];
+};
+
+layout(std430, binding = 1) readonly buffer PointLights { PointLight u_PointLights[]; };
+layout(std430, binding = 2) readonly buffer LightClusters { uvec2 u_LightClusters[]; };		// Offset & count in u_LightIndices
+layout(std430, binding = 3) readonly buffer LightIndices { uint u_LightIndices[]; };
+
+// Cluster of point lights (see LightClusters) in which a world position falls
+uvec2 GetLightCluster(vec3 world_pos)
+{
+	vec4 view_pos = u_View * vec4(world_pos, 1.0);
+	vec4 clip_pos = u_Projection * view_pos;
+
+	float depth = u_ClusterGrid.w == 1 ? log(max(-view_pos.z, u_ClusterDepthParams.x)) : -view_pos.z;
+	int z = clamp(int(floor(depth * u_ClusterDepthParams.z + u_ClusterDepthParams.w)), 0, u_ClusterGrid.z - 1);
+	ivec2 xy = clamp(ivec2(floor((clip_pos.xy / clip_pos.w * 0.5 + 0.5) * vec2(u_ClusterGrid.xy))), ivec2(0), u_ClusterGrid.xy - 1);
+	return u_LightClusters[(z * u_ClusterGrid.y + xy.y) * u_ClusterGrid.x + xy.x];
+}
 
 // --- Functions Declaration ---
 vec3 CalculateCookTorranceSpecular(vec3 F0, vec3 V, vec3 N, vec3 light_dir, float roughness, float NdotV, inout float NdotL, inout vec3 F);
@@ -144,17 +262,17 @@ float GeometrySmith(float NdotV, float NdotL, float roughness);
 void main()
 {
 	// PBR Variables
-	float roughness = texture(u_Textures[v_RoughTexIndex], v_TexCoord).r * v_Roughness;
-	float metallic = texture(u_Textures[v_MetalTexIndex], v_TexCoord).r * v_Metallic;
+	float roughness = SampleTexture(v_RoughTexIndex, v_TexCoord).r * v_Roughness;
+	float metallic = SampleTexture(v_MetalTexIndex, v_TexCoord).r * v_Metallic;
 	float ao = v_AmbientOcclusionValue;
 	if(v_AOTexIndex != 0)
-		ao *= texture(u_Textures[v_AOTexIndex], v_TexCoord).r;
+		ao *= SampleTexture(v_AOTexIndex, v_TexCoord).r;
 	
-	vec4 albedo = pow(texture(u_Textures[v_TexIndex], v_TexCoord), vec4(2.2)) * v_Color;
+	vec4 albedo = pow(SampleTexture(v_TexIndex, v_TexCoord), vec4(2.2)) * v_Color;
 	//albedo.rgb *= ao;
 
 	// Normal Calculation
-	vec3 normal = texture(u_Textures[v_NormTexIndex], v_TexCoord).xyz * 2.0 - 1.0;
+	vec3 normal = SampleTexture(v_NormTexIndex, v_TexCoord).xyz * 2.0 - 1.0;
 	normal.z *= v_NormalStrength;
 
 	// Lighting Calculations
@@ -178,8 +296,11 @@ void main()
 	}
 		
 	// Point Lights
-	for(int i = 0; i < u_PointLightsNum; ++i)
+	uvec2 light_cluster = GetLightCluster(v_FragPos);
+	for(uint c = 0; c < light_cluster.y; ++c)
 	{
+		uint i = u_LightIndices[light_cluster.x + c];
+
 		vec3 dir = u_PointLights[i].Position - v_FragPos;
 		float dist = length(dir);
 
@@ -66,6 +66,7 @@ namespace Kaimos {
 		m_Serializer.Deserialize(s_path);
 		m_KMEPanel = MaterialEditorPanel(m_CurrentScene);
 		m_ScenePanel = ScenePanel(m_CurrentScene, &m_KMEPanel);
+		m_SceneHistory.Record();
 	}
 
 
@@ -79,6 +80,20 @@ namespace Kaimos {
 	{
 		KS_PROFILE_FUNCTION();
 
+		// -- Dropped Models Imported --
+		for (std::vector<Ref<Resources::ModelImport>>::iterator it = m_ModelImports.begin(); it != m_ModelImports.end();)
+		{
+			if ((*it)->IsDone())
+			{
+				if ((*it)->GetModel())
+					m_CurrentScene->ConvertModelIntoEntities((*it)->GetModel());
+
+				it = m_ModelImports.erase(it);
+			}
+			else
+				++it;
+		}
+
 		// -- Viewport Resize --
 		if (FramebufferSettings settings = m_Framebuffer->GetFBOSettings();
 			m_ViewportSize.x > 0.0f && m_ViewportSize.y > 0.0f &&
@@ -121,10 +136,11 @@ namespace Kaimos {
 		glm::vec2 viewport_size = m_ViewportLimits[1] - m_ViewportLimits[0];
 		mouse_pos.y = viewport_size.y - mouse_pos.y;
 
+		// Raycast the scene BVH from the editor camera (instead of reading the EntityID FBO texture back)
 		if (mouse_pos.x >= 0.0f && mouse_pos.y >= 0.0f && mouse_pos.x < viewport_size.x && mouse_pos.y < viewport_size.y)
 		{
-			int pixel_read = m_Framebuffer->GetPixelFromFBO(1, (int)mouse_pos.x, (int)mouse_pos.y);
-			m_HoveredEntity = pixel_read == -1 ? Entity() : Entity(pixel_read, m_CurrentScene.get());
+			Maths::Ray mouse_ray = m_CurrentScene->GetEditorCamera().GetCamera().ScreenPointToRay(glm::vec2(mouse_pos.x, mouse_pos.y), viewport_size);
+			m_HoveredEntity = m_CurrentScene->RaycastEntity(mouse_ray);
 		}
 		
 		m_Framebuffer->Unbind();
@@ -252,6 +268,20 @@ namespace Kaimos {
 				ImGui::EndMenu();
 			}
 
+			if (ImGui::BeginMenu("Edit"))
+			{
+				if (ImGui::MenuItem("Undo", "Ctrl+Z", false, !m_PlayingScene))
+					UndoScene();
+
+				if (ImGui::MenuItem("Redo", "Ctrl+Y", false, !m_PlayingScene))
+					UndoScene(true);
+
+				if (ImGui::MenuItem(m_PlayingScene ? "Stop" : "Play", "Ctrl+P"))
+					SetScenePlaying(!m_PlayingScene);
+
+				ImGui::EndMenu();
+			}
+
 			if (ImGui::BeginMenu("Window"))
 			{
 				ImGui::MenuItem("Toolbar", nullptr, &show_toolbar);
@@ -304,7 +334,7 @@ namespace Kaimos {
 			m_ScenePanel.OnUIRender(show_scene_panel, m_ViewportFocused);
 
 		// -- Settings Panel Rendering --
-		m_SettingsPanel.OnUIRender(m_CurrentScene, m_HoveredEntity, show_settings_panel, show_performance_panel);
+		m_SettingsPanel.OnUIRender(m_CurrentScene, m_SceneHistory, m_HoveredEntity, show_settings_panel, show_performance_panel);
 
 		// -- Project & Console Panels --
 		//if (show_files_panel)
@@ -403,6 +433,14 @@ namespace Kaimos {
 		// -- Material Editor Panel --
 		if (m_KMEPanel.ShowPanel)
 			m_KMEPanel.OnUIRender();
+
+		// -- Scene History --
+		// Edits are recorded when they end (like releasing a dragged value or the guizmo), not on every frame they last
+		bool editing_scene = ImGui::IsAnyItemActive() || ImGuizmo::IsUsing();
+		if (m_EditingScene && !editing_scene && !m_PlayingScene)
+			m_SceneHistory.Record();
+
+		m_EditingScene = editing_scene;
 	}
 
 
@@ -577,7 +615,7 @@ namespace Kaimos {
 		{
 			std::filesystem::path filepath = ev.GetPaths()[i];
 			if(Kaimos::Resources::IsExtensionValid(filepath.extension().string()))
-				m_CurrentScene->ConvertModelIntoEntities(Kaimos::Resources::ResourceManager::CreateModel(filepath.string()));
+				m_ModelImports.push_back(Kaimos::Resources::ResourceManager::CreateModelAsync(filepath.string()));
 		}		
 
 		return false;
@@ -599,6 +637,10 @@ namespace Kaimos {
 			m_ToolbarPanel.m_ChangeSnap = false;
 		}
 
+		// Entities deleted/duplicated with the scene panel shortcuts are recorded as their own state
+		if ((ev.GetKeyCode() == KEY::DEL || ev.GetKeyCode() == KEY::D) && !m_PlayingScene)
+			m_SceneHistory.Record();
+
 		return false;
 	}
 
@@ -635,6 +677,15 @@ namespace Kaimos {
 				if (control_pressed && (Input::IsKeyPressed(KEY::LEFT_SHIFT) || Input::IsKeyPressed(KEY::RIGHT_SHIFT))) SaveSceneAs();
 				else if (control_pressed) SaveScene();
 				break;
+			case KEY::Z:
+				if (control_pressed) UndoScene(Input::IsKeyPressed(KEY::LEFT_SHIFT) || Input::IsKeyPressed(KEY::RIGHT_SHIFT));
+				break;
+			case KEY::Y:
+				if (control_pressed) UndoScene(true);
+				break;
+			case KEY::P:
+				if (control_pressed) SetScenePlaying(!m_PlayingScene);
+				break;
 			// Guizmo
 			case KEY::LEFT_CONTROL:
 				if (!m_ToolbarPanel.m_Snap) { m_ToolbarPanel.m_Snap = true; m_ToolbarPanel.m_ChangeSnap = true; }
@@ -714,6 +765,7 @@ namespace Kaimos {
 						ImGui::CloseCurrentPopup();
 
 						CreateScene(true, true, render_pipeline, scene_name_str);
+						m_SceneHistory.Record();
 						memset(scene_name, 0, sizeof(scene_name));
 					}
 				}
@@ -737,6 +789,9 @@ namespace Kaimos {
 		m_KMEPanel.UnsetGraphToModify();
 		m_ScenePanel.SetContext(m_CurrentScene);
 		m_CurrentScene->SetGlobalCurrentScene(m_CurrentScene);
+
+		m_SceneHistory = SceneHistory(m_CurrentScene);
+		m_PlayingScene = false;
 		
 		if(set_viewport)
 			m_CurrentScene->SetViewportSize((uint)m_ViewportSize.x, (uint)m_ViewportSize.y);
@@ -771,7 +826,8 @@ namespace Kaimos {
 		// -- Scene Serialization --
 		// "filter" arg is divided in 2 by the null-terminated string (\0). The 1st is the filter name to show and the 2nd is the actual filter to use
 		// So this will be shown in the filters tab as "Kaimos Scene (*.kaimos) and will filter all the .kaimos files
-		std::string filepath = FileDialogs::SaveFile("Kaimos Scene (*.kaimos)\0*.kaimos\0", m_CurrentScene->GetName().c_str());
+		// The binary format is the 2nd filter, the serializer picks the format from the extension
+		std::string filepath = FileDialogs::SaveFile("Kaimos Scene (*.kaimos)\0*.kaimos\0Kaimos Binary Scene (*.kaimosb)\0*.kaimosb\0", m_CurrentScene->GetName().c_str());
 		if (!filepath.empty())
 		{
 			// TODO: This should be handled by a filepath class/assets class or something
@@ -801,12 +857,48 @@ namespace Kaimos {
 	void EditorLayer::OpenScene()
 	{
 		// -- Read explanation avobe (on SaveSceneAs()) --
-		std::string filepath = FileDialogs::OpenFile("Kaimos Scene (*.kaimos)\0*.kaimos\0");
+		std::string filepath = FileDialogs::OpenFile("Kaimos Scene (*.kaimos, *.kaimosb)\0*.kaimos;*.kaimosb\0");
 		if (!filepath.empty() && filepath != m_CurrentScene->GetPath()) // TODO: Compare the relative paths or scenes ids/names! Requires filesystem or scene IDs
 		{
 			CreateScene();
 			SceneSerializer m_Serializer(m_CurrentScene);
 			m_Serializer.Deserialize(filepath);
+			m_SceneHistory.Record();
 		}
 	}
+
+	void EditorLayer::UndoScene(bool redo)
+	{
+		if (m_PlayingScene)
+			return;
+
+		if (redo ? m_SceneHistory.Redo() : m_SceneHistory.Undo())
+			OnSceneRestored();
+	}
+
+	void EditorLayer::SetScenePlaying(bool playing)
+	{
+		if (playing == m_PlayingScene)
+			return;
+
+		// The scene is recorded when played, and reverted to that state when stopped
+		if (playing)
+			m_SceneHistory.Record();
+		else
+		{
+			m_SceneHistory.Revert();
+			OnSceneRestored();
+		}
+
+		m_PlayingScene = playing;
+	}
+
+	void EditorLayer::OnSceneRestored()
+	{
+		// Entities not in the restored scene were destroyed, they can't stay selected/hovered
+		if (!m_ScenePanel.GetSelectedEntity().IsValid())
+			m_ScenePanel.SetSelectedEntity({});
+
+		m_HoveredEntity = {};
+	}
 }
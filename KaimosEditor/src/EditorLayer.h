@@ -7,6 +7,8 @@
 #include "Panels/ProjectPanel.h"
 #include "Panels/ToolbarPanel.h"
 #include "Panels/MaterialEditorPanel.h"
+#include "Core/Resources/ModelImport.h"
+#include "Scene/SceneHistory.h"
 
 namespace Kaimos {
 
@@ -49,12 +51,22 @@ namespace Kaimos {
 		void SaveScene();
 		void SaveSceneAs();
 
+		// Undo/redo aren't available while playing the scene, the scene is restored to its state before playing when stopped
+		void UndoScene(bool redo = false);
+		void SetScenePlaying(bool playing);
+		void OnSceneRestored();
+
 
 	private:
 
 		// TODO: TEMP
 		// Scene
 		Ref<Scene> m_CurrentScene = nullptr;
+		std::vector<Ref<Resources::ModelImport>> m_ModelImports;	// Dropped models being imported, added to the scene when done
+
+		SceneHistory m_SceneHistory = {};
+		bool m_EditingScene = false;		// A UI item or the guizmo is being used, the scene is recorded when they are released
+		bool m_PlayingScene = false;
 
 		// Panels
 		SettingsPanel m_SettingsPanel = {};
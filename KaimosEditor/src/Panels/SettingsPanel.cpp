@@ -6,6 +6,9 @@
 #include "ImGui/ImGuiUtils.h"
 #include "Core/Utils/PlatformUtils.h"
 #include "Scene/Scene.h"
+#include "Scene/SceneHistory.h"
+#include "Renderer/Resources/VerticesCache.h"
+#include "Core/Resources/ResourceManager.h"
 
 #include <ImGui/imgui.h>
 #include <glm/glm.hpp>
@@ -48,7 +51,7 @@ namespace Kaimos {
 		m_RenderingAvgMeasureUpdateTimer.Start();
 	}
 
-	void SettingsPanel::OnUIRender(const Ref<Scene>& current_scene, const Entity& hovered_entity, bool& closing_settings, bool& closing_performance)
+	void SettingsPanel::OnUIRender(const Ref<Scene>& current_scene, const SceneHistory& scene_history, const Entity& hovered_entity, bool& closing_settings, bool& closing_performance)
 	{
 		// -- World Settings --
 		if (closing_settings)
@@ -223,7 +226,7 @@ namespace Kaimos {
 			// Memory
 			ImGui::NewLine();
 			if (ImGui::CollapsingHeader("Memory", flags))
-				DisplayMemoryMetrics();
+				DisplayMemoryMetrics(scene_history);
 
 			// Rendering
 			ImGui::NewLine();
@@ -374,7 +377,7 @@ namespace Kaimos {
 		++m_MemoryAllocationsIndex;
 	}
 
-	void SettingsPanel::DisplayMemoryMetrics()
+	void SettingsPanel::DisplayMemoryMetrics(const SceneHistory& scene_history)
 	{
 		// -- Memory Metrics Gathering --
 		float float_mem_allocs[METRICS_ALLOCATIONS_SAMPLES];
@@ -420,6 +423,44 @@ namespace Kaimos {
 
 		ImGui::Text("Current Memory Usage"); ImGui::SameLine(text_separation);
 		ImGui::Text("%i (%i MB)", m_MemoryMetrics.GetCurrentAllocations(), BTOMB(m_MemoryMetrics.GetCurrentMemoryUsage()));
+
+		// -- Texture Cache --
+		const Resources::ResourceManager::TextureCacheStats& textures_stats = Resources::ResourceManager::GetTextureCacheStats();
+		ImGui::NewLine();
+
+		ImGui::Text("Textures Cached"); ImGui::SameLine(text_separation);
+		ImGui::Text("%i (%i MB)", textures_stats.TexturesCount, (uint)BTOMB(textures_stats.ResidentBytes));
+
+		ImGui::Text("Texture Cache Hits"); ImGui::SameLine(text_separation);
+		ImGui::Text("%i (%i Misses, %i Evicted)", textures_stats.Hits, textures_stats.Misses, textures_stats.Evictions);
+
+		int budget_mb = (int)BTOMB(Resources::ResourceManager::GetTexturesMemoryBudget());
+		ImGui::Text("Texture Budget (MB)"); ImGui::SameLine(text_separation);
+		if (ImGui::DragInt("###texturesbudget", &budget_mb, 8.0f, 16, 8192))
+			Resources::ResourceManager::SetTexturesMemoryBudget((uint64_t)budget_mb * 1024ull * 1024ull);
+
+		// -- Scene History (snapshots share the unchanged slots of their entities) --
+		ImGui::NewLine();
+
+		ImGui::Text("Scene Undo States"); ImGui::SameLine(text_separation);
+		ImGui::Text("%i (%.2f MB)", scene_history.GetStatesCount(), BTOMB((float)scene_history.GetMemory()));
+
+		ImGui::Text("Without Sharing"); ImGui::SameLine(text_separation);
+		ImGui::Text("%.2f MB", BTOMB((float)scene_history.GetUnsharedMemory()));
+
+		ImGui::Text("Cached Mesh Vertices"); ImGui::SameLine(text_separation);
+		ImGui::Text("%i (%.2f MB)", VerticesCache::GetCachedVerticesCount(), BTOMB((float)VerticesCache::GetCachedMemory()));
+		ImGui::NewLine();
+
+		// -- Bindless Textures (batched rendering only) --
+		if (Renderer::IsBindlessTexturesSupported())
+		{
+			bool bindless_textures = Renderer::IsBindlessTexturesEnabled();
+			if (ImGui::Checkbox("Bindless Textures", &bindless_textures))
+				Renderer::SetBindlessTexturesEnabled(bindless_textures);
+		}
+		else
+			ImGui::TextColored({ 0.8f, 0.8f, 0.2f, 1.0f }, "Bindless Textures not supported, using Texture Slots");
 	}
 
 
@@ -438,8 +479,39 @@ namespace Kaimos {
 			indices_count = stats.IndicesCount;
 			draw_calls = stats.DrawCalls;
 
-			ImGui::Text("Max Faces x Draw Call"); ImGui::SameLine(text_separation);
-			ImGui::Text("%i", Renderer3D::GetMaxFaces());
+			// Instanced/Batched Rendering Toggle
+			bool instanced_rendering = Renderer3D::IsInstancedRendering();
+			if (ImGui::Checkbox("Instanced Rendering", &instanced_rendering))
+				Renderer3D::SetInstancedRendering(instanced_rendering);
+
+			if (instanced_rendering)
+			{
+				ImGui::Text("Max Instances x Draw Call"); ImGui::SameLine(text_separation);
+				ImGui::Text("%i", Renderer3D::GetMaxInstances());
+
+				ImGui::Text("Instances Drawn"); ImGui::SameLine(text_separation);
+				ImGui::Text("%i", stats.InstancesCount);
+			}
+			else
+			{
+				ImGui::Text("Max Faces x Draw Call"); ImGui::SameLine(text_separation);
+				ImGui::Text("%i", Renderer3D::GetMaxFaces());
+
+				// Retained Static Batches
+				bool retain_static_batches = Renderer3D::IsRetainingStaticBatches();
+				if (ImGui::Checkbox("Retain Static Batches", &retain_static_batches))
+					Renderer3D::SetRetainStaticBatches(retain_static_batches);
+
+				if (retain_static_batches)
+				{
+					ImGui::Text("Static Batches Drawn"); ImGui::SameLine(text_separation);
+					ImGui::Text("%i (%i Rebuilt, %i Retained)", stats.StaticBatchesDrawn, stats.StaticBatchesRebuilt, Renderer3D::GetRetainedStaticBatchesCount());
+				}
+			}
+
+			// Frustum Culling
+			ImGui::Text("Meshes Submitted"); ImGui::SameLine(text_separation);
+			ImGui::Text("%i (%i Culled)", stats.SubmittedMeshes, stats.CulledMeshes);
 		}
 		else
 		{
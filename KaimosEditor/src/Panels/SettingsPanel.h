@@ -8,6 +8,7 @@
 
 namespace Kaimos {
 	class Scene;
+	class SceneHistory;
 
 	class SettingsPanel
 	{
@@ -15,7 +16,7 @@ namespace Kaimos {
 
 		// --- Public Class Methods ---
 		SettingsPanel();
-		void OnUIRender(const Ref<Scene>& current_scene, const Entity& hov_entity, bool& closing_settings, bool& closing_performance);
+		void OnUIRender(const Ref<Scene>& current_scene, const SceneHistory& scene_history, const Entity& hov_entity, bool& closing_settings, bool& closing_performance);
 
 	private:
 
@@ -26,7 +27,7 @@ namespace Kaimos {
 		void SetRenderTimeMetrics(const Ref<Scene>& current_scene);
 		void DisplayFPSMetrics(const Ref<Scene>& current_scene);
 		void SetMemoryMetrics();
-		void DisplayMemoryMetrics();
+		void DisplayMemoryMetrics(const SceneHistory& scene_history);
 		void DisplayRenderingMetrics(bool display_3Dmetrics);
 
 	public:
@@ -5,6 +5,7 @@
 #include "Input/Input.h"
 #include "Renderer/Renderer.h"
 #include "Core/Resources/ResourceManager.h"
+#include "Core/Utils/Jobs/JobSystem.h"
 #include <GLFW/glfw3.h>
 
 
@@ -49,6 +50,7 @@ namespace Kaimos {
 		m_ImGuiLayer = new ImGuiLayer(); // It will be deleted with all the other layers in the ~LayerStack()
 		PushOverlay(m_ImGuiLayer);
 
+		JobSystem::Init();
 		Renderer::CreateRenderer();
 		Deserialize();
 		Renderer::Init();
@@ -64,6 +66,8 @@ namespace Kaimos {
 		KS_PROFILE_FUNCTION();
 		Serialize();
 		Renderer::Shutdown();
+		Resources::ResourceManager::EvictUnusedTextures(true); // Materials are gone, so cached textures can be freed while the context exists
+		JobSystem::Shutdown();
 	}
 
 
@@ -127,6 +131,9 @@ namespace Kaimos {
 			m_Timestep = m_Time - m_LastFrameTime;	// How long this frame is (dt, current time vs last frame time)
 			m_LastFrameTime = m_Time;
 
+			// -- Publish Finished Imports --
+			Resources::ResourceManager::UpdateImports();
+
 			// -- Layers Update --
 			if (!m_Minimized)
 			{
@@ -10,6 +10,8 @@
 
 #include "ImGui/ImGuiLayer.h"
 
+#include <atomic>
+
 
 // --- Main Declaration, Defined on EntryPoint ---
 int main(int argc, char** argv);
@@ -35,11 +37,12 @@ namespace Kaimos {
 
 	private:
 
-		mutable uint m_TotalAllocated = 0;
-		mutable uint m_Allocations = 0;
+		// Atomics since the Job System workers allocate too
+		mutable std::atomic<uint> m_TotalAllocated = { 0 };
+		mutable std::atomic<uint> m_Allocations = { 0 };
 
-		mutable uint m_TotalFreed = 0;
-		mutable uint m_Deallocations = 0;
+		mutable std::atomic<uint> m_TotalFreed = { 0 };
+		mutable std::atomic<uint> m_Deallocations = { 0 };
 	};
 
 
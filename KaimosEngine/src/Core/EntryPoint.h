@@ -51,6 +51,10 @@
 		if (!std::filesystem::exists(materials_settings_path) || !std::filesystem::is_directory(materials_settings_path))
 			std::filesystem::create_directories(materials_settings_path);
 
+		std::string mesh_cache_path = INTERNAL_SETTINGS_PATH + std::string("mesh_cache");
+		if (!std::filesystem::exists(mesh_cache_path) || !std::filesystem::is_directory(mesh_cache_path))
+			std::filesystem::create_directories(mesh_cache_path);
+
 		// -- Initialization --
 		Kaimos::Log::Init();
 		KS_INFO("\n\n--- KAIMOS ENGINE STARTED ---");
@@ -7,6 +7,9 @@
 #include "Renderer/Renderer3D.h"
 #include "Renderer/Resources/Material.h"
 #include "Renderer/Resources/Buffer.h"
+#include "Renderer/Resources/Texture.h"
+#include "Core/Utils/PlatformUtils.h"
+#include "Core/Utils/Jobs/JobSystem.h"
 
 #include <glm/gtc/type_ptr.hpp>
 #include <assimp/scene.h>
@@ -18,69 +21,144 @@ namespace Kaimos::Importers
 	static const uint s_ImportingFlags = aiProcess_Triangulate | aiProcess_CalcTangentSpace | aiProcess_GenSmoothNormals | aiProcess_FlipUVs // FlipUVs gives problem with UVs, I think because STB already flips them
 		| aiProcess_JoinIdenticalVertices | aiProcess_PreTransformVertices | aiProcess_ImproveCacheLocality | aiProcess_OptimizeMeshes | aiProcess_SortByPType;
 
+	// --- Imported Model Data ---
+	struct ImportedTexture
+	{
+		std::string Filepath = "";
+		Ref<TextureData> Data = nullptr;
+		bool Cached = false;
+	};
+
+	struct ImportedMaterial
+	{
+		std::string Name = "unnamed";
+		glm::vec4 Color = glm::vec4(1.0f);
+		float Bumpiness = 1.0f, Smoothness = 0.5f, Roughness = 0.5f, Metallic = 0.5f, AmbientOcclusion = 0.0f;
+		std::vector<std::pair<MATERIAL_TEXTURES, uint>> Textures;	// Type & index in the model textures
+	};
+
+	struct ImportedMesh
+	{
+		std::string Name = "unnamed";
+		std::vector<Vertex> Vertices;
+		std::vector<uint> Indices;
+		uint MaxIndex = 0, MaterialIndex = 0;						// Material index is Assimp's one
+	};
+
+	struct ImportedModel
+	{
+		std::string Filepath = "";
+		uint64_t SourceHash = 0;
+		std::vector<ImportedTexture> Textures;
+		std::vector<ImportedMaterial> Materials;					// Without Assimp's default one
+		std::vector<ImportedMesh> Meshes;							// Root mesh first, then its submeshes
+	};
+
+	// --- Mesh Cache File (.kmesh) ---
+	// Header, then an entry per mesh (root & submeshes, depth-first) and then the vertices & indices arrays of each one,
+	// aligned so the file can be mapped and its arrays read in place. Bump the version when changing any of this or the Vertex
+	static constexpr char s_MeshCacheMagic[4] = { 'K', 'M', 'S', 'H' };
+	static constexpr uint s_MeshCacheVersion = 1;
+	static constexpr uint64_t s_MeshCacheAlignment = 16;
+
+	struct MeshCacheHeader
+	{
+		char Magic[4] = {};
+		uint Version = 0;
+		uint64_t SourceHash = 0;
+		uint ImportingFlags = 0, VertexSize = 0;
+		uint MeshesCount = 0, Padding = 0;
+	};
+
+	struct MeshCacheEntry
+	{
+		uint64_t VerticesOffset = 0, IndicesOffset = 0;
+		uint VerticesCount = 0, IndicesCount = 0;
+		uint MaxIndex = 0, SubmeshesCount = 0;
+		Maths::AABB AABB = {};
+		Maths::BoundingSphere BoundingSphere = {};
+	};
+
+	static void GatherMeshes(const Ref<Mesh>& mesh, std::vector<Mesh*>& meshes)
+	{
+		meshes.push_back(mesh.get());
+		for (const Ref<Mesh>& submesh : mesh->GetSubmeshes())
+			GatherMeshes(submesh, meshes);
+	}
+
+	static uint64_t AlignCacheOffset(uint64_t offset)
+	{
+		return (offset + s_MeshCacheAlignment - 1) & ~(s_MeshCacheAlignment - 1);
+	}
+
+
+
 	// ----------------------- Protected Importer Methods -------------------------------------------------
 	Ref<Resources::ResourceModel> ImporterModel::LoadModel(const std::string& filepath)
+	{
+		// -- Parse Model --
+		Ref<ImportedModel> imported_model = ParseModel(filepath);
+		if (!imported_model)
+			return nullptr;
+
+		// -- Decode the Non-Cached Textures (in parallel if there are workers) & Create the Resources --
+		std::vector<uint> textures_to_decode;
+		for (uint i = 0; i < GetTexturesCount(*imported_model); ++i)
+			if (!IsTextureCached(*imported_model, i))
+				textures_to_decode.push_back(i);
+
+		JobSystem::Dispatch((uint)textures_to_decode.size(), 1, [&](uint index) { DecodeTexture(*imported_model, textures_to_decode[index]); });
+		JobSystem::Wait();
+
+		return CommitModel(*imported_model);
+	}
+
+
+	Ref<Resources::ResourceModel> ImporterModel::LoadDeserializedModel(const std::string& filepath, uint model_id, Ref<Mesh> root_mesh)
 	{
 		// -- Check & Set Path --
 		std::filesystem::path fpath;
 		if (!CheckPath(filepath, fpath)) // fpath passed by ref, will be returned absolute if not
 			return nullptr;
 
-		// -- Load Scene --
-		Assimp::Importer importer;
-		const aiScene* scene = importer.ReadFile(filepath, s_ImportingFlags);
+		// -- Load Meshes from Cache --
+		uint64_t source_hash = GetFileHash(fpath);
+		bool cached = LoadMeshCache(model_id, source_hash, root_mesh);
 
-		if (!CheckScene(scene, importer))
-			return nullptr;
+		// -- Load Scene (only if the cache is missing or stale) --
+		Assimp::Importer importer;
+		const aiScene* scene = nullptr;
 
-		// -- Load Materials --
-		std::vector<uint> materials;
-		for (uint i = 0; i < scene->mNumMaterials; ++i)
+		if (!cached)
 		{
-			uint mat_id = ProcessAssimpMaterial(scene->mMaterials[i], fpath.parent_path().string());
-			if (mat_id != 0)
-				materials.push_back(mat_id);
+			scene = importer.ReadFile(filepath, s_ImportingFlags);
+			if (!CheckScene(scene, importer))
+				return nullptr;
 		}
 
-		// -- Load Meshes --
-		aiMesh* first_mesh = scene->mMeshes[0];
-		Ref<Kaimos::Mesh> root_mesh = ProcessAssimpMesh(scene, first_mesh);
+		// -- Create Model --
+		Ref<Resources::ResourceModel> model = CreateRef<Resources::ResourceModel>(new Resources::ResourceModel(fpath.string(), model_id, root_mesh));
+		root_mesh->SetParentModel(model.get());
 
-		if (root_mesh)
+		// -- Process Root Mesh & Nodes --
+		if (!cached)
 		{
-			// -- Create Root Mesh --
-			Ref<Resources::ResourceModel> model = CreateRef<Resources::ResourceModel>(new Resources::ResourceModel(fpath.string(), 0, root_mesh));
-			root_mesh->SetParentModel(model.get());
-
-			// -- Pick Material for Root Mesh --
-			uint mat_id = Renderer::GetDefaultMaterialID();
-			if (materials.size() > 0)
-			{
-				if (first_mesh->mMaterialIndex == 0)
-				{
-					if (materials[0] != mat_id)
-						mat_id = materials[0];
-				}
-				else
-					mat_id = materials[first_mesh->mMaterialIndex - 1];
-			}
-			
-			// -- Set Root Mesh Material & Process Nodes From Root Mesh --
-			root_mesh->SetMaterial(mat_id);			
-			ProcessAssimpNode(scene, scene->mRootNode, materials, root_mesh.get());
-			
-			// -- Return Model --
-			return model;
+			ProcessDeserializedMesh(root_mesh, scene->mMeshes[0]);
+			ProcessDeserializedNode(scene, scene->mRootNode, root_mesh->GetSubmeshes());
+			SaveMeshCache(model_id, source_hash, root_mesh);
 		}
-		else
-			KS_ERROR("Failed to load Root Mesh with AssimpLoader");
-		
-		return nullptr;
+
+		// -- Return Model --
+		return model;
 	}
 
 
-	Ref<Resources::ResourceModel> ImporterModel::LoadDeserializedModel(const std::string& filepath, uint model_id, Ref<Mesh> root_mesh)
+	
+	// ----------------------- Protected Staged Import Methods --------------------------------------------
+	Ref<ImportedModel> ImporterModel::ParseModel(const std::string& filepath)
 	{
+		KS_PROFILE_FUNCTION();
+
 		// -- Check & Set Path --
 		std::filesystem::path fpath;
 		if (!CheckPath(filepath, fpath)) // fpath passed by ref, will be returned absolute if not
@@ -93,91 +171,162 @@ namespace Kaimos::Importers
 		if (!CheckScene(scene, importer))
 			return nullptr;
 
-		// -- Create Model --
-		Ref<Resources::ResourceModel> model = CreateRef<Resources::ResourceModel>(new Resources::ResourceModel(fpath.string(), model_id, root_mesh));
+		Ref<ImportedModel> imported_model = CreateRef<ImportedModel>();
+		imported_model->Filepath = fpath.string();
+		imported_model->SourceHash = GetFileHash(fpath);
 
-		// -- Process Root Mesh & Nodes --
+		// -- Load Materials --
+		for (uint i = 0; i < scene->mNumMaterials; ++i)
+			ProcessAssimpMaterial(scene->mMaterials[i], fpath.parent_path().string(), *imported_model);
+
+		// -- Load Root Mesh & Submeshes --
+		if (!ProcessAssimpMesh(scene->mMeshes[0], *imported_model))
+		{
+			KS_ERROR("Failed to load Root Mesh with AssimpLoader");
+			return nullptr;
+		}
+
+		ProcessAssimpNode(scene, scene->mRootNode, *imported_model);
+		return imported_model;
+	}
+
+
+	uint ImporterModel::GetTexturesCount(const ImportedModel& imported_model)
+	{
+		return (uint)imported_model.Textures.size();
+	}
+
+
+	bool ImporterModel::IsTextureCached(ImportedModel& imported_model, uint texture_index)
+	{
+		ImportedTexture& texture = imported_model.Textures[texture_index];
+		texture.Cached = Resources::ResourceManager::IsTextureCached(texture.Filepath);
+		return texture.Cached;
+	}
+
+
+	void ImporterModel::DecodeTexture(ImportedModel& imported_model, uint texture_index)
+	{
+		ImportedTexture& texture = imported_model.Textures[texture_index];
+		texture.Data = TextureData::Load(texture.Filepath);
+	}
+
+
+	Ref<Resources::ResourceModel> ImporterModel::CommitModel(ImportedModel& imported_model)
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- Create or Get the Cached Textures --
+		std::vector<Ref<Texture2D>> textures;
+		for (const ImportedTexture& texture : imported_model.Textures)
+		{
+			Ref<Texture2D> new_texture = nullptr;
+			if (texture.Cached)
+				new_texture = Resources::ResourceManager::GetTexture(texture.Filepath); // Reloaded if evicted meanwhile
+			else if (texture.Data)
+			{
+				// Another import could have cached it meanwhile, then that one is used
+				new_texture = Resources::ResourceManager::FindTexture(texture.Filepath);
+				if (!new_texture)
+					new_texture = Resources::ResourceManager::AddTexture(Texture2D::Create(*texture.Data));
+			}
+
+			textures.push_back(new_texture);
+		}
+
+		// -- Create Materials --
+		std::vector<uint> materials;
+		for (const ImportedMaterial& imported_material : imported_model.Materials)
+		{
+			const Ref<Material>& mat = Renderer::CreateMaterial(imported_material.Name);
+			mat->Color = imported_material.Color;
+			mat->Bumpiness = imported_material.Bumpiness;
+			mat->Smoothness = imported_material.Smoothness;
+			mat->Metallic = imported_material.Metallic;
+			mat->AmbientOcclusion = imported_material.AmbientOcclusion;
+			mat->Roughness = imported_material.Roughness;
+			mat->SyncGraphValuesWithMaterial();
+
+			for (const std::pair<MATERIAL_TEXTURES, uint>& texture : imported_material.Textures)
+				mat->SetTexture(texture.first, textures[texture.second]);
+
+			materials.push_back(mat->GetID());
+		}
+
+		// -- Create Meshes --
+		std::vector<Ref<Mesh>> meshes;
+		for (ImportedMesh& imported_mesh : imported_model.Meshes)
+		{
+			Ref<Mesh> mesh = CreateRef<Mesh>(imported_mesh.Name);
+			Kaimos::Resources::ResourceManager::AddMesh(mesh);
+
+			mesh->SetMeshVertices(std::move(imported_mesh.Vertices));
+			mesh->SetMeshIndices(std::move(imported_mesh.Indices));
+			mesh->SetMaxIndex(imported_mesh.MaxIndex + 1);
+			mesh->CalculateBoundingVolumes();
+			mesh->SetMaterial(GetMaterialFromAssimpIndex(materials, imported_mesh.MaterialIndex));
+			meshes.push_back(mesh);
+		}
+
+		// -- Create Model & Fill Root Mesh Submeshes --
+		const Ref<Mesh>& root_mesh = meshes[0];
+		Ref<Resources::ResourceModel> model = CreateRef<Resources::ResourceModel>(new Resources::ResourceModel(imported_model.Filepath, 0, root_mesh));
 		root_mesh->SetParentModel(model.get());
-		ProcessDeserializedMesh(root_mesh, scene->mMeshes[0]);
-		ProcessDeserializedNode(scene, scene->mRootNode, root_mesh->GetSubmeshes());
+
+		for (uint i = 1; i < meshes.size(); ++i)
+			root_mesh->AddSubmesh(meshes[i]);
+
+		// -- Cache the Processed Meshes for the next Deserializations (meshes aren't modified once imported) --
+		uint model_id = model->GetID();
+		uint64_t source_hash = imported_model.SourceHash;
+		JobSystem::ExecuteBackground([model_id, source_hash, root_mesh]() { SaveMeshCache(model_id, source_hash, root_mesh); });
 
 		// -- Return Model --
 		return model;
 	}
 
 
-	
+
 	// ----------------------- Private Importer Methods ---------------------------------------------------
-	void ImporterModel::ProcessAssimpNode(const aiScene* ai_scene, const aiNode* ai_node, const std::vector<uint>& loaded_materials, Kaimos::Mesh* mesh)
+	void ImporterModel::ProcessAssimpNode(const aiScene* ai_scene, const aiNode* ai_node, ImportedModel& imported_model)
 	{
-		// -- Process Node Meshes --
-		std::vector<Ref<Kaimos::Mesh>> node_meshes;
+		// -- Process Node Meshes (the first one is the root mesh) --
 		for (uint i = 0; i < ai_node->mNumMeshes; ++i)
 		{
 			if (ai_node->mMeshes[i] != 0)
-			{
-				// Process Mesh
-				aiMesh* ai_mesh = ai_scene->mMeshes[ai_node->mMeshes[i]];
-				node_meshes.push_back(ProcessAssimpMesh(ai_scene, ai_mesh));
-
-				// Pick Material
-				uint mat_id = Renderer::GetDefaultMaterialID();
-				if (ai_mesh->mMaterialIndex == 0)
-				{
-					if (loaded_materials[0] != mat_id)
-						mat_id = loaded_materials[0];
-				}
-				else
-					mat_id = loaded_materials[ai_mesh->mMaterialIndex - 1];
-				
-				// Set Mesh Material
-				node_meshes[i]->SetMaterial(mat_id);
-			}
+				ProcessAssimpMesh(ai_scene->mMeshes[ai_node->mMeshes[i]], imported_model);
 		}
 
-		// -- Fill Mesh Submeshes --
-		for (uint i = 0; i < node_meshes.size(); ++i)
-			if (node_meshes[i] != nullptr)
-				mesh->AddSubmesh(node_meshes[i]);
-
 		// -- Process Node Children Meshes --
 		for (uint i = 0; i < ai_node->mNumChildren; i++)
-			ProcessAssimpNode(ai_scene, ai_node->mChildren[i], loaded_materials, mesh);
+			ProcessAssimpNode(ai_scene, ai_node->mChildren[i], imported_model);
 	}
 
 
-	Ref<Kaimos::Mesh> ImporterModel::ProcessAssimpMesh(const aiScene* ai_scene, const aiMesh* ai_mesh)
+	bool ImporterModel::ProcessAssimpMesh(const aiMesh* ai_mesh, ImportedModel& imported_model)
 	{
 		if (ai_mesh->mNumVertices == 0 || ai_mesh->mNumFaces == 0)
-			return nullptr;
+			return false;
 
 		// -- Process Vertices & Indices --
-		uint max_index = 0;
-		const std::vector<Vertex> mesh_vertices = ProcessMeshVertices(ai_mesh);
-		const std::vector<uint> indices = ProcessMeshIndices(ai_mesh, max_index);
-
-		// -- Create Mesh --
-		std::string mesh_name = ai_mesh->mName.length > 0 ? ai_mesh->mName.C_Str() : "unnamed";
-		Ref<Mesh> mesh = CreateRef<Mesh>(mesh_name);
-		Kaimos::Resources::ResourceManager::AddMesh(mesh);
-
-		// -- Set Mesh Data --
-		mesh->SetMeshVertices(mesh_vertices);
-		mesh->SetMeshIndices(indices);
-		mesh->SetMaxIndex(max_index + 1);
+		ImportedMesh mesh;
+		mesh.Name = ai_mesh->mName.length > 0 ? ai_mesh->mName.C_Str() : "unnamed";
+		mesh.Vertices = ProcessMeshVertices(ai_mesh);
+		mesh.Indices = ProcessMeshIndices(ai_mesh, mesh.MaxIndex);
+		mesh.MaterialIndex = ai_mesh->mMaterialIndex;
 
-		// -- Return Created Mesh --
-		return mesh;
+		imported_model.Meshes.push_back(std::move(mesh));
+		return true;
 	}
 
 
-	uint ImporterModel::ProcessAssimpMaterial(const aiMaterial* ai_material, const std::string& directory)
+	void ImporterModel::ProcessAssimpMaterial(const aiMaterial* ai_material, const std::string& directory, ImportedModel& imported_model)
 	{
 		// -- Ignore Assimp Default Material --
 		aiString name = aiString("unnamed");
 		ai_material->Get(AI_MATKEY_NAME, name);
 		if (name.C_Str() == std::string(AI_DEFAULT_MATERIAL_NAME))
-			return 0;
+			return;
 
 		// -- Load Material Variables --
 		aiColor3D diffuse = aiColor3D(1.0f);
@@ -200,44 +349,48 @@ namespace Kaimos::Importers
 		// AI_MATKEY_TWOSIDED (?), AI_MATKEY_COLOR_AMBIENT (Ka), AI_MATKEY_COLOR_TRANSPARENT (?)
 		// AI_MATKEY_REFRACTI (Ni -> Index of Refraction)
 
-		// -- Create Material & Set Variables --
-		const Ref<Material>& mat = Renderer::CreateMaterial(name.C_Str());
-
-		mat->Color = glm::vec4(diffuse.r, diffuse.g, diffuse.b, opacity);
-		mat->Bumpiness = bumpiness;
-		mat->Smoothness = shininess / 256.0f;
-		mat->Metallic = metallic;
-		mat->AmbientOcclusion = ambient_occ;
+		// -- Set Material Variables --
+		ImportedMaterial material;
+		material.Name = name.C_Str();
+		material.Color = glm::vec4(diffuse.r, diffuse.g, diffuse.b, opacity);
+		material.Bumpiness = bumpiness;
+		material.Smoothness = shininess / 256.0f;
+		material.Metallic = metallic;
+		material.AmbientOcclusion = ambient_occ;
 
 		// Phong Shininess -> Beckmann BRDF Roughness conversion
 		// https://simonstechblog.blogspot.com/2011/12/microfacet-brdf.html
 		// https://computergraphics.stackexchange.com/questions/1515/what-is-the-accepted-method-of-converting-shininess-to-roughness-and-vice-versa
-		mat->Roughness = sqrtf(2.0f / (2.0f + shininess));
-		mat->SyncGraphValuesWithMaterial();
+		material.Roughness = sqrtf(2.0f / (2.0f + shininess));
 
-		if (ai_material->GetTextureCount(aiTextureType_DIFFUSE) > 0)
-			mat->SetTexture(MATERIAL_TEXTURES::ALBEDO, GetMaterialTextureFilename(ai_material, aiTextureType_DIFFUSE, directory));
+		// -- Set Material Textures (each file is only decoded once per model) --
+		static const std::pair<aiTextureType, MATERIAL_TEXTURES> s_TextureTypes[] = {
+			{ aiTextureType_DIFFUSE, MATERIAL_TEXTURES::ALBEDO }, { aiTextureType_NORMALS, MATERIAL_TEXTURES::NORMAL },
+			{ aiTextureType_SPECULAR, MATERIAL_TEXTURES::SPECULAR }, { aiTextureType_DIFFUSE_ROUGHNESS, MATERIAL_TEXTURES::ROUGHNESS },
+			{ aiTextureType_METALNESS, MATERIAL_TEXTURES::METALLIC }, { aiTextureType_AMBIENT_OCCLUSION, MATERIAL_TEXTURES::AMBIENT_OC } };
 
-		if (ai_material->GetTextureCount(aiTextureType_NORMALS) > 0)
-			mat->SetTexture(MATERIAL_TEXTURES::NORMAL, GetMaterialTextureFilename(ai_material, aiTextureType_NORMALS, directory));
+		for (const std::pair<aiTextureType, MATERIAL_TEXTURES>& texture_type : s_TextureTypes)
+		{
+			if (ai_material->GetTextureCount(texture_type.first) == 0)
+				continue;
+
+			const std::string texture_filepath = GetMaterialTextureFilename(ai_material, texture_type.first, directory);
+			std::vector<ImportedTexture>& textures = imported_model.Textures;
+
+			uint texture_index = 0;
+			while (texture_index < textures.size() && textures[texture_index].Filepath != texture_filepath)
+				++texture_index;
 
-		if (ai_material->GetTextureCount(aiTextureType_SPECULAR) > 0)
-			mat->SetTexture(MATERIAL_TEXTURES::SPECULAR, GetMaterialTextureFilename(ai_material, aiTextureType_SPECULAR, directory));
-		
-		if (ai_material->GetTextureCount(aiTextureType_DIFFUSE_ROUGHNESS) > 0)
-			mat->SetTexture(MATERIAL_TEXTURES::ROUGHNESS, GetMaterialTextureFilename(ai_material, aiTextureType_DIFFUSE_ROUGHNESS, directory));
-		
-		if (ai_material->GetTextureCount(aiTextureType_METALNESS) > 0)
-			mat->SetTexture(MATERIAL_TEXTURES::METALLIC, GetMaterialTextureFilename(ai_material, aiTextureType_METALNESS, directory));
+			if (texture_index == textures.size())
+				textures.push_back({ texture_filepath, nullptr });
 
-		if (ai_material->GetTextureCount(aiTextureType_AMBIENT_OCCLUSION) > 0)
-			mat->SetTexture(MATERIAL_TEXTURES::AMBIENT_OC, GetMaterialTextureFilename(ai_material, aiTextureType_AMBIENT_OCCLUSION, directory));
+			material.Textures.push_back({ texture_type.second, texture_index });
+		}
 
 		// Also:
 		// aiTextureType_EMISSIVE, aiTextureType_HEIGHT, aiTextureType_DISPLACEMENT
 
-		// -- Return Material --
-		return mat->GetID();
+		imported_model.Materials.push_back(std::move(material));
 	}
 
 
@@ -276,10 +429,158 @@ namespace Kaimos::Importers
 		mesh->SetMeshVertices(mesh_vertices);
 		mesh->SetMeshIndices(indices);
 		mesh->SetMaxIndex(max_index + 1);
+		mesh->CalculateBoundingVolumes();
 
 		// -- Return Mesh --
 		return mesh;
 	}
+
+
+
+	// ----------------------- Private Mesh Cache Methods -------------------------------------------------
+	bool ImporterModel::LoadMeshCache(uint model_id, uint64_t source_hash, const Ref<Mesh>& root_mesh)
+	{
+		KS_PROFILE_FUNCTION();
+		if (source_hash == 0)
+			return false;
+
+		// -- Map Cache File --
+		MappedFile file;
+		if (!file.Open(GetMeshCachePath(model_id)) || file.GetSize() < sizeof(MeshCacheHeader))
+			return false;
+
+		const char* data = (const char*)file.GetData();
+		const MeshCacheHeader* header = (const MeshCacheHeader*)data;
+
+		// -- Check it's Valid & Up to Date --
+		if (memcmp(header->Magic, s_MeshCacheMagic, sizeof(s_MeshCacheMagic)) != 0 || header->Version != s_MeshCacheVersion
+			|| header->ImportingFlags != s_ImportingFlags || header->VertexSize != sizeof(Vertex) || header->SourceHash != source_hash)
+		{
+			KS_ENGINE_TRACE("Mesh cache of model {0} is stale, reimporting it", model_id);
+			return false;
+		}
+
+		// -- Check it Matches the Deserialized Meshes Hierarchy --
+		std::vector<Mesh*> meshes;
+		GatherMeshes(root_mesh, meshes);
+
+		uint64_t file_size = file.GetSize();
+		if (header->MeshesCount != meshes.size() || sizeof(MeshCacheHeader) + meshes.size() * sizeof(MeshCacheEntry) > file_size)
+		{
+			KS_ENGINE_WARN("Mesh cache of model {0} doesn't match its meshes hierarchy, reimporting it", model_id);
+			return false;
+		}
+
+		const MeshCacheEntry* entries = (const MeshCacheEntry*)(data + sizeof(MeshCacheHeader));
+		for (uint i = 0; i < meshes.size(); ++i)
+		{
+			const MeshCacheEntry& entry = entries[i];
+			if (entry.SubmeshesCount != meshes[i]->GetSubmeshes().size()
+				|| entry.VerticesOffset + (uint64_t)entry.VerticesCount * sizeof(Vertex) > file_size || entry.IndicesOffset + (uint64_t)entry.IndicesCount * sizeof(uint) > file_size)
+			{
+				KS_ENGINE_WARN("Mesh cache of model {0} is corrupted or doesn't match its meshes hierarchy, reimporting it", model_id);
+				return false;
+			}
+		}
+
+		// -- Set Meshes Data --
+		for (uint i = 0; i < meshes.size(); ++i)
+		{
+			const MeshCacheEntry& entry = entries[i];
+			const Vertex* vertices = (const Vertex*)(data + entry.VerticesOffset);
+			const uint* indices = (const uint*)(data + entry.IndicesOffset);
+
+			meshes[i]->SetMeshVertices(std::vector<Vertex>(vertices, vertices + entry.VerticesCount));
+			meshes[i]->SetMeshIndices(std::vector<uint>(indices, indices + entry.IndicesCount));
+			meshes[i]->SetMaxIndex(entry.MaxIndex);
+			meshes[i]->SetBoundingVolumes(entry.AABB, entry.BoundingSphere);
+		}
+
+		return true;
+	}
+
+
+	void ImporterModel::SaveMeshCache(uint model_id, uint64_t source_hash, const Ref<Mesh>& root_mesh)
+	{
+		KS_PROFILE_FUNCTION();
+		if (source_hash == 0)
+			return;
+
+		std::vector<Mesh*> meshes;
+		GatherMeshes(root_mesh, meshes);
+
+		// -- Setup Header & Entries --
+		MeshCacheHeader header;
+		memcpy(header.Magic, s_MeshCacheMagic, sizeof(s_MeshCacheMagic));
+		header.Version = s_MeshCacheVersion;
+		header.SourceHash = source_hash;
+		header.ImportingFlags = s_ImportingFlags;
+		header.VertexSize = sizeof(Vertex);
+		header.MeshesCount = (uint)meshes.size();
+
+		std::vector<MeshCacheEntry> entries(meshes.size());
+		uint64_t offset = sizeof(MeshCacheHeader) + entries.size() * sizeof(MeshCacheEntry);
+
+		for (uint i = 0; i < meshes.size(); ++i)
+		{
+			const Mesh* mesh = meshes[i];
+			MeshCacheEntry& entry = entries[i];
+
+			entry.VerticesCount = (uint)mesh->m_Vertices.size();
+			entry.IndicesCount = (uint)mesh->m_Indices.size();
+			entry.MaxIndex = mesh->m_MaxIndex;
+			entry.SubmeshesCount = (uint)mesh->m_Submeshes.size();
+			entry.AABB = mesh->m_AABB;
+			entry.BoundingSphere = mesh->m_BoundingSphere;
+
+			entry.VerticesOffset = AlignCacheOffset(offset);
+			offset = entry.VerticesOffset + entry.VerticesCount * sizeof(Vertex);
+			entry.IndicesOffset = AlignCacheOffset(offset);
+			offset = entry.IndicesOffset + entry.IndicesCount * sizeof(uint);
+		}
+
+		// -- Write File (into a temporary one, so a failed write never leaves a half cache behind) --
+		const std::string filepath = GetMeshCachePath(model_id);
+		const std::string temp_filepath = filepath + ".tmp";
+		std::ofstream file(temp_filepath, std::ios::binary | std::ios::trunc);
+		if (!file.good())
+		{
+			KS_ENGINE_WARN("Couldn't write the mesh cache of model {0} in '{1}'", model_id, filepath);
+			return;
+		}
+
+		static const char s_Padding[s_MeshCacheAlignment] = {};
+		file.write((const char*)&header, sizeof(MeshCacheHeader));
+		file.write((const char*)entries.data(), entries.size() * sizeof(MeshCacheEntry));
+
+		for (uint i = 0; i < meshes.size(); ++i)
+		{
+			const MeshCacheEntry& entry = entries[i];
+			file.write(s_Padding, entry.VerticesOffset - (uint64_t)file.tellp());
+			file.write((const char*)meshes[i]->m_Vertices.data(), entry.VerticesCount * sizeof(Vertex));
+			file.write(s_Padding, entry.IndicesOffset - (uint64_t)file.tellp());
+			file.write((const char*)meshes[i]->m_Indices.data(), entry.IndicesCount * sizeof(uint));
+		}
+
+		bool written = file.good();
+		file.close();
+
+		std::error_code error;
+		if (written)
+			std::filesystem::rename(temp_filepath, filepath, error);
+
+		if (!written || error)
+		{
+			KS_ENGINE_WARN("Couldn't write the mesh cache of model {0} in '{1}'", model_id, filepath);
+			std::filesystem::remove(temp_filepath, error);
+		}
+	}
+
+
+	const std::string ImporterModel::GetMeshCachePath(uint model_id)
+	{
+		return INTERNAL_SETTINGS_PATH + std::string("mesh_cache/Model_") + std::to_string(model_id) + ".kmesh";
+	}
 	
 
 
@@ -312,6 +613,26 @@ namespace Kaimos::Importers
 	}
 
 
+	uint64_t ImporterModel::GetFileHash(const std::filesystem::path& filepath)
+	{
+		KS_PROFILE_FUNCTION();
+		MappedFile file;
+		if (!file.Open(filepath.string()))
+			return 0;
+
+		// -- FNV-1a (64 bits) --
+		uint64_t hash = 14695981039346656037ull;
+		const unsigned char* data = (const unsigned char*)file.GetData();
+		for (size_t i = 0; i < file.GetSize(); ++i)
+		{
+			hash ^= data[i];
+			hash *= 1099511628211ull;
+		}
+
+		return hash;
+	}
+
+
 	const std::string ImporterModel::GetMaterialTextureFilename(const aiMaterial* ai_material, aiTextureType texture_type, const std::string& directory)
 	{
 		aiString texture_filename;
@@ -320,6 +641,19 @@ namespace Kaimos::Importers
 	}
 
 
+	uint ImporterModel::GetMaterialFromAssimpIndex(const std::vector<uint>& loaded_materials, uint ai_material_index)
+	{
+		// Assimp's default material is the first one (and it's not loaded)
+		if (loaded_materials.empty())
+			return Renderer::GetDefaultMaterialID();
+
+		if (ai_material_index == 0)
+			return loaded_materials[0];
+
+		return ai_material_index - 1 < loaded_materials.size() ? loaded_materials[ai_material_index - 1] : Renderer::GetDefaultMaterialID();
+	}
+
+
 	const std::vector<Kaimos::Vertex> ImporterModel::ProcessMeshVertices(const aiMesh* ai_mesh)
 	{
 		std::vector<Vertex> ret;
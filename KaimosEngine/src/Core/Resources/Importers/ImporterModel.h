@@ -24,6 +24,9 @@ namespace Kaimos {
 
 	namespace Importers {
 
+		// Model parsed into plain data (meshes, materials & decoded textures), without creating any engine resource
+		struct ImportedModel;
+
 		class ImporterModel
 		{
 			friend class Kaimos::Resources::ResourceManager;
@@ -33,23 +36,40 @@ namespace Kaimos {
 			static Ref<Resources::ResourceModel> LoadModel(const std::string& filepath);
 			static Ref<Resources::ResourceModel> LoadDeserializedModel(const std::string& filepath, uint model_id, Ref<Mesh> root_mesh);
 
+			// --- Protected Staged Import Methods ---
+			// A model load split so that parsing & decoding its textures (thread-safe) can run in worker threads
+			// Textures can be decoded in parallel (one index each), and the commit (on the main thread) creates & returns its resources
+			static Ref<ImportedModel> ParseModel(const std::string& filepath);
+			static uint GetTexturesCount(const ImportedModel& imported_model);
+			static bool IsTextureCached(ImportedModel& imported_model, uint texture_index);	// Main thread only, cached ones don't need decoding
+			static void DecodeTexture(ImportedModel& imported_model, uint texture_index);
+			static Ref<Resources::ResourceModel> CommitModel(ImportedModel& imported_model);
+
 		private:
 
 			// --- Private Importer Methods ---
-			static void ProcessAssimpNode(const aiScene* ai_scene, const aiNode* ai_node, const std::vector<uint>& loaded_materials, Kaimos::Mesh* mesh);
-			static Ref<Kaimos::Mesh> ProcessAssimpMesh(const aiScene* ai_scene, const aiMesh* ai_mesh);
-			static uint ProcessAssimpMaterial(const aiMaterial* ai_material, const std::string& directory);
+			static void ProcessAssimpNode(const aiScene* ai_scene, const aiNode* ai_node, ImportedModel& imported_model);
+			static bool ProcessAssimpMesh(const aiMesh* ai_mesh, ImportedModel& imported_model);
+			static void ProcessAssimpMaterial(const aiMaterial* ai_material, const std::string& directory, ImportedModel& imported_model);
 			
 			// --- Private Deserialization Methods ---
 			static void ProcessDeserializedNode(const aiScene* ai_scene, const aiNode* ai_node, const std::vector<Ref<Mesh>>& submeshes);
 			static Ref<Kaimos::Mesh> ProcessDeserializedMesh(Ref<Mesh> mesh, const aiMesh* ai_mesh);
 
+			// --- Private Mesh Cache Methods ---
+			// Processed meshes of a model are cached in a binary .kmesh file, valid while the source file and importing flags don't change
+			static bool LoadMeshCache(uint model_id, uint64_t source_hash, const Ref<Mesh>& root_mesh);
+			static void SaveMeshCache(uint model_id, uint64_t source_hash, const Ref<Mesh>& root_mesh);
+			static const std::string GetMeshCachePath(uint model_id);
+
 
 			// --- Private Helper Methods ---
 			static bool CheckPath(const std::string& filepath, std::filesystem::path& ret_path);
 			static bool CheckScene(const aiScene* scene, const Assimp::Importer& importer);
+			static uint64_t GetFileHash(const std::filesystem::path& filepath);
 
 			static const std::string GetMaterialTextureFilename(const aiMaterial* ai_material, aiTextureType texture_type, const std::string& directory);
+			static uint GetMaterialFromAssimpIndex(const std::vector<uint>& loaded_materials, uint ai_material_index);
 			static const std::vector<Kaimos::Vertex> ProcessMeshVertices(const aiMesh* ai_mesh);
 			static const std::vector<uint> ProcessMeshIndices(const aiMesh* ai_mesh, uint& max_index);
 		};
@@ -0,0 +1,40 @@
+#ifndef _MODELIMPORT_H_
+#define _MODELIMPORT_H_
+
+#include "Core/Core.h"
+#include <atomic>
+
+namespace Kaimos::Importers { struct ImportedModel; }
+namespace Kaimos::Resources {
+
+	class ResourceModel;
+	enum class IMPORT_STAGE { PARSING = 0, PARSED, DECODING_TEXTURES, DONE, FAILED };
+
+	// Handle of a model being imported in the background (see ResourceManager::CreateModelAsync())
+	// The model is parsed & its textures decoded by workers, and it's published by the main thread once finished
+	class ModelImport
+	{
+		friend class ResourceManager;
+	public:
+
+		ModelImport(const std::string& filepath) : m_Filepath(filepath) {}
+
+		// --- Getters ---
+		bool IsDone()							const { return m_Stage == IMPORT_STAGE::DONE || m_Stage == IMPORT_STAGE::FAILED; }
+		bool HasFailed()						const { return m_Stage == IMPORT_STAGE::FAILED; }
+		IMPORT_STAGE GetStage()					const { return m_Stage; }
+		const std::string& GetFilepath()		const { return m_Filepath; }
+		const Ref<ResourceModel>& GetModel()	const { return m_Model; }	// nullptr until done
+
+	private:
+
+		std::string m_Filepath = "";
+		std::atomic<IMPORT_STAGE> m_Stage = { IMPORT_STAGE::PARSING };
+		std::atomic<uint> m_TexturesLeft = { 0 };
+
+		Ref<Importers::ImportedModel> m_ImportedModel = nullptr;
+		Ref<ResourceModel> m_Model = nullptr;
+	};
+}
+
+#endif //_MODELIMPORT_H_
@@ -3,6 +3,9 @@
 #include "ResourceModel.h"
 #include "Importers/ImporterModel.h"
 #include "Renderer/Renderer.h"
+#include "Renderer/Resources/Texture.h"
+#include "Core/Utils/Jobs/JobSystem.h"
+#include "Scene/KaimosYAMLExtension.h"
 
 #include <yaml-cpp/yaml.h>
 
@@ -12,6 +15,12 @@ namespace Kaimos::Resources {
 	// ----------------------- Variables Initialization ---------------------------------------------------
 	std::unordered_map<std::string, Ref<ResourceModel>> ResourceManager::m_ModelResources = {};
 	std::unordered_map<uint, Ref<Mesh>> ResourceManager::m_MeshesResources = {};
+	std::vector<Ref<ModelImport>> ResourceManager::m_PendingImports = {};
+
+	std::unordered_map<std::string, ResourceManager::CachedTexture> ResourceManager::m_TexturesResources = {};
+	ResourceManager::TextureCacheStats ResourceManager::m_TextureCacheStats = {};
+	uint64_t ResourceManager::m_TexturesMemoryBudget = 512ull * 1024ull * 1024ull;
+	uint64_t ResourceManager::m_TexturesAccessCount = 0;
 
 
 
@@ -36,6 +45,15 @@ namespace Kaimos::Resources {
 		
 		m_ModelResources.clear();
 		m_MeshesResources.clear();
+		m_PendingImports.clear();
+		EvictUnusedTextures(true);
+
+		if (!m_TexturesResources.empty())
+			KS_ENGINE_WARN("Deleting {0} textures with +1 references loaded!", m_TexturesResources.size());
+
+		m_TexturesResources.clear();
+		m_TextureCacheStats.TexturesCount = 0;
+		m_TextureCacheStats.ResidentBytes = 0;
 	}
 
 
@@ -88,6 +106,105 @@ namespace Kaimos::Resources {
 	}
 
 
+	Ref<ModelImport> ResourceManager::CreateModelAsync(const std::string& filepath)
+	{
+		size_t rel_pos = filepath.find("assets");
+		if (rel_pos == std::string::npos)
+		{
+			KS_ERROR("Error Creating model: Cannot load an out-of-project resource, try moving it inside 'assets/' folder.\nCurrent Filepath: {0}", filepath);
+			Ref<ModelImport> failed_import = CreateRef<ModelImport>(filepath);
+			failed_import->m_Stage = IMPORT_STAGE::FAILED;
+			return failed_import;
+		}
+
+		// -- Return the Model if Loaded or its Import if Pending --
+		const std::string relative_path = filepath.substr(rel_pos, filepath.size());
+		for (const Ref<ModelImport>& pending_import : m_PendingImports)
+			if (pending_import->GetFilepath() == relative_path)
+				return pending_import;
+
+		Ref<ModelImport> model_import = CreateRef<ModelImport>(relative_path);
+		auto& it = m_ModelResources.find(relative_path);
+		if (it != m_ModelResources.end())
+		{
+			model_import->m_Model = (*it).second;
+			model_import->m_Stage = IMPORT_STAGE::DONE;
+			return model_import;
+		}
+
+		// -- Parse it in the Background --
+		m_PendingImports.push_back(model_import);
+		JobSystem::ExecuteBackground([model_import, filepath]()
+			{
+				model_import->m_ImportedModel = Kaimos::Importers::ImporterModel::ParseModel(filepath);
+				model_import->m_Stage = IMPORT_STAGE::PARSED;
+			});
+
+		return model_import;
+	}
+
+
+	void ResourceManager::UpdateImports()
+	{
+		KS_PROFILE_FUNCTION();
+		for (std::vector<Ref<ModelImport>>::iterator it = m_PendingImports.begin(); it != m_PendingImports.end();)
+		{
+			Ref<ModelImport> model_import = *it;
+
+			// -- Parsed: Decode its Textures in Parallel --
+			if (model_import->m_Stage == IMPORT_STAGE::PARSED)
+			{
+				if (!model_import->m_ImportedModel)
+				{
+					KS_ERROR("Error Creating model: Couldn't Import Model '{0}'", model_import->GetFilepath());
+					model_import->m_Stage = IMPORT_STAGE::FAILED;
+					it = m_PendingImports.erase(it);
+					continue;
+				}
+
+				// Cached textures aren't decoded again
+				std::vector<uint> textures_to_decode;
+				for (uint i = 0; i < Kaimos::Importers::ImporterModel::GetTexturesCount(*model_import->m_ImportedModel); ++i)
+					if (!Kaimos::Importers::ImporterModel::IsTextureCached(*model_import->m_ImportedModel, i))
+						textures_to_decode.push_back(i);
+
+				model_import->m_TexturesLeft = (uint)textures_to_decode.size();
+				model_import->m_Stage = IMPORT_STAGE::DECODING_TEXTURES;
+
+				for (uint texture_index : textures_to_decode)
+				{
+					JobSystem::ExecuteBackground([model_import, texture_index]()
+						{
+							Kaimos::Importers::ImporterModel::DecodeTexture(*model_import->m_ImportedModel, texture_index);
+							--model_import->m_TexturesLeft;
+						});
+				}
+			}
+
+			// -- Textures Decoded: Create & Publish the Resources --
+			if (model_import->m_Stage == IMPORT_STAGE::DECODING_TEXTURES && model_import->m_TexturesLeft == 0)
+			{
+				// A synchronous import of the same file might have finished before
+				auto& model_it = m_ModelResources.find(model_import->GetFilepath());
+				if (model_it != m_ModelResources.end())
+					model_import->m_Model = (*model_it).second;
+				else if (Ref<ResourceModel> model = Kaimos::Importers::ImporterModel::CommitModel(*model_import->m_ImportedModel))
+				{
+					m_ModelResources.insert({ model->GetFilepath(), model });
+					model_import->m_Model = model;
+				}
+
+				model_import->m_ImportedModel.reset();
+				model_import->m_Stage = model_import->m_Model ? IMPORT_STAGE::DONE : IMPORT_STAGE::FAILED;
+				it = m_PendingImports.erase(it);
+				continue;
+			}
+
+			++it;
+		}
+	}
+
+
 	bool ResourceManager::ModelExists(uint model_id)
 	{
 		for (auto& model : m_ModelResources)
@@ -162,14 +279,114 @@ namespace Kaimos::Resources {
 
 	
 	
+	// ----------------------- Texture Cache --------------------------------------------------------------
+	Ref<Texture2D> ResourceManager::GetTexture(const std::string& filepath)
+	{
+		if (Ref<Texture2D> texture = FindTexture(filepath))
+			return texture;
+
+		// -- Load & Cache it (invalid textures get the ID 0) --
+		Ref<Texture2D> texture = Texture2D::Create(filepath);
+		if (!texture || texture->GetTextureID() == 0)
+			return nullptr;
+
+		return AddTexture(texture);
+	}
+
+
+	Ref<Texture2D> ResourceManager::FindTexture(const std::string& filepath)
+	{
+		auto& it = m_TexturesResources.find(GetTextureKey(filepath));
+		if (it == m_TexturesResources.end())
+		{
+			++m_TextureCacheStats.Misses;
+			return nullptr;
+		}
+
+		++m_TextureCacheStats.Hits;
+		it->second.LastAccess = ++m_TexturesAccessCount;
+		return it->second.Texture;
+	}
+
+
+	bool ResourceManager::IsTextureCached(const std::string& filepath)
+	{
+		return m_TexturesResources.find(GetTextureKey(filepath)) != m_TexturesResources.end();
+	}
+
+
+	Ref<Texture2D> ResourceManager::AddTexture(const Ref<Texture2D>& texture)
+	{
+		if (!texture)
+			return nullptr;
+
+		// -- Imports decoding the same texture can race to add it, the first one stays (it might be referenced already) --
+		auto it = m_TexturesResources.emplace(GetTextureKey(texture->GetFilepath()), CachedTexture{ texture, 0 });
+		CachedTexture& cached_texture = it.first->second;
+		cached_texture.LastAccess = ++m_TexturesAccessCount;
+
+		if (!it.second)
+			return cached_texture.Texture;
+
+		m_TextureCacheStats.ResidentBytes += texture->GetMemorySize();
+		m_TextureCacheStats.TexturesCount = (uint)m_TexturesResources.size();
+		EvictUnusedTextures();
+		return texture;
+	}
+
+
+	void ResourceManager::EvictUnusedTextures(bool all)
+	{
+		if (!all && m_TextureCacheStats.ResidentBytes <= m_TexturesMemoryBudget)
+			return;
+
+		KS_PROFILE_FUNCTION();
+
+		// -- Gather the Unreferenced Textures, Least Recently Accessed First --
+		std::vector<std::pair<uint64_t, std::string>> unused_textures;
+		for (const auto& texture : m_TexturesResources)
+			if (texture.second.Texture.use_count() == 1)
+				unused_textures.push_back({ texture.second.LastAccess, texture.first });
+
+		std::sort(unused_textures.begin(), unused_textures.end());
+
+		// -- Evict them until under Budget --
+		for (const std::pair<uint64_t, std::string>& texture : unused_textures)
+		{
+			if (!all && m_TextureCacheStats.ResidentBytes <= m_TexturesMemoryBudget)
+				break;
+
+			m_TextureCacheStats.ResidentBytes -= m_TexturesResources[texture.second].Texture->GetMemorySize();
+			m_TexturesResources.erase(texture.second);
+			++m_TextureCacheStats.Evictions;
+		}
+
+		m_TextureCacheStats.TexturesCount = (uint)m_TexturesResources.size();
+	}
+
+
+	uint ResourceManager::GetTextureResourceReferences(const std::string& filepath)
+	{
+		auto& it = m_TexturesResources.find(GetTextureKey(filepath));
+		if (it != m_TexturesResources.end())
+			return it->second.Texture.use_count();
+
+		return 0;
+	}
+
+
+
 	// ----------------------- Public Resources Serialization Methods -------------------------------------
 	void ResourceManager::SerializeResources()
 	{
 		KS_PROFILE_FUNCTION();
 		KS_TRACE("Serializing Kaimos Resources");
 
-		// -- Begin Serialization Map --
-		YAML::Emitter output;
+		// -- Begin Serialization Map (written into a temporary file as it goes, replacing the save file at the end) --
+		std::string filepath = INTERNAL_SETTINGS_PATH + std::string("KaimosResources.kaimossave");
+		std::ofstream file(GetYAMLTempFilepath(filepath), std::ios::trunc);
+
+		YAML::Emitter output(file);
 		output << YAML::BeginMap;
 		output << YAML::Key << "KaimosSaveFile" << YAML::Value << "KaimosResources";
 
@@ -189,10 +406,8 @@ namespace Kaimos::Resources {
 		output << YAML::EndSeq;
 		output << YAML::EndMap;
 
-		// -- Save File --
-		std::string filepath = INTERNAL_SETTINGS_PATH + std::string("KaimosResources.kaimossave");
-		std::ofstream file(filepath.c_str());
-		file << output.c_str();
+		if (!CommitYAMLFile(file, filepath, output.good()))
+			KS_ERROR("Couldn't write '{0}' file", filepath);
 	}
 
 
@@ -213,7 +428,26 @@ namespace Kaimos::Resources {
 			return;
 		}
 
-		try { data = YAML::LoadFile(filename); }
+		// -- Models Setup (as the file is parsed, without keeping the previous models nodes) --
+		auto on_model = [](const YAML::Node& model_subnode, const YAML::Node& root)
+		{
+			if (!root["KaimosSaveFile"] || !model_subnode["Model"])
+				return;
+
+			uint model_id = model_subnode["Model"].as<uint>();
+			const std::string model_path = model_subnode["Path"].as<std::string>();
+
+			if (m_ModelResources.find(model_path) == m_ModelResources.end())
+			{
+				if (model_subnode["RootMesh"])
+				{
+					Ref<Mesh> root_mesh = DeserializeMesh(model_subnode["RootMesh"]);
+					DeserializeModel(model_path, model_id, root_mesh);
+				}
+			}
+		};
+
+		try { data = LoadYAMLFileStreamed(filename, "Models", on_model); }
 		catch (const YAML::ParserException& exception)
 		{
 			KS_ERROR("Error Deserializing Resources\nError: {0}", exception.what());
@@ -225,30 +459,6 @@ namespace Kaimos::Resources {
 			KS_ERROR("Error Deserializing Resources\nError: Wrong File (no 'KaimosSaveFile' node within save file)");
 			return;
 		}
-
-		// -- Setup --
-		YAML::Node models_node = data["Models"];
-
-		if (models_node)
-		{
-			for (auto model_subnode : models_node)
-			{
-				if (model_subnode["Model"])
-				{
-					uint model_id = model_subnode["Model"].as<uint>();
-					const std::string model_path = model_subnode["Path"].as<std::string>();
-
-					if (m_ModelResources.find(model_path) == m_ModelResources.end())
-					{
-						if (model_subnode["RootMesh"])
-						{
-							Ref<Mesh> root_mesh = DeserializeMesh(model_subnode["RootMesh"]);
-							DeserializeModel(model_path, model_id, root_mesh);
-						}
-					}
-				}
-			}
-		}
 	}
 
 
@@ -314,4 +524,19 @@ namespace Kaimos::Resources {
 		else
 			KS_ERROR("Error Deserializing model: Cannot load an out-of-project resource, try moving it inside 'assets/' folder.\nCurrent Filepath: {0}", model_path);
 	}
+
+
+
+	// ----------------------- Private Texture Cache Methods ----------------------------------------------
+	const std::string ResourceManager::GetTextureKey(const std::string& filepath)
+	{
+		// -- Project-Relative, Normalized & Lowercase (Windows paths aren't case-sensitive) --
+		size_t project_pos = filepath.find("assets");
+		if (project_pos == std::string::npos)
+			project_pos = filepath.find("internal");
+
+		std::string key = std::filesystem::path(project_pos != std::string::npos ? filepath.substr(project_pos) : filepath).lexically_normal().generic_string();
+		std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+		return key;
+	}
 }
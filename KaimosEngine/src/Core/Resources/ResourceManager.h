@@ -1,8 +1,10 @@
 #ifndef _RESOURCEMANAGER_H_
 #define _RESOURCEMANAGER_H_
 
+#include "ModelImport.h"
+
 namespace YAML { class Emitter; class Node; }
-namespace Kaimos { class Mesh; }
+namespace Kaimos { class Mesh; class Texture2D; }
 
 namespace Kaimos::Resources {
 
@@ -11,6 +13,14 @@ namespace Kaimos::Resources {
 	{
 	public:
 
+		// --- Texture Cache Stats ---
+		struct TextureCacheStats
+		{
+			uint Hits = 0, Misses = 0, Evictions = 0;
+			uint TexturesCount = 0;
+			uint64_t ResidentBytes = 0;
+		};
+
 		// --- Public Class Methods ---
 		static void CleanUp();
 
@@ -25,6 +35,11 @@ namespace Kaimos::Resources {
 		static Ref<ResourceModel> CreateModel(const std::string& filepath);
 		static bool ModelExists(uint model_id);
 
+		// Imports the model in worker threads, it's published (added to resources) in UpdateImports() once finished
+		static Ref<ModelImport> CreateModelAsync(const std::string& filepath);
+		static void UpdateImports();
+		static uint GetPendingImportsCount() { return (uint)m_PendingImports.size(); }
+
 		static void AddMesh(const Ref<Mesh>& mesh);
 		static bool MeshExists(uint mesh_id);		
 
@@ -36,6 +51,19 @@ namespace Kaimos::Resources {
 		static uint GetModelResourceReferences(uint resource_id);
 		static uint GetMeshResourceReferences(uint resource_id);
 
+		// --- Texture Cache ---
+		// Textures are shared by (normalized) asset path, the unreferenced ones are evicted when over the memory budget
+		static Ref<Texture2D> GetTexture(const std::string& filepath);		// Loads it if not cached, nullptr if it couldn't be loaded
+		static Ref<Texture2D> FindTexture(const std::string& filepath);		// nullptr if not cached
+		static bool IsTextureCached(const std::string& filepath);			// Doesn't count as a cache access
+		static Ref<Texture2D> AddTexture(const Ref<Texture2D>& texture);	// Returns the cached one if there was one already (kept)
+		static void EvictUnusedTextures(bool all = false);					// Only until under the budget if not all
+
+		static uint GetTextureResourceReferences(const std::string& filepath);
+		static const TextureCacheStats& GetTextureCacheStats()	{ return m_TextureCacheStats; }
+		static uint64_t GetTexturesMemoryBudget()				{ return m_TexturesMemoryBudget; }
+		static void SetTexturesMemoryBudget(uint64_t bytes)		{ m_TexturesMemoryBudget = bytes; EvictUnusedTextures(); }
+
 		// --- Public Resources Serialization Methods ---
 		static void SerializeResources();
 		static void DeserializeResources();
@@ -47,11 +75,26 @@ namespace Kaimos::Resources {
 		static const Ref<Mesh> DeserializeMesh(YAML::Node& yaml_node);
 		static void DeserializeModel(const std::string& model_path, uint model_id, Ref<Mesh>& root_mesh);
 
+		// --- Private Texture Cache Methods ---
+		static const std::string GetTextureKey(const std::string& filepath);
+
 	private:
 
 		// --- Stored Resources ---
 		static std::unordered_map<std::string, Ref<ResourceModel>> m_ModelResources;
 		static std::unordered_map<uint, Ref<Mesh>> m_MeshesResources;
+		static std::vector<Ref<ModelImport>> m_PendingImports;
+
+		// --- Texture Cache ---
+		struct CachedTexture
+		{
+			Ref<Texture2D> Texture = nullptr;
+			uint64_t LastAccess = 0;
+		};
+
+		static std::unordered_map<std::string, CachedTexture> m_TexturesResources;
+		static TextureCacheStats m_TextureCacheStats;
+		static uint64_t m_TexturesMemoryBudget, m_TexturesAccessCount;
 	};
 }
 
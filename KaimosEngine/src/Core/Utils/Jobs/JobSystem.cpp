@@ -0,0 +1,206 @@
+#include "kspch.h"
+#include "JobSystem.h"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+
+
+namespace Kaimos {
+
+	// ----------------------- Globals --------------------------------------------------------------------
+	struct JobSystemData
+	{
+		std::vector<std::thread> Workers;
+		std::deque<std::function<void()>> JobsQueue, BackgroundQueue;
+
+		std::mutex QueueMutex;
+		std::condition_variable WakeCondition, IdleCondition;
+
+		std::atomic<uint> PendingJobs = { 0 };
+		bool Running = false;
+	};
+
+	static JobSystemData* s_JobsData = nullptr;
+
+
+
+	// ----------------------- Public Class Methods -------------------------------------------------------
+	void JobSystem::Init(uint workers_count)
+	{
+		KS_PROFILE_FUNCTION();
+		if (s_JobsData)
+			return;
+
+		if (workers_count == 0)
+		{
+			uint hardware_threads = std::thread::hardware_concurrency();
+			workers_count = hardware_threads > 1 ? hardware_threads - 1 : 1;
+		}
+
+		s_JobsData = new JobSystemData();
+		s_JobsData->Running = true;
+
+		s_JobsData->Workers.reserve(workers_count);
+		for (uint i = 0; i < workers_count; ++i)
+			s_JobsData->Workers.emplace_back(&JobSystem::WorkerLoop);
+
+		KS_ENGINE_INFO("Job System initialized with {0} workers", workers_count);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		KS_PROFILE_FUNCTION();
+		if (!s_JobsData)
+			return;
+
+		Wait();
+		{
+			std::lock_guard<std::mutex> lock(s_JobsData->QueueMutex);
+			s_JobsData->Running = false;
+		}
+
+		s_JobsData->WakeCondition.notify_all();
+		for (std::thread& worker : s_JobsData->Workers)
+			worker.join();
+
+		delete s_JobsData;
+		s_JobsData = nullptr;
+	}
+
+
+
+	// ----------------------- Public Jobs Methods --------------------------------------------------------
+	void JobSystem::Execute(const std::function<void()>& job)
+	{
+		// -- Without workers, jobs run right away --
+		if (!s_JobsData)
+		{
+			job();
+			return;
+		}
+
+		++s_JobsData->PendingJobs;
+		{
+			std::lock_guard<std::mutex> lock(s_JobsData->QueueMutex);
+			s_JobsData->JobsQueue.push_back(job);
+		}
+
+		s_JobsData->WakeCondition.notify_one();
+	}
+
+	void JobSystem::ExecuteBackground(const std::function<void()>& job)
+	{
+		if (!s_JobsData)
+		{
+			job();
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(s_JobsData->QueueMutex);
+			s_JobsData->BackgroundQueue.push_back(job);
+		}
+
+		s_JobsData->WakeCondition.notify_one();
+	}
+
+	void JobSystem::Dispatch(uint jobs_count, uint group_size, const std::function<void(uint)>& job)
+	{
+		if (jobs_count == 0 || group_size == 0)
+			return;
+
+		for (uint group_start = 0; group_start < jobs_count; group_start += group_size)
+		{
+			uint group_end = std::min(group_start + group_size, jobs_count);
+			Execute([job, group_start, group_end]()
+				{
+					for (uint i = group_start; i < group_end; ++i)
+						job(i);
+				});
+		}
+	}
+
+	void JobSystem::Wait()
+	{
+		KS_PROFILE_FUNCTION();
+		if (!s_JobsData)
+			return;
+
+		// -- Help with the Queue, then Wait for the Jobs being run by Workers --
+		while (RunNextJob(false));
+
+		std::unique_lock<std::mutex> lock(s_JobsData->QueueMutex);
+		s_JobsData->IdleCondition.wait(lock, []() { return s_JobsData->PendingJobs == 0; });
+	}
+
+
+
+	// ----------------------- Getters --------------------------------------------------------------------
+	bool JobSystem::IsBusy()
+	{
+		return s_JobsData && s_JobsData->PendingJobs > 0;
+	}
+
+	uint JobSystem::GetWorkersCount()
+	{
+		return s_JobsData ? (uint)s_JobsData->Workers.size() : 0;
+	}
+
+
+
+	// ----------------------- Private Jobs Methods -------------------------------------------------------
+	void JobSystem::WorkerLoop()
+	{
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(s_JobsData->QueueMutex);
+				s_JobsData->WakeCondition.wait(lock, []() { return !s_JobsData->Running || !s_JobsData->JobsQueue.empty() || !s_JobsData->BackgroundQueue.empty(); });
+
+				if (!s_JobsData->Running && s_JobsData->JobsQueue.empty() && s_JobsData->BackgroundQueue.empty())
+					return;
+			}
+
+			RunNextJob(true);
+		}
+	}
+
+	bool JobSystem::RunNextJob(bool background_allowed)
+	{
+		// -- Pop a Job (frame ones first) --
+		std::function<void()> job;
+		bool background = false;
+		{
+			std::lock_guard<std::mutex> lock(s_JobsData->QueueMutex);
+			if (!s_JobsData->JobsQueue.empty())
+			{
+				job = std::move(s_JobsData->JobsQueue.front());
+				s_JobsData->JobsQueue.pop_front();
+			}
+			else if (background_allowed && !s_JobsData->BackgroundQueue.empty())
+			{
+				job = std::move(s_JobsData->BackgroundQueue.front());
+				s_JobsData->BackgroundQueue.pop_front();
+				background = true;
+			}
+			else
+				return false;
+		}
+
+		// -- Run it & Notify if it was the last one --
+		job();
+		if (background)
+			return true;
+
+		if (--s_JobsData->PendingJobs == 0)
+		{
+			std::lock_guard<std::mutex> lock(s_JobsData->QueueMutex);
+			s_JobsData->IdleCondition.notify_all();
+		}
+
+		return true;
+	}
+}
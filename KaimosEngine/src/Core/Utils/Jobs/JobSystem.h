@@ -0,0 +1,39 @@
+#ifndef _JOBSYSTEM_H_
+#define _JOBSYSTEM_H_
+
+#include "Core/Core.h"
+
+namespace Kaimos {
+
+	// Pool of worker threads running the jobs pushed from the main thread
+	// Jobs can't push other jobs nor wait, and Wait() makes the calling thread help with the pending jobs
+	// Background jobs (long ones, like file imports) are only picked by idle workers and Wait() doesn't wait for them
+	class JobSystem
+	{
+	public:
+
+		// --- Public Class Methods ---
+		static void Init(uint workers_count = 0);	// 0 workers = hardware threads - 1
+		static void Shutdown();
+
+		// --- Public Jobs Methods ---
+		static void Execute(const std::function<void()>& job);
+		static void ExecuteBackground(const std::function<void()>& job);
+
+		// Calls job(index) for each index in [0, jobs_count), grouping group_size indices per job
+		static void Dispatch(uint jobs_count, uint group_size, const std::function<void(uint)>& job);
+		static void Wait();
+
+		// --- Getters ---
+		static bool IsBusy();
+		static uint GetWorkersCount();
+
+	private:
+
+		// --- Private Jobs Methods ---
+		static void WorkerLoop();
+		static bool RunNextJob(bool background_allowed);
+	};
+}
+
+#endif //_JOBSYSTEM_H_
@@ -0,0 +1,147 @@
+#include "kspch.h"
+#include "BoundingVolumes.h"
+
+
+namespace Kaimos::Maths {
+
+	// ----------------------- AABB -----------------------------------------------------------------------
+	AABB AABB::Transform(const glm::mat4& transform) const
+	{
+		if (!IsValid())
+			return *this;
+
+		// -- Transform Center & Project Extents on the Transform Axes (Arvo's method) --
+		glm::vec3 center = glm::vec3(transform * glm::vec4(GetCenter(), 1.0f));
+		glm::vec3 extents = GetExtents();
+
+		glm::mat3 abs_transform = glm::mat3(transform);
+		for (uint i = 0; i < 3; ++i)
+			abs_transform[i] = glm::abs(abs_transform[i]);
+
+		glm::vec3 world_extents = abs_transform * extents;
+		return { center - world_extents, center + world_extents };
+	}
+
+
+
+	// ----------------------- Ray ------------------------------------------------------------------------
+	bool Ray::IntersectsAABB(const AABB& aabb, float& distance) const
+	{
+		if (!aabb.IsValid())
+			return false;
+
+		// -- Slabs Test (divisions by 0 give infinites, which work fine here) --
+		glm::vec3 inv_direction = 1.0f / Direction;
+		glm::vec3 t1 = (aabb.Min - Origin) * inv_direction;
+		glm::vec3 t2 = (aabb.Max - Origin) * inv_direction;
+
+		glm::vec3 t_min = glm::min(t1, t2), t_max = glm::max(t1, t2);
+		float t_enter = glm::max(glm::max(t_min.x, t_min.y), glm::max(t_min.z, 0.0f));
+		float t_exit = glm::min(glm::min(t_max.x, t_max.y), t_max.z);
+
+		if (t_enter > t_exit)
+			return false;
+
+		distance = t_enter;
+		return true;
+	}
+
+
+	bool Ray::IntersectsTriangle(const glm::vec3& v0, const glm::vec3& v1, const glm::vec3& v2, float& distance) const
+	{
+		// -- Moller-Trumbore (both triangle faces are hit) --
+		glm::vec3 edge1 = v1 - v0, edge2 = v2 - v0;
+		glm::vec3 p = glm::cross(Direction, edge2);
+		float det = glm::dot(edge1, p);
+		if (glm::abs(det) < 1e-8f)
+			return false;
+
+		float inv_det = 1.0f / det;
+		glm::vec3 s = Origin - v0;
+		float u = glm::dot(s, p) * inv_det;
+		if (u < 0.0f || u > 1.0f)
+			return false;
+
+		glm::vec3 q = glm::cross(s, edge1);
+		float v = glm::dot(Direction, q) * inv_det;
+		if (v < 0.0f || u + v > 1.0f)
+			return false;
+
+		float t = glm::dot(edge2, q) * inv_det;
+		if (t < 0.0f)
+			return false;
+
+		distance = t;
+		return true;
+	}
+
+
+
+	// ----------------------- Frustum --------------------------------------------------------------------
+	Frustum::Frustum(const glm::mat4& view_projection)
+	{
+		// -- Gribb-Hartmann Planes Extraction (glm matrices are column-major, so rows are taken across columns) --
+		glm::vec4 row0 = glm::vec4(view_projection[0][0], view_projection[1][0], view_projection[2][0], view_projection[3][0]);
+		glm::vec4 row1 = glm::vec4(view_projection[0][1], view_projection[1][1], view_projection[2][1], view_projection[3][1]);
+		glm::vec4 row2 = glm::vec4(view_projection[0][2], view_projection[1][2], view_projection[2][2], view_projection[3][2]);
+		glm::vec4 row3 = glm::vec4(view_projection[0][3], view_projection[1][3], view_projection[2][3], view_projection[3][3]);
+
+		m_Planes[0] = row3 + row0;		// Left
+		m_Planes[1] = row3 - row0;		// Right
+		m_Planes[2] = row3 + row1;		// Bottom
+		m_Planes[3] = row3 - row1;		// Top
+		m_Planes[4] = row3 + row2;		// Near
+		m_Planes[5] = row3 - row2;		// Far
+
+		// -- Normalize, so that plane distances are actual distances (needed for spheres) --
+		for (glm::vec4& plane : m_Planes)
+		{
+			float length = glm::length(glm::vec3(plane));
+			if (length > 0.0f)
+				plane /= length;
+		}
+	}
+
+
+	bool Frustum::IsSphereVisible(const BoundingSphere& sphere, const glm::mat4& transform) const
+	{
+		if (!sphere.IsValid())
+			return true;
+
+		// -- Transform Sphere (the radius scales with the biggest axis scale) --
+		glm::vec3 center = glm::vec3(transform * glm::vec4(sphere.Center, 1.0f));
+		float max_scale = glm::max(glm::length(glm::vec3(transform[0])), glm::max(glm::length(glm::vec3(transform[1])), glm::length(glm::vec3(transform[2]))));
+		float radius = sphere.Radius * max_scale;
+
+		for (const glm::vec4& plane : m_Planes)
+			if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+				return false;
+
+		return true;
+	}
+
+
+	bool Frustum::IsAABBVisible(const AABB& aabb, const glm::mat4& transform) const
+	{
+		return IsAABBVisible(aabb.Transform(transform));
+	}
+
+
+	bool Frustum::IsAABBVisible(const AABB& aabb) const
+	{
+		if (!aabb.IsValid())
+			return true;
+
+		// -- Test the AABB against each Plane with its projected radius --
+		glm::vec3 center = aabb.GetCenter(), extents = aabb.GetExtents();
+
+		for (const glm::vec4& plane : m_Planes)
+		{
+			float radius = glm::dot(glm::abs(glm::vec3(plane)), extents);
+			if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+				return false;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,91 @@
+#ifndef _BOUNDINGVOLUMES_H_
+#define _BOUNDINGVOLUMES_H_
+
+#include <glm/glm.hpp>
+#include <cfloat>
+
+namespace Kaimos::Maths
+{
+	// ---- AABB ----
+	// Axis-Aligned Bounding Box, invalid (Min > Max) until something is enclosed in it
+	struct AABB
+	{
+		glm::vec3 Min = glm::vec3(FLT_MAX);
+		glm::vec3 Max = glm::vec3(-FLT_MAX);
+
+		bool IsValid()					const { return Min.x <= Max.x && Min.y <= Max.y && Min.z <= Max.z; }
+		glm::vec3 GetCenter()			const { return (Min + Max) * 0.5f; }
+		glm::vec3 GetExtents()			const { return (Max - Min) * 0.5f; }
+
+		float GetSurfaceArea() const
+		{
+			glm::vec3 size = Max - Min;
+			return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+		}
+
+		bool Contains(const AABB& aabb)	const { return glm::all(glm::lessThanEqual(Min, aabb.Min)) && glm::all(glm::greaterThanEqual(Max, aabb.Max)); }
+
+		void Enclose(const glm::vec3& point)	{ Min = glm::min(Min, point); Max = glm::max(Max, point); }
+		void Enclose(const AABB& aabb)			{ if (aabb.IsValid()) { Enclose(aabb.Min); Enclose(aabb.Max); } }
+
+		static AABB Combine(const AABB& a, const AABB& b)	{ return { glm::min(a.Min, b.Min), glm::max(a.Max, b.Max) }; }
+
+		// Returns the AABB enclosing this one once transformed (in world space, for instance)
+		AABB Transform(const glm::mat4& transform) const;
+	};
+
+
+	// ---- Bounding Sphere ----
+	struct BoundingSphere
+	{
+		glm::vec3 Center = glm::vec3(0.0f);
+		float Radius = -1.0f;
+
+		bool IsValid()					const { return Radius >= 0.0f; }
+
+		// Grows the radius (not moving the center) to enclose the point, so centered on an AABB, it gives a good enough sphere
+		void Enclose(const glm::vec3& point)	{ Radius = glm::max(Radius, glm::length(point - Center)); }
+
+		bool IntersectsAABB(const AABB& aabb) const
+		{
+			glm::vec3 closest_point_dist = glm::clamp(Center, aabb.Min, aabb.Max) - Center;
+			return glm::dot(closest_point_dist, closest_point_dist) <= Radius * Radius;
+		}
+	};
+
+
+	// ---- Ray ----
+	struct Ray
+	{
+		glm::vec3 Origin = glm::vec3(0.0f);
+		glm::vec3 Direction = glm::vec3(0.0f, 0.0f, -1.0f);
+
+		// Distances are in Direction lengths, so world units if it's normalized
+		// For AABBs, it's the one to the entry point (0 if the origin is inside)
+		bool IntersectsAABB(const AABB& aabb, float& distance) const;
+		bool IntersectsTriangle(const glm::vec3& v0, const glm::vec3& v1, const glm::vec3& v2, float& distance) const;
+	};
+
+
+	// ---- Frustum ----
+	// Camera frustum planes (pointing inwards), extracted from a View-Projection matrix
+	class Frustum
+	{
+	public:
+
+		Frustum() = default;
+		Frustum(const glm::mat4& view_projection);
+
+		bool IsAABBVisible(const AABB& aabb) const;
+
+		// Volumes in local space are tested after being transformed by the given transform
+		bool IsSphereVisible(const BoundingSphere& sphere, const glm::mat4& transform) const;
+		bool IsAABBVisible(const AABB& aabb, const glm::mat4& transform) const;
+
+	private:
+
+		glm::vec4 m_Planes[6];
+	};
+}
+
+#endif //_BOUNDINGVOLUMES_H_
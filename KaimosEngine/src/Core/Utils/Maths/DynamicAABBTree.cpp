@@ -0,0 +1,287 @@
+#include "kspch.h"
+#include "DynamicAABBTree.h"
+
+
+namespace Kaimos::Maths {
+
+	// ----------------------- Public Tree Methods --------------------------------------------------------
+	int DynamicAABBTree::CreateProxy(const AABB& aabb, uint user_data)
+	{
+		int proxy_id = AllocateNode();
+		TreeNode& node = m_Nodes[proxy_id];
+
+		node.Box = { aabb.Min - glm::vec3(s_FatMargin), aabb.Max + glm::vec3(s_FatMargin) };
+		node.UserData = user_data;
+		node.Height = 0;
+
+		InsertLeaf(proxy_id);
+		++m_ProxiesCount;
+		return proxy_id;
+	}
+
+
+	void DynamicAABBTree::DestroyProxy(int proxy_id)
+	{
+		if (proxy_id < 0 || proxy_id >= (int)m_Nodes.size() || !m_Nodes[proxy_id].IsLeaf() || m_Nodes[proxy_id].Height != 0)
+		{
+			KS_ERROR("Tried to destroy an invalid AABB Tree proxy ({0})", proxy_id);
+			return;
+		}
+
+		RemoveLeaf(proxy_id);
+		FreeNode(proxy_id);
+		--m_ProxiesCount;
+	}
+
+
+	bool DynamicAABBTree::MoveProxy(int proxy_id, const AABB& aabb)
+	{
+		// -- Still inside its Fattened AABB --
+		if (m_Nodes[proxy_id].Box.Contains(aabb))
+			return false;
+
+		// -- Reinsert with the new Fattened AABB --
+		RemoveLeaf(proxy_id);
+		m_Nodes[proxy_id].Box = { aabb.Min - glm::vec3(s_FatMargin), aabb.Max + glm::vec3(s_FatMargin) };
+		InsertLeaf(proxy_id);
+		return true;
+	}
+
+
+	void DynamicAABBTree::Clear()
+	{
+		m_Nodes.clear();
+		m_Root = m_FreeList = s_NullNode;
+		m_ProxiesCount = 0;
+	}
+
+
+
+	// ----------------------- Private Tree Methods -------------------------------------------------------
+	int DynamicAABBTree::AllocateNode()
+	{
+		// -- Reuse a Free Node or Add a New One --
+		int node_id = m_FreeList;
+		if (node_id != s_NullNode)
+			m_FreeList = m_Nodes[node_id].Parent;
+		else
+		{
+			node_id = (int)m_Nodes.size();
+			m_Nodes.emplace_back();
+		}
+
+		m_Nodes[node_id] = TreeNode();
+		return node_id;
+	}
+
+
+	void DynamicAABBTree::FreeNode(int node_id)
+	{
+		m_Nodes[node_id].Parent = m_FreeList;
+		m_Nodes[node_id].Height = -1;
+		m_FreeList = node_id;
+	}
+
+
+	void DynamicAABBTree::InsertLeaf(int leaf_id)
+	{
+		if (m_Root == s_NullNode)
+		{
+			m_Root = leaf_id;
+			m_Nodes[m_Root].Parent = s_NullNode;
+			return;
+		}
+
+		// -- Find the Best Sibling (Surface Area Heuristic) --
+		AABB leaf_aabb = m_Nodes[leaf_id].Box;
+		int index = m_Root;
+
+		while (!m_Nodes[index].IsLeaf())
+		{
+			const TreeNode& node = m_Nodes[index];
+			float area = node.Box.GetSurfaceArea();
+			float combined_area = AABB::Combine(node.Box, leaf_aabb).GetSurfaceArea();
+
+			// Cost of making a new parent for this node and the leaf, and minimum cost of pushing the leaf further down
+			float cost = 2.0f * combined_area;
+			float inheritance_cost = 2.0f * (combined_area - area);
+
+			float child_costs[2];
+			int children[2] = { node.Child1, node.Child2 };
+			for (uint i = 0; i < 2; ++i)
+			{
+				const TreeNode& child = m_Nodes[children[i]];
+				float child_combined_area = AABB::Combine(child.Box, leaf_aabb).GetSurfaceArea();
+				child_costs[i] = (child.IsLeaf() ? child_combined_area : child_combined_area - child.Box.GetSurfaceArea()) + inheritance_cost;
+			}
+
+			if (cost < child_costs[0] && cost < child_costs[1])
+				break;
+
+			index = child_costs[0] < child_costs[1] ? children[0] : children[1];
+		}
+
+		// -- Create a New Parent for the Sibling & the Leaf (allocating may move the nodes, so indices are used) --
+		int sibling = index;
+		int old_parent = m_Nodes[sibling].Parent;
+		int new_parent = AllocateNode();
+
+		m_Nodes[new_parent].Parent = old_parent;
+		m_Nodes[new_parent].Box = AABB::Combine(leaf_aabb, m_Nodes[sibling].Box);
+		m_Nodes[new_parent].Height = m_Nodes[sibling].Height + 1;
+		m_Nodes[new_parent].Child1 = sibling;
+		m_Nodes[new_parent].Child2 = leaf_id;
+
+		if (old_parent != s_NullNode)
+		{
+			if (m_Nodes[old_parent].Child1 == sibling)
+				m_Nodes[old_parent].Child1 = new_parent;
+			else
+				m_Nodes[old_parent].Child2 = new_parent;
+		}
+		else
+			m_Root = new_parent;
+
+		m_Nodes[sibling].Parent = new_parent;
+		m_Nodes[leaf_id].Parent = new_parent;
+
+		// -- Fix the Ancestors --
+		RefitAncestors(new_parent);
+	}
+
+
+	void DynamicAABBTree::RemoveLeaf(int leaf_id)
+	{
+		if (leaf_id == m_Root)
+		{
+			m_Root = s_NullNode;
+			return;
+		}
+
+		// -- Replace the Parent by the Sibling --
+		int parent = m_Nodes[leaf_id].Parent;
+		int grand_parent = m_Nodes[parent].Parent;
+		int sibling = m_Nodes[parent].Child1 == leaf_id ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+		m_Nodes[sibling].Parent = grand_parent;
+		FreeNode(parent);
+
+		if (grand_parent == s_NullNode)
+		{
+			m_Root = sibling;
+			return;
+		}
+
+		if (m_Nodes[grand_parent].Child1 == parent)
+			m_Nodes[grand_parent].Child1 = sibling;
+		else
+			m_Nodes[grand_parent].Child2 = sibling;
+
+		// -- Fix the Ancestors --
+		RefitAncestors(grand_parent);
+	}
+
+
+	void DynamicAABBTree::RefitAncestors(int node_id)
+	{
+		int index = node_id;
+		while (index != s_NullNode)
+		{
+			index = Balance(index);
+
+			TreeNode& node = m_Nodes[index];
+			const TreeNode& child1 = m_Nodes[node.Child1];
+			const TreeNode& child2 = m_Nodes[node.Child2];
+
+			node.Height = 1 + glm::max(child1.Height, child2.Height);
+			node.Box = AABB::Combine(child1.Box, child2.Box);
+			index = node.Parent;
+		}
+	}
+
+
+	int DynamicAABBTree::Balance(int node_id)
+	{
+		// Rotates the highest grandchild up if the node is unbalanced, returns the node that takes its place
+		TreeNode& a = m_Nodes[node_id];
+		if (a.IsLeaf() || a.Height < 2)
+			return node_id;
+
+		int ib = a.Child1, ic = a.Child2;
+		TreeNode& b = m_Nodes[ib];
+		TreeNode& c = m_Nodes[ic];
+		int balance = c.Height - b.Height;
+
+		if (balance > 1)
+		{
+			// -- Rotate C up --
+			int i_f = c.Child1, i_g = c.Child2;
+			TreeNode& f = m_Nodes[i_f];
+			TreeNode& g = m_Nodes[i_g];
+
+			c.Child1 = node_id;
+			c.Parent = a.Parent;
+			a.Parent = ic;
+
+			if (c.Parent != s_NullNode)
+			{
+				if (m_Nodes[c.Parent].Child1 == node_id)
+					m_Nodes[c.Parent].Child1 = ic;
+				else
+					m_Nodes[c.Parent].Child2 = ic;
+			}
+			else
+				m_Root = ic;
+
+			// Highest of C's children stays with C, the other goes to A
+			TreeNode& kept = f.Height > g.Height ? f : g;
+			TreeNode& moved = f.Height > g.Height ? g : f;
+			c.Child2 = f.Height > g.Height ? i_f : i_g;
+			a.Child2 = f.Height > g.Height ? i_g : i_f;
+			moved.Parent = node_id;
+
+			a.Box = AABB::Combine(b.Box, moved.Box);
+			c.Box = AABB::Combine(a.Box, kept.Box);
+			a.Height = 1 + glm::max(b.Height, moved.Height);
+			c.Height = 1 + glm::max(a.Height, kept.Height);
+			return ic;
+		}
+
+		if (balance < -1)
+		{
+			// -- Rotate B up --
+			int i_d = b.Child1, i_e = b.Child2;
+			TreeNode& d = m_Nodes[i_d];
+			TreeNode& e = m_Nodes[i_e];
+
+			b.Child1 = node_id;
+			b.Parent = a.Parent;
+			a.Parent = ib;
+
+			if (b.Parent != s_NullNode)
+			{
+				if (m_Nodes[b.Parent].Child1 == node_id)
+					m_Nodes[b.Parent].Child1 = ib;
+				else
+					m_Nodes[b.Parent].Child2 = ib;
+			}
+			else
+				m_Root = ib;
+
+			// Highest of B's children stays with B, the other goes to A
+			TreeNode& kept = d.Height > e.Height ? d : e;
+			TreeNode& moved = d.Height > e.Height ? e : d;
+			b.Child2 = d.Height > e.Height ? i_d : i_e;
+			a.Child1 = d.Height > e.Height ? i_e : i_d;
+			moved.Parent = node_id;
+
+			a.Box = AABB::Combine(c.Box, moved.Box);
+			b.Box = AABB::Combine(a.Box, kept.Box);
+			a.Height = 1 + glm::max(c.Height, moved.Height);
+			b.Height = 1 + glm::max(a.Height, kept.Height);
+			return ib;
+		}
+
+		return node_id;
+	}
+}
@@ -0,0 +1,134 @@
+#ifndef _DYNAMICAABBTREE_H_
+#define _DYNAMICAABBTREE_H_
+
+#include "Core/Core.h"
+#include "BoundingVolumes.h"
+
+namespace Kaimos::Maths
+{
+	// Bounding Volume Hierarchy of fattened AABBs (proxies), kept balanced by tree rotations as they are inserted & removed
+	// Moving a proxy only touches the tree when its new AABB leaves the fattened one, so static objects cost nothing
+	// It doesn't depend on anything but the maths, so it can be used (and measured) without a scene or a renderer
+	class DynamicAABBTree
+	{
+	public:
+
+		// --- Public Tree Methods ---
+		int CreateProxy(const AABB& aabb, uint user_data);
+		void DestroyProxy(int proxy_id);
+		bool MoveProxy(int proxy_id, const AABB& aabb);		// Returns true if the proxy had to be reinserted
+		void Clear();
+
+		// --- Queries ---
+		// Calls callback(user_data) for each proxy whose fattened AABB is (partially) inside the frustum/overlaps the AABB
+		template<typename T>
+		void Query(const Frustum& frustum, T callback) const
+		{
+			QueryNodes([&frustum](const AABB& aabb) { return frustum.IsAABBVisible(aabb); }, callback);
+		}
+
+		template<typename T>
+		void Query(const AABB& aabb, T callback) const
+		{
+			QueryNodes([&aabb](const AABB& node_aabb) { return glm::all(glm::lessThanEqual(node_aabb.Min, aabb.Max)) && glm::all(glm::greaterThanEqual(node_aabb.Max, aabb.Min)); }, callback);
+		}
+
+		// Calls callback(user_data, max_distance) for each proxy hit closer than max_distance, in no particular order
+		// The callback returns the new max_distance (its own hit distance to clip the ray, or max_distance to keep it)
+		template<typename T>
+		void RayCast(const Ray& ray, float max_distance, T callback) const
+		{
+			if (m_Root == s_NullNode)
+				return;
+
+			std::vector<int> stack;
+			stack.push_back(m_Root);
+
+			while (!stack.empty())
+			{
+				int node_id = stack.back();
+				stack.pop_back();
+
+				const TreeNode& node = m_Nodes[node_id];
+				float distance = 0.0f;
+				if (!ray.IntersectsAABB(node.Box, distance) || distance > max_distance)
+					continue;
+
+				if (node.IsLeaf())
+					max_distance = callback(node.UserData, max_distance);
+				else
+				{
+					stack.push_back(node.Child1);
+					stack.push_back(node.Child2);
+				}
+			}
+		}
+
+		// --- Getters ---
+		const AABB& GetFatAABB(int proxy_id)	const { return m_Nodes[proxy_id].Box; }
+		uint GetUserData(int proxy_id)			const { return m_Nodes[proxy_id].UserData; }
+		uint GetProxiesCount()					const { return m_ProxiesCount; }
+		int GetHeight()							const { return m_Root == s_NullNode ? 0 : m_Nodes[m_Root].Height; }
+
+	private:
+
+		// --- Tree Node ---
+		struct TreeNode
+		{
+			AABB Box = {};
+			uint UserData = 0;
+			int Parent = s_NullNode;				// Next free node when in the free list
+			int Child1 = s_NullNode, Child2 = s_NullNode;
+			int Height = -1;						// 0 for leaves, -1 for free nodes
+
+			bool IsLeaf() const { return Child1 == s_NullNode; }
+		};
+
+		// --- Private Tree Methods ---
+		int AllocateNode();
+		void FreeNode(int node_id);
+
+		void InsertLeaf(int leaf_id);
+		void RemoveLeaf(int leaf_id);
+		void RefitAncestors(int node_id);
+		int Balance(int node_id);
+
+		template<typename TTest, typename TCallback>
+		void QueryNodes(TTest node_test, TCallback callback) const
+		{
+			if (m_Root == s_NullNode)
+				return;
+
+			std::vector<int> stack;
+			stack.push_back(m_Root);
+
+			while (!stack.empty())
+			{
+				const TreeNode& node = m_Nodes[stack.back()];
+				stack.pop_back();
+
+				if (!node_test(node.Box))
+					continue;
+
+				if (node.IsLeaf())
+					callback(node.UserData);
+				else
+				{
+					stack.push_back(node.Child1);
+					stack.push_back(node.Child2);
+				}
+			}
+		}
+
+	private:
+
+		static constexpr int s_NullNode = -1;
+		static constexpr float s_FatMargin = 0.1f;
+
+		std::vector<TreeNode> m_Nodes;
+		int m_Root = s_NullNode, m_FreeList = s_NullNode;
+		uint m_ProxiesCount = 0;
+	};
+}
+
+#endif //_DYNAMICAABBTREE_H_
@@ -108,5 +108,26 @@ namespace Kaimos::Random
 
 		return ret;
 	}
+
+
+
+	// --- Thread-Safe Random Values ---
+	// The functions above share the RNGData engine, so they can't be called from jobs. These draw from an engine per thread,
+	// with the same values: an un-ranged int or a float between 0 and 1
+	inline std::default_random_engine& GetThreadEngine()
+	{
+		static thread_local std::default_random_engine s_ThreadEngine = std::default_random_engine(std::random_device()());
+		return s_ThreadEngine;
+	}
+
+	inline int GetThreadRandomInt()
+	{
+		return IntDist()(GetThreadEngine());
+	}
+
+	inline float GetThreadRandomFloat()
+	{
+		return (float)DoubleDist()(GetThreadEngine());
+	}
 }
 #endif //_RANDOMGENERATOR_H_
@@ -15,5 +15,31 @@ namespace Kaimos {
 		// If cancelled, returns empty string
 		static std::string SaveFile(const char* filter, const char* filename);
 	};
+
+
+	// Read-only view of a whole file mapped in memory, unmapped when closed or destroyed
+	class MappedFile
+	{
+	public:
+
+		MappedFile() = default;
+		~MappedFile() { Close(); }
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		// Returns false if the file doesn't exist, is empty or couldn't be mapped
+		bool Open(const std::string& filepath);
+		void Close();
+
+		const void* GetData()	const { return m_Data; }
+		size_t GetSize()		const { return m_Size; }
+
+	private:
+
+		const void* m_Data = nullptr;
+		size_t m_Size = 0;
+		void* m_FileHandle = nullptr, *m_MappingHandle = nullptr;
+	};
 }
 #endif //_PLATFORMUTILS_H_
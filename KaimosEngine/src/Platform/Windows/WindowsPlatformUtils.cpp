@@ -80,4 +80,55 @@ namespace Kaimos {
 
 		return std::string();
 	}
+
+
+	bool MappedFile::Open(const std::string& filepath)
+	{
+		Close();
+
+		// -- Open File & Get its Size --
+		HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		// -- Map the Whole File --
+		HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		const void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		if (!data)
+		{
+			if (mapping)
+				CloseHandle(mapping);
+
+			CloseHandle(file);
+			return false;
+		}
+
+		m_FileHandle = file;
+		m_MappingHandle = mapping;
+		m_Data = data;
+		m_Size = (size_t)size.QuadPart;
+		return true;
+	}
+
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+		if (m_MappingHandle)
+			CloseHandle(m_MappingHandle);
+		if (m_FileHandle)
+			CloseHandle(m_FileHandle);
+
+		m_Data = nullptr;
+		m_MappingHandle = m_FileHandle = nullptr;
+		m_Size = 0;
+	}
 }
@@ -53,6 +53,19 @@ namespace Kaimos {
 		CalculateProjectionMatrix();
 	}
 
+	Maths::Ray Camera::ScreenPointToRay(const glm::vec2& point, const glm::vec2& viewport_size) const
+	{
+		// -- Unproject the Point at the Near & Far Planes --
+		glm::vec2 ndc = (point / viewport_size) * 2.0f - 1.0f;
+		glm::mat4 inv_view_proj = glm::inverse(GetViewProjection());
+
+		glm::vec4 near_point = inv_view_proj * glm::vec4(ndc, -1.0f, 1.0f);
+		glm::vec4 far_point = inv_view_proj * glm::vec4(ndc, 1.0f, 1.0f);
+		glm::vec3 origin = glm::vec3(near_point) / near_point.w;
+
+		return { origin, glm::normalize(glm::vec3(far_point) / far_point.w - origin) };
+	}
+
 
 
 	// ----------------------- Private Camera Methods -----------------------------------------------------
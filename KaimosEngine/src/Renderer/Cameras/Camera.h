@@ -1,6 +1,7 @@
 #ifndef _CAMERA_H_
 #define _CAMERA_H_
 
+#include "Core/Utils/Maths/BoundingVolumes.h"
 #include <glm/glm.hpp>
 
 namespace Kaimos {
@@ -22,6 +23,9 @@ namespace Kaimos {
 		void SetOrthographicParameters(float ortho_size = 10.0f, float nclip = -1.0f, float fclip = 1.0f);
 		void SetPerspectiveParameters(float FOV = 45.0f, float nclip = 0.1f, float fclip = 10000.0f);
 
+		// Ray from the near plane through a viewport point (in pixels, from its bottom-left corner)
+		Maths::Ray ScreenPointToRay(const glm::vec2& point, const glm::vec2& viewport_size) const;
+
 	public:
 
 		// --- Getters ---
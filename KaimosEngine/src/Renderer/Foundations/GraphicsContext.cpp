@@ -3,6 +3,7 @@
 
 #include "Renderer/Renderer.h"
 #include "Renderer/OpenGL/OGLContext.h"
+#include "Renderer/Null/NullContext.h"
 
 namespace Kaimos {
 
@@ -12,6 +13,7 @@ namespace Kaimos {
 		{
 			case RendererAPI::API::NONE:	KS_FATAL_ERROR("RendererAPI::NONE is currently not supported!"); return nullptr;
 			case RendererAPI::API::OPENGL:	return CreateScopePtr<OGLContext>(static_cast<GLFWwindow*>(window));
+			case RendererAPI::API::NULL_API:	return CreateScopePtr<NullContext>();
 		}
 
 		KS_FATAL_ERROR("Unknown RendererAPI!");
@@ -12,7 +12,8 @@ namespace Kaimos {
 	public:
 
 		// --- Public Class Methods ---
-		inline static void Init()																		{ s_RendererAPI->Init(); }
+		// The API is created again, in case RendererAPI::SetAPI() changed it after the static initialization
+		inline static void Init()																		{ s_RendererAPI = RendererAPI::Create(); s_RendererAPI->Init(); }
 
 		// --- Public RendererAPI Methods ---
 		inline static void EnableDepth()																{ s_RendererAPI->EnableDepth(); }
@@ -22,9 +23,16 @@ namespace Kaimos {
 		inline static void SetClearColor(const glm::vec4& color)										{ s_RendererAPI->SetClearColor(color); }
 
 		inline static void DrawIndexed(const Ref<VertexArray>& vertex_array, uint index_count = 0)		{ s_RendererAPI->DrawIndexed(vertex_array, index_count); }
+		inline static void DrawIndexedBaseVertex(const Ref<VertexArray>& vertex_array, uint index_count, uint first_index, uint base_vertex)
+																										{ s_RendererAPI->DrawIndexedBaseVertex(vertex_array, index_count, first_index, base_vertex); }
+		inline static void DrawIndexedInstanced(const Ref<VertexArray>& vertex_array, uint index_count, uint instance_count, uint base_instance = 0)
+																										{ s_RendererAPI->DrawIndexedInstanced(vertex_array, index_count, instance_count, base_instance); }
 		inline static void DrawUnindexed(const Ref<VertexArray>& vertex_array, uint count)				{ s_RendererAPI->DrawUnindexed(vertex_array, count); }
 		inline static void SetViewport(uint x, uint y, uint width, uint height)							{ s_RendererAPI->SetViewport(x, y, width, height); }
 
+		// --- Capabilities ---
+		inline static bool SupportsBindlessTextures()													{ return s_RendererAPI->SupportsBindlessTextures(); }
+
 	private:
 
 		static ScopePtr<RendererAPI> s_RendererAPI;
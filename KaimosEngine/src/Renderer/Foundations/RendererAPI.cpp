@@ -2,6 +2,7 @@
 #include "RendererAPI.h"
 
 #include "Renderer/OpenGL/OGLRendererAPI.h"
+#include "Renderer/Null/NullRendererAPI.h"
 
 
 namespace Kaimos {
@@ -14,6 +15,7 @@ namespace Kaimos {
 		{
 			case RendererAPI::API::NONE:	KS_FATAL_ERROR("Renderer::API::NONE is currently NOT supported!"); return nullptr;
 			case RendererAPI::API::OPENGL:	return CreateScopePtr<OGLRendererAPI>();
+			case RendererAPI::API::NULL_API:	return CreateScopePtr<NullRendererAPI>();
 		}
 
 		KS_FATAL_ERROR("Unknown RendererAPI!");
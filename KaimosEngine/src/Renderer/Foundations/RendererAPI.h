@@ -10,7 +10,8 @@ namespace Kaimos {
 	{
 	public:
 
-		enum class API { NONE = 0, OPENGL = 1 };
+		// NULL_API is the headless backend, which only records the commands (to run the CPU side of the renderer without a GPU)
+		enum class API { NONE = 0, OPENGL = 1, NULL_API = 2 };
 
 	public:
 
@@ -27,14 +28,20 @@ namespace Kaimos {
 		virtual void Clear() const = 0;
 		
 		virtual void DrawIndexed(const Ref<VertexArray>& vertex_array, uint index_count = 0) const = 0;
+		virtual void DrawIndexedBaseVertex(const Ref<VertexArray>& vertex_array, uint index_count, uint first_index, uint base_vertex) const = 0;
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertex_array, uint index_count, uint instance_count, uint base_instance = 0) const = 0;
 		virtual void DrawUnindexed(const Ref<VertexArray>& vertex_array, uint count) const = 0;
 		virtual void SetViewport(uint x, uint y, uint width, uint height) = 0;
 
+		// --- Capabilities ---
+		virtual bool SupportsBindlessTextures() const = 0;
+
 
 		static ScopePtr<RendererAPI> Create();
 		
 		// --- Getters ---
 		inline static const API GetAPI() { return s_API; }
+		inline static void SetAPI(API api) { s_API = api; }	// Before initializing the Renderer, and creating any window or resource
 
 	private:
 
@@ -0,0 +1,237 @@
+#include "kspch.h"
+#include "LightClusters.h"
+
+#include "Core/Utils/Jobs/JobSystem.h"
+
+
+namespace Kaimos {
+
+	// ----------------------- Globals --------------------------------------------------------------------
+	static constexpr uint s_LightsPerJob = 256;
+
+	static uint GetClusterGridIndex(uint x, uint y, uint z)
+	{
+		return (z * LightClusters::GridY + y) * LightClusters::GridX + x;
+	}
+
+	// Tile in which a NDC coordinate falls, for a row/column of tiles_count tiles
+	static uint GetTile(float ndc, uint tiles_count)
+	{
+		int tile = (int)glm::floor((ndc * 0.5f + 0.5f) * (float)tiles_count);
+		return (uint)glm::clamp(tile, 0, (int)tiles_count - 1);
+	}
+
+
+
+	// ----------------------- Public Clustering Methods --------------------------------------------------
+	void LightClusters::Build(const glm::mat4& view, const glm::mat4& projection, const std::vector<Maths::BoundingSphere>& lights, uint max_indices)
+	{
+		KS_PROFILE_FUNCTION();
+		SetProjection(projection);
+
+		// -- Without Lights, all Clusters are Empty (no jobs dispatched) --
+		m_LightIndices.clear();
+		m_DroppedIndices = 0;
+		if (lights.empty())
+		{
+			m_Clusters.assign(ClustersCount, {});
+			return;
+		}
+
+		m_LightBounds.resize(lights.size());
+		m_SliceIndices.resize(GridZ);
+		m_Clusters.resize(ClustersCount);
+
+		// -- Light Bounds Calculation & Binning (each slice bins into its own list) --
+		JobSystem::Dispatch((uint)lights.size(), s_LightsPerJob, [&](uint index) { CalculateLightBounds(index, view, lights[index]); });
+		JobSystem::Wait();
+
+		JobSystem::Dispatch(GridZ, 1, [this](uint slice) { BinSlice(slice); });
+		JobSystem::Wait();
+
+		// -- Slices Merging (clusters overflowing max_indices lose their lights) --
+		for (uint z = 0; z < GridZ; ++z)
+		{
+			const std::vector<uint>& slice_indices = m_SliceIndices[z];
+			uint base_offset = (uint)m_LightIndices.size();
+			uint kept_indices = glm::min((uint)slice_indices.size(), max_indices - base_offset);
+
+			m_DroppedIndices += (uint)slice_indices.size() - kept_indices;
+			m_LightIndices.insert(m_LightIndices.end(), slice_indices.begin(), slice_indices.begin() + kept_indices);
+
+			for (uint i = GetClusterGridIndex(0, 0, z); i < GetClusterGridIndex(0, 0, z + 1); ++i)
+			{
+				Cluster& cluster = m_Clusters[i];
+				cluster.Count = cluster.Offset >= kept_indices ? 0 : glm::min(cluster.Count, kept_indices - cluster.Offset);
+				cluster.Offset += base_offset;
+			}
+		}
+
+		if (m_DroppedIndices > 0)
+			KS_ENGINE_WARN("LightClusters: {0} light indices dropped, there are more lights per cluster than the renderer can hold", m_DroppedIndices);
+	}
+
+	uint LightClusters::GetClusterIndex(const glm::vec3& view_position) const
+	{
+		float depth = -view_position.z;
+		if (depth < m_Near || depth > m_Far)
+			return UINT_MAX;
+
+		glm::vec4 clip_position = m_Projection * glm::vec4(view_position, 1.0f);
+		glm::vec2 ndc = glm::vec2(clip_position) / clip_position.w;
+		return GetClusterGridIndex(GetTile(ndc.x, GridX), GetTile(ndc.y, GridY), GetDepthSlice(depth));
+	}
+
+
+
+	// ----------------------- Private Clustering Methods -------------------------------------------------
+	void LightClusters::SetProjection(const glm::mat4& projection)
+	{
+		if (projection == m_Projection && !m_ClusterBounds.empty())
+			return;
+
+		KS_PROFILE_FUNCTION();
+		m_Projection = projection;
+		m_Perspective = projection[3][3] == 0.0f;
+
+		// -- Planes & Slicing from the (OpenGL) Projection Matrix --
+		if (m_Perspective)
+		{
+			m_Near = projection[3][2] / (projection[2][2] - 1.0f);
+			m_Far = projection[3][2] / (projection[2][2] + 1.0f);
+			m_SliceScale = (float)GridZ / glm::log(m_Far / m_Near);
+			m_SliceBias = -m_SliceScale * glm::log(m_Near);
+		}
+		else
+		{
+			m_Near = (projection[3][2] + 1.0f) / projection[2][2];
+			m_Far = (projection[3][2] - 1.0f) / projection[2][2];
+			m_SliceScale = (float)GridZ / (m_Far - m_Near);
+			m_SliceBias = -m_SliceScale * m_Near;
+		}
+
+		// -- Rays through the Tiles Corners (from near to far planes, in view space) --
+		glm::mat4 inverse_projection = glm::inverse(projection);
+		std::vector<std::pair<glm::vec3, glm::vec3>> corner_rays((GridX + 1) * (GridY + 1));
+
+		for (uint y = 0; y <= GridY; ++y)
+		{
+			for (uint x = 0; x <= GridX; ++x)
+			{
+				glm::vec2 ndc = glm::vec2((float)x / (float)GridX, (float)y / (float)GridY) * 2.0f - 1.0f;
+				glm::vec4 near_point = inverse_projection * glm::vec4(ndc, -1.0f, 1.0f);
+				glm::vec4 far_point = inverse_projection * glm::vec4(ndc, 1.0f, 1.0f);
+				corner_rays[y * (GridX + 1) + x] = { glm::vec3(near_point) / near_point.w, glm::vec3(far_point) / far_point.w };
+			}
+		}
+
+		// -- Clusters Bounds (the corner rays cut at the slice depths) --
+		m_ClusterBounds.resize(ClustersCount);
+		for (uint z = 0; z < GridZ; ++z)
+		{
+			float slice_depths[2] = { GetSliceDepth(z), GetSliceDepth(z + 1) };
+			for (uint y = 0; y < GridY; ++y)
+			{
+				for (uint x = 0; x < GridX; ++x)
+				{
+					Maths::AABB& bounds = m_ClusterBounds[GetClusterGridIndex(x, y, z)];
+					bounds = {};
+
+					for (uint corner = 0; corner < 4; ++corner)
+					{
+						const auto& [near_point, far_point] = corner_rays[(y + corner / 2) * (GridX + 1) + x + corner % 2];
+						for (float depth : slice_depths)
+							bounds.Enclose(glm::mix(near_point, far_point, (depth + near_point.z) / (near_point.z - far_point.z)));
+					}
+				}
+			}
+		}
+	}
+
+	float LightClusters::GetSliceDepth(uint slice) const
+	{
+		float slice_factor = (float)slice / (float)GridZ;
+		return m_Perspective ? m_Near * glm::pow(m_Far / m_Near, slice_factor) : m_Near + (m_Far - m_Near) * slice_factor;
+	}
+
+	uint LightClusters::GetDepthSlice(float depth) const
+	{
+		float slice_depth = m_Perspective ? glm::log(glm::max(depth, m_Near)) : depth;
+		int slice = (int)glm::floor(slice_depth * m_SliceScale + m_SliceBias);
+		return (uint)glm::clamp(slice, 0, (int)GridZ - 1);
+	}
+
+
+	void LightClusters::CalculateLightBounds(uint light_index, const glm::mat4& view, const Maths::BoundingSphere& light)
+	{
+		LightBounds& bounds = m_LightBounds[light_index];
+		bounds.ViewSphere = { glm::vec3(view * glm::vec4(light.Center, 1.0f)), light.Radius };
+		bounds.Visible = false;
+
+		const glm::vec3& center = bounds.ViewSphere.Center;
+		float depth = -center.z, radius = light.Radius;
+		if (radius <= 0.0f || depth + radius < m_Near || depth - radius > m_Far)
+			return;
+
+		// -- NDC Rect of the Sphere's Box --
+		// Clamped to the frustum depths, the box is in front of the camera, so its corners give its projected bounds
+		float min_depth = glm::max(depth - radius, m_Near), max_depth = glm::min(depth + radius, m_Far);
+		glm::vec2 ndc_min = glm::vec2(FLT_MAX), ndc_max = glm::vec2(-FLT_MAX);
+
+		for (uint corner = 0; corner < 8; ++corner)
+		{
+			glm::vec3 corner_position = glm::vec3(center.x + (corner & 1 ? radius : -radius), center.y + (corner & 2 ? radius : -radius), corner & 4 ? -max_depth : -min_depth);
+			glm::vec4 clip_position = m_Projection * glm::vec4(corner_position, 1.0f);
+			glm::vec2 ndc = glm::vec2(clip_position) / clip_position.w;
+
+			ndc_min = glm::min(ndc_min, ndc);
+			ndc_max = glm::max(ndc_max, ndc);
+		}
+
+		if (ndc_max.x < -1.0f || ndc_min.x > 1.0f || ndc_max.y < -1.0f || ndc_min.y > 1.0f)
+			return;
+
+		// -- Clusters Range --
+		bounds.MinCluster = glm::uvec3(GetTile(ndc_min.x, GridX), GetTile(ndc_min.y, GridY), GetDepthSlice(min_depth));
+		bounds.MaxCluster = glm::uvec3(GetTile(ndc_max.x, GridX), GetTile(ndc_max.y, GridY), GetDepthSlice(max_depth));
+		bounds.Visible = true;
+	}
+
+	void LightClusters::BinSlice(uint slice)
+	{
+		// -- Lights in the Slice --
+		std::vector<uint> slice_lights;
+		for (uint i = 0; i < (uint)m_LightBounds.size(); ++i)
+		{
+			const LightBounds& bounds = m_LightBounds[i];
+			if (bounds.Visible && slice >= bounds.MinCluster.z && slice <= bounds.MaxCluster.z)
+				slice_lights.push_back(i);
+		}
+
+		// -- Lights of each Cluster (offsets relative to the slice list) --
+		std::vector<uint>& slice_indices = m_SliceIndices[slice];
+		slice_indices.clear();
+
+		for (uint y = 0; y < GridY; ++y)
+		{
+			for (uint x = 0; x < GridX; ++x)
+			{
+				uint cluster_index = GetClusterGridIndex(x, y, slice);
+				Cluster& cluster = m_Clusters[cluster_index];
+				cluster.Offset = (uint)slice_indices.size();
+
+				for (uint light_index : slice_lights)
+				{
+					const LightBounds& bounds = m_LightBounds[light_index];
+					if (x < bounds.MinCluster.x || x > bounds.MaxCluster.x || y < bounds.MinCluster.y || y > bounds.MaxCluster.y)
+						continue;
+
+					if (bounds.ViewSphere.IntersectsAABB(m_ClusterBounds[cluster_index]))
+						slice_indices.push_back(light_index);
+				}
+
+				cluster.Count = (uint)slice_indices.size() - cluster.Offset;
+			}
+		}
+	}
+}
@@ -0,0 +1,77 @@
+#ifndef _LIGHTCLUSTERS_H_
+#define _LIGHTCLUSTERS_H_
+
+#include "Core/Utils/Maths/BoundingVolumes.h"
+
+namespace Kaimos {
+
+	// Clustered forward lighting: splits the view frustum in a grid of view-space clusters & bins the point lights into them,
+	// so each fragment only shades the lights of its cluster. It's CPU-only (no GPU resources), the Renderer uploads its results
+	// Clusters are tiled in NDC (x, y) and sliced in view depth (z), exponentially for perspective projections & linearly for orthographic ones
+	class LightClusters
+	{
+	public:
+
+		// --- Cluster Grid ---
+		static constexpr uint GridX = 16, GridY = 9, GridZ = 24;
+		static constexpr uint ClustersCount = GridX * GridY * GridZ;
+
+		// Range of light indices (in GetLightIndices()) affecting a cluster
+		struct Cluster
+		{
+			uint Offset = 0, Count = 0;
+		};
+
+		// --- Public Clustering Methods ---
+		// Bins the lights (world-space spheres of influence) with the camera matrices, keeping up to max_indices light indices
+		// It waits for the Job System, so it has to be called before dispatching jobs that shouldn't be waited (like the timed vertices ones)
+		void Build(const glm::mat4& view, const glm::mat4& projection, const std::vector<Maths::BoundingSphere>& lights, uint max_indices);
+
+		// Cluster in which a view-space point falls, same as the shaders compute it (UINT_MAX if behind near or beyond far planes)
+		uint GetClusterIndex(const glm::vec3& view_position) const;
+
+		// --- Getters ---
+		const std::vector<Cluster>& GetClusters()	const { return m_Clusters; }
+		const std::vector<uint>& GetLightIndices()	const { return m_LightIndices; }
+		uint GetDroppedIndicesCount()				const { return m_DroppedIndices; }
+
+		// Near, far, slice scale & slice bias, the slice of a depth is (log(depth) or depth) * scale + bias
+		glm::vec4 GetDepthParameters()				const { return { m_Near, m_Far, m_SliceScale, m_SliceBias }; }
+		bool IsPerspective()						const { return m_Perspective; }
+
+	private:
+
+		// --- Private Clustering Methods ---
+		void SetProjection(const glm::mat4& projection);
+		float GetSliceDepth(uint slice) const;
+		uint GetDepthSlice(float depth) const;
+
+		void CalculateLightBounds(uint light_index, const glm::mat4& view, const Maths::BoundingSphere& light);
+		void BinSlice(uint slice);
+
+	private:
+
+		// Light sphere in view space and the clusters range it overlaps
+		struct LightBounds
+		{
+			Maths::BoundingSphere ViewSphere = {};
+			glm::uvec3 MinCluster = glm::uvec3(0), MaxCluster = glm::uvec3(0);
+			bool Visible = false;
+		};
+
+		// Projection (cluster bounds are only recalculated when it changes)
+		glm::mat4 m_Projection = glm::mat4(0.0f);
+		bool m_Perspective = true;
+		float m_Near = 0.1f, m_Far = 10000.0f, m_SliceScale = 0.0f, m_SliceBias = 0.0f;
+		std::vector<Maths::AABB> m_ClusterBounds;
+
+		// Binning
+		std::vector<LightBounds> m_LightBounds;
+		std::vector<std::vector<uint>> m_SliceIndices;	// Per-slice light indices, merged into m_LightIndices once all are binned
+		std::vector<Cluster> m_Clusters;
+		std::vector<uint> m_LightIndices;
+		uint m_DroppedIndices = 0;
+	};
+}
+
+#endif //_LIGHTCLUSTERS_H_
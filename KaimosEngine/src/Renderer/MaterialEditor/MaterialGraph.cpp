@@ -39,8 +39,21 @@ namespace Kaimos::MaterialEditor {
 
 	void MaterialGraph::DrawNodes()
 	{
+		// -- Nodes UI can add input pins (operation nodes), which changes the compiled program --
+		uint inputs_count = 0, prev_inputs_count = 0;
+		bool values_edited = false;
 		for (Ref<MaterialNode>& node : m_Nodes)
-			node->DrawNodeUI();
+		{
+			prev_inputs_count += node->GetInputsQuantity();
+			values_edited |= node->DrawNodeUI();
+			inputs_count += node->GetInputsQuantity();
+		}
+
+		// -- Edited pin or constant values don't change the program (it loads them), but they change the vertices evaluated --
+		if (inputs_count != prev_inputs_count)
+			InvalidateProgram();
+		else if (values_edited)
+			UpdateVersion();
 	}
 
 
@@ -57,6 +70,7 @@ namespace Kaimos::MaterialEditor {
 
 		MaterialNode* node = static_cast<MaterialNode*>(new VertexParameterMaterialNode(vertexparam_type));
 		m_Nodes.push_back(CreateRef<MaterialNode>(node));
+		InvalidateProgram();
 		ImNodes::SetNodeScreenSpacePos(node->GetID(), ImVec2(node_pos.x, node_pos.y));
 		return node;
 	}
@@ -71,6 +85,7 @@ namespace Kaimos::MaterialEditor {
 
 		MaterialNode* node = static_cast<MaterialNode*>(new ConstantMaterialNode(constant_type));
 		m_Nodes.push_back(CreateRef<MaterialNode>(node));
+		InvalidateProgram();
 		ImNodes::SetNodeScreenSpacePos(node->GetID(), ImVec2(node_pos.x, node_pos.y));
 		return node;
 	}
@@ -85,6 +100,7 @@ namespace Kaimos::MaterialEditor {
 
 		MaterialNode* node = static_cast<MaterialNode*>(new OperationMaterialNode(operation_type, operation_data_type));
 		m_Nodes.push_back(CreateRef<MaterialNode>(node));
+		InvalidateProgram();
 		ImNodes::SetNodeScreenSpacePos(node->GetID(), ImVec2(node_pos.x, node_pos.y));
 		return node;
 	}
@@ -99,6 +115,7 @@ namespace Kaimos::MaterialEditor {
 
 		MaterialNode* node = static_cast<MaterialNode*>(new SpecialOperationNode(operation_type, operation_data_type));
 		m_Nodes.push_back(CreateRef<MaterialNode>(node));
+		InvalidateProgram();
 		ImNodes::SetNodeScreenSpacePos(node->GetID(), ImVec2(node_pos.x, node_pos.y));
 		return node;
 	}
@@ -107,7 +124,10 @@ namespace Kaimos::MaterialEditor {
 	{
 		NodePin* pin = FindNodePin(input_pinID);
 		if (pin)
+		{
 			pin->LinkPin(FindNodePin(output_pinID), deserializing);
+			InvalidateProgram();
+		}
 	}
 
 
@@ -124,6 +144,7 @@ namespace Kaimos::MaterialEditor {
 			if ((*it)->GetID() == nodeID)
 			{
 				m_Nodes.erase(it);
+				InvalidateProgram();
 				return;
 			}
 		}
@@ -133,7 +154,10 @@ namespace Kaimos::MaterialEditor {
 	{
 		NodePin* pin = FindNodePin(pinID);
 		if (pin)
+		{
 			pin->DeleteLink(pinID);
+			InvalidateProgram();
+		}
 	}
 
 	bool MaterialGraph::IsVertexAttributeTimed(VertexParameterNodeType vtxpm_node_type) const
@@ -178,6 +202,14 @@ namespace Kaimos::MaterialEditor {
 		}
 	}
 
+	const MaterialGraphProgram& MaterialGraph::GetVertexAttributesProgram()
+	{
+		if (!m_Program.IsCompiled())
+			m_Program.Compile(m_MainMatNode.get());
+
+		return m_Program;
+	}
+
 	NodePin* MaterialGraph::FindNodePin(uint pinID)
 	{
 		for (uint i = 0; i < m_Nodes.size(); ++i)
@@ -357,6 +389,8 @@ namespace Kaimos::MaterialEditor {
 			for (auto link_pair : links_vector)
 				CreateLink(link_pair.first, link_pair.second, true);
 		}
+
+		InvalidateProgram();
 	}
 
 	void MaterialGraph::SerializeGraph(YAML::Emitter& output_emitter) const
@@ -3,10 +3,11 @@
 
 #include "MaterialNode.h"
 #include "MaterialNodePin.h"
+#include "MaterialGraphProgram.h"
 
 struct ImVec2;
 namespace YAML { class Emitter; class Node; }
-namespace Kaimos { class Material; class Renderer; }
+namespace Kaimos { class Material; class Renderer; struct Vertex; }
 
 
 namespace Kaimos::MaterialEditor {
@@ -63,6 +64,14 @@ namespace Kaimos::MaterialEditor {
 		void SyncMaterialValuesWithGraph();
 		void SyncVertexParameterNodes(VertexParameterNodeType vtxpm_node_type, const glm::vec4& value);
 
+		// Returns the graph compiled into a program (recompiling it if its nodes or links changed)
+		const MaterialGraphProgram& GetVertexAttributesProgram();
+
+		// Changes each time the graph can evaluate different vertices (when its nodes, links or pin values change, or its results are
+		// updated), from a global counter, so vertices evaluated with another version are outdated
+		uint GetVersion() const { return m_Version; }
+		void UpdateVersion() { m_Version = ++s_VersionsCounter; }
+
 		template<typename T>
 		T& GetVertexParameterResult(VertexParameterNodeType vtxpm_node_type)
 		{
@@ -73,6 +82,7 @@ namespace Kaimos::MaterialEditor {
 
 		// --- Private Material Graph Methods ---
 		NodePin* FindNodePin(uint pinID);
+		void InvalidateProgram() { m_Program.Invalidate(); UpdateVersion(); }
 
 	private:
 
@@ -81,6 +91,11 @@ namespace Kaimos::MaterialEditor {
 
 		Ref<MainMaterialNode> m_MainMatNode = nullptr;
 		std::vector<Ref<MaterialNode>> m_Nodes;
+
+		MaterialGraphProgram m_Program;
+
+		inline static uint s_VersionsCounter = 0;
+		uint m_Version = ++s_VersionsCounter;
 	};
 
 }
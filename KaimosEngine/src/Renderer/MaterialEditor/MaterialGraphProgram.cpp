@@ -0,0 +1,415 @@
+#include "kspch.h"
+#include "MaterialGraphProgram.h"
+#include "NodeBatchUtils.h"
+
+#include "Core/Utils/Maths/RandomGenerator.h"
+
+
+namespace Kaimos::MaterialEditor {
+
+	// ----------------------- Public Program Methods ----------------------------------------------------
+	void MaterialGraphProgram::Compile(MainMaterialNode* main_node)
+	{
+		KS_PROFILE_FUNCTION();
+		ResetProgram();
+
+		// -- Compile the Vertex Attributes (nodes shared between them are only compiled once) --
+		m_PositionOutput = CompileInputPin(main_node->m_VertexPositionPin.get());
+		m_NormalOutput = CompileInputPin(main_node->m_VertexNormalPin.get());
+		m_TexCoordsOutput = CompileInputPin(main_node->m_TextureCoordinatesPin.get());
+
+		// -- Clear Compilation State --
+		m_NodeRegisters.clear();
+		m_NodesInStack.clear();
+		m_VaryingRegisters.clear();
+		m_Compiled = true;
+	}
+
+
+	std::vector<glm::vec4> MaterialGraphProgram::EvaluateUniforms() const
+	{
+		KS_PROFILE_FUNCTION();
+		if (!m_Compiled)
+		{
+			KS_ERROR("Tried to evaluate a non-compiled Material Graph Program!");
+			return {};
+		}
+
+		// -- Load Uniform Registers (unlinked pins & constants might change without recompiling) --
+		std::vector<glm::vec4> registers(m_RegistersCount, glm::vec4(0.0f));
+		for (const std::pair<NodeInputPin*, uint>& load : m_PinLoads)
+			registers[load.second] = load.first->GetValue();
+
+		for (const std::pair<ConstantMaterialNode*, uint>& load : m_ConstantLoads)
+			registers[load.second] = load.first->ConstantMaterialNode::CalculateNodeResult();
+
+		RunInstructions(m_UniformInstructions, registers.data());
+		return registers;
+	}
+
+
+
+	// ----------------------- Private Compilation Methods -----------------------------------------------
+	uint MaterialGraphProgram::CompileInputPin(NodeInputPin* input_pin)
+	{
+		// -- Unlinked pins are loaded from their value on each evaluation --
+		if (!input_pin->m_OutputLinked)
+		{
+			uint reg = AddRegister(false);
+			m_PinLoads.push_back({ input_pin, reg });
+			return reg;
+		}
+
+		return CompileNode(input_pin->m_OutputLinked->m_OwnerNode);
+	}
+
+
+	uint MaterialGraphProgram::CompileNode(MaterialNode* node)
+	{
+		// -- Already Compiled or Cyclic --
+		std::unordered_map<MaterialNode*, uint>::const_iterator it = m_NodeRegisters.find(node);
+		if (it != m_NodeRegisters.end())
+			return it->second;
+
+		if (m_NodesInStack.find(node) != m_NodesInStack.end())
+		{
+			KS_ERROR("Material Graph has a cycle on node '{0}', it will evaluate to 0", node->GetName());
+			return s_ZeroRegister;
+		}
+
+		// -- Compile Node after its Inputs (post-order gives the topological order) --
+		m_NodesInStack.insert(node);
+		uint reg = s_ZeroRegister;
+		bool varying = false;
+
+		switch (node->GetType())
+		{
+			case MaterialNodeType::VERTEX_PARAMETER:
+			{
+				switch (static_cast<VertexParameterMaterialNode*>(node)->GetParameterType())
+				{
+					case VertexParameterNodeType::POSITION:		reg = s_PositionRegister; break;
+					case VertexParameterNodeType::NORMAL:		reg = s_NormalRegister; break;
+					case VertexParameterNodeType::TEX_COORDS:	reg = s_TexCoordsRegister; break;
+				}
+
+				break;
+			}
+
+			case MaterialNodeType::CONSTANT:			reg = CompileConstantNode(static_cast<ConstantMaterialNode*>(node), varying); break;
+			case MaterialNodeType::OPERATION:			reg = CompileOperationNode(static_cast<OperationMaterialNode*>(node), varying); break;
+			case MaterialNodeType::SPECIAL_OPERATION:	reg = CompileSpecialOperationNode(static_cast<SpecialOperationNode*>(node), varying); break;
+			default:
+				KS_FATAL_ERROR("Tried to compile an invalid node into a Material Graph Program!");
+		}
+
+		m_NodesInStack.erase(node);
+		m_NodeRegisters[node] = reg;
+		return reg;
+	}
+
+
+	uint MaterialGraphProgram::CompileOperationNode(OperationMaterialNode* node, bool& varying)
+	{
+		// -- Compile Inputs --
+		const std::vector<Ref<NodeInputPin>>& inputs = node->m_NodeInputPins;
+		std::vector<uint> input_regs;
+		for (const Ref<NodeInputPin>& pin : inputs)
+		{
+			uint input_reg = CompileInputPin(pin.get());
+			varying |= m_VaryingRegisters[input_reg];
+			input_regs.push_back(input_reg);
+		}
+
+		// -- Fold the N inputs into N-1 binary operations over the same register --
+		uint reg = AddRegister(varying);
+		if (inputs.size() == 1)
+		{
+			GraphInstruction instruction;
+			instruction.Type = GraphInstructionType::COPY;
+			instruction.Inputs[0] = input_regs[0];
+			instruction.Output = reg;
+			AddInstruction(instruction, varying);
+			return reg;
+		}
+
+		for (uint i = 1; i < inputs.size(); ++i)
+		{
+			GraphInstruction instruction;
+			instruction.Type = GraphInstructionType::OPERATION;
+			instruction.Operation = (int)node->m_OperationType;
+			instruction.DataType = inputs[0]->GetType();
+			instruction.SecondDataType = inputs[i]->GetType();
+			instruction.Inputs[0] = (i == 1 ? input_regs[0] : reg);
+			instruction.Inputs[1] = input_regs[i];
+			instruction.Output = reg;
+			AddInstruction(instruction, varying);
+		}
+
+		return reg;
+	}
+
+
+	uint MaterialGraphProgram::CompileSpecialOperationNode(SpecialOperationNode* node, bool& varying)
+	{
+		if (node->m_OperationOutputType == PinDataType::NONE)
+			KS_FATAL_ERROR("Some material node has this wrong!");
+
+		// -- Compile Inputs --
+		GraphInstruction instruction;
+		for (uint i = 0; i < node->m_NodeInputPins.size() && i < 3; ++i)
+		{
+			instruction.Inputs[i] = CompileInputPin(node->m_NodeInputPins[i].get());
+			varying |= m_VaryingRegisters[instruction.Inputs[i]];
+		}
+
+		// -- Set Instruction --
+		SpecialOperationNodeType op_type = node->m_OperationType;
+		if (op_type == SpecialOperationNodeType::FINT || op_type == SpecialOperationNodeType::INTF)
+			instruction.Type = GraphInstructionType::COPY;
+		else if (node->IsGetVecCompType())
+		{
+			instruction.Type = GraphInstructionType::VEC_COMPONENT;
+			instruction.Operation = (int)op_type - (int)SpecialOperationNodeType::VEC_X;
+		}
+		else
+		{
+			instruction.Type = GraphInstructionType::SPECIAL_OPERATION;
+			instruction.Operation = (int)op_type;
+			instruction.DataType = node->m_OperationOutputType;
+		}
+
+		instruction.Output = AddRegister(varying);
+		AddInstruction(instruction, varying);
+		return instruction.Output;
+	}
+
+
+	uint MaterialGraphProgram::CompileConstantNode(ConstantMaterialNode* node, bool& varying)
+	{
+		// -- Random Constants are drawn per vertex (a new value on each vertex, as when walking the graph per vertex) --
+		ConstantNodeType const_type = node->m_ConstantType;
+		if (const_type >= ConstantNodeType::INT_RANDOM && const_type <= ConstantNodeType::VEC4_RANDOM)
+		{
+			GraphInstruction instruction;
+			instruction.Type = GraphInstructionType::RANDOM;
+			instruction.Operation = (int)const_type;
+
+			varying = true;
+			m_HasRandoms = true;
+			instruction.Output = AddRegister(varying);
+			AddInstruction(instruction, varying);
+			return instruction.Output;
+		}
+
+		// -- Non-Variable Constants are loaded on each evaluation --
+		bool is_variable = (const_type == ConstantNodeType::INT || const_type == ConstantNodeType::FLOAT || const_type == ConstantNodeType::VEC2
+			|| const_type == ConstantNodeType::VEC3 || const_type == ConstantNodeType::VEC4);
+
+		if (!is_variable)
+		{
+			uint reg = AddRegister(false);
+			m_ConstantLoads.push_back({ node, reg });
+			return reg;
+		}
+
+		// -- Variables take their inputs components (x of each input or the whole vec4) --
+		GraphInstruction instruction;
+		instruction.Type = (const_type == ConstantNodeType::VEC4 ? GraphInstructionType::COPY : GraphInstructionType::COMPOSE);
+		for (uint i = 0; i < node->m_NodeInputPins.size() && i < 3; ++i)
+		{
+			instruction.Inputs[i] = CompileInputPin(node->m_NodeInputPins[i].get());
+			varying |= m_VaryingRegisters[instruction.Inputs[i]];
+		}
+
+		instruction.Output = AddRegister(varying);
+		AddInstruction(instruction, varying);
+		return instruction.Output;
+	}
+
+
+	uint MaterialGraphProgram::AddRegister(bool varying)
+	{
+		m_VaryingRegisters.push_back(varying);
+		return m_RegistersCount++;
+	}
+
+
+	void MaterialGraphProgram::AddInstruction(const GraphInstruction& instruction, bool varying)
+	{
+		if (varying)
+			m_VaryingInstructions.push_back(instruction);
+		else
+			m_UniformInstructions.push_back(instruction);
+	}
+
+
+	void MaterialGraphProgram::ResetProgram()
+	{
+		m_Compiled = m_HasRandoms = false;
+		m_UniformInstructions.clear();
+		m_VaryingInstructions.clear();
+		m_PinLoads.clear();
+		m_ConstantLoads.clear();
+		m_NodeRegisters.clear();
+		m_NodesInStack.clear();
+
+		// Zero register is uniform, vertex parameters registers are varying
+		m_RegistersCount = s_ReservedRegisters;
+		m_VaryingRegisters = { false, true, true, true };
+		m_PositionOutput = s_PositionRegister;
+		m_NormalOutput = s_NormalRegister;
+		m_TexCoordsOutput = s_TexCoordsRegister;
+	}
+
+
+
+	// ----------------------- Private Execution Methods -------------------------------------------------
+	std::vector<glm::vec4> MaterialGraphProgram::CreateColumns(const std::vector<glm::vec4>& uniforms) const
+	{
+		if (!m_Compiled || uniforms.size() != m_RegistersCount)
+		{
+			KS_ERROR("Tried to evaluate a Material Graph Program with wrong uniforms!");
+			return {};
+		}
+
+		// -- Broadcast Registers into Columns (varying ones are overwritten on each batch) --
+		std::vector<glm::vec4> columns(m_RegistersCount * s_BatchSize);
+		for (uint reg = 0; reg < m_RegistersCount; ++reg)
+			std::fill(columns.begin() + reg * s_BatchSize, columns.begin() + (reg + 1) * s_BatchSize, uniforms[reg]);
+
+		return columns;
+	}
+
+	void MaterialGraphProgram::RunInstructions(const std::vector<GraphInstruction>& instructions, glm::vec4* registers)
+	{
+		for (const GraphInstruction& instruction : instructions)
+		{
+			const glm::vec4& a = registers[instruction.Inputs[0]];
+			const glm::vec4& b = registers[instruction.Inputs[1]];
+			const glm::vec4& c = registers[instruction.Inputs[2]];
+
+			switch (instruction.Type)
+			{
+				case GraphInstructionType::COPY:
+					registers[instruction.Output] = a;
+					break;
+				case GraphInstructionType::COMPOSE:
+					registers[instruction.Output] = glm::vec4(a.x, b.x, c.x, 0.0f);
+					break;
+				case GraphInstructionType::VEC_COMPONENT:
+					registers[instruction.Output] = glm::vec4(a[instruction.Operation], 0.0f, 0.0f, 0.0f);
+					break;
+				case GraphInstructionType::OPERATION:
+					registers[instruction.Output] = OperationMaterialNode::ProcessOperation((OperationNodeType)instruction.Operation, a, b, instruction.DataType, instruction.SecondDataType);
+					break;
+				case GraphInstructionType::SPECIAL_OPERATION:
+					registers[instruction.Output] = SpecialOperationNode::ProcessOperation((SpecialOperationNodeType)instruction.Operation, instruction.DataType, a, b, c);
+					break;
+				case GraphInstructionType::RANDOM:
+					RunBatchRandom(instruction, &registers[instruction.Output], 1);
+					break;
+			}
+		}
+	}
+
+
+	void MaterialGraphProgram::RunBatchInstructions(const std::vector<GraphInstruction>& instructions, glm::vec4* columns, uint count)
+	{
+		for (const GraphInstruction& instruction : instructions)
+		{
+			const glm::vec4* a = columns + instruction.Inputs[0] * s_BatchSize;
+			const glm::vec4* b = columns + instruction.Inputs[1] * s_BatchSize;
+			const glm::vec4* c = columns + instruction.Inputs[2] * s_BatchSize;
+			glm::vec4* result = columns + instruction.Output * s_BatchSize;
+
+			switch (instruction.Type)
+			{
+				case GraphInstructionType::COPY:
+					std::copy(a, a + count, result);
+					break;
+				case GraphInstructionType::COMPOSE:
+					for (uint i = 0; i < count; ++i)
+						result[i] = glm::vec4(a[i].x, b[i].x, c[i].x, 0.0f);
+					break;
+				case GraphInstructionType::VEC_COMPONENT:
+					for (uint i = 0; i < count; ++i)
+						result[i] = glm::vec4(a[i][instruction.Operation], 0.0f, 0.0f, 0.0f);
+					break;
+				case GraphInstructionType::OPERATION:
+					RunBatchOperation(instruction, a, b, result, count);
+					break;
+				case GraphInstructionType::SPECIAL_OPERATION:
+					RunBatchSpecialOperation(instruction, a, b, c, result, count);
+					break;
+				case GraphInstructionType::RANDOM:
+					RunBatchRandom(instruction, result, count);
+					break;
+			}
+		}
+	}
+
+
+	void MaterialGraphProgram::RunBatchOperation(const GraphInstruction& instruction, const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count)
+	{
+		// -- Operations with Batch Kernel --
+		OperationNodeType op_type = (OperationNodeType)instruction.Operation;
+		switch (op_type)
+		{
+			case OperationNodeType::ADDITION:			NodeUtils::Batch::SumValues(instruction.DataType, a, b, result, count); return;
+			case OperationNodeType::SUBTRACTION:		NodeUtils::Batch::SubtractValues(instruction.DataType, a, b, result, count); return;
+			case OperationNodeType::MULTIPLICATION:		NodeUtils::Batch::MultiplyValues(instruction.DataType, a, b, result, count); return;
+			case OperationNodeType::FLOATVEC_MULTIPLY:	NodeUtils::Batch::MultiplyFloatAndVec(a, b, result, count, instruction.DataType, instruction.SecondDataType); return;
+		}
+
+		// -- Rest of Operations, value by value --
+		for (uint i = 0; i < count; ++i)
+			result[i] = OperationMaterialNode::ProcessOperation(op_type, a[i], b[i], instruction.DataType, instruction.SecondDataType);
+	}
+
+
+	void MaterialGraphProgram::RunBatchSpecialOperation(const GraphInstruction& instruction, const glm::vec4* a, const glm::vec4* b, const glm::vec4* c, glm::vec4* result, uint count)
+	{
+		// -- Operations with Batch Kernel --
+		SpecialOperationNodeType op_type = (SpecialOperationNodeType)instruction.Operation;
+		switch (op_type)
+		{
+			case SpecialOperationNodeType::ABS:			NodeUtils::Batch::AbsoluteValue(instruction.DataType, a, result, count); return;
+			case SpecialOperationNodeType::MIN:			NodeUtils::Batch::MinValue(instruction.DataType, a, b, result, count); return;
+			case SpecialOperationNodeType::MAX:			NodeUtils::Batch::MaxValue(instruction.DataType, a, b, result, count); return;
+			case SpecialOperationNodeType::NEGATE:		NodeUtils::Batch::Negate(instruction.DataType, a, result, count); return;
+			case SpecialOperationNodeType::SQRT:		NodeUtils::Batch::SqrtValue(instruction.DataType, a, result, count); return;
+			case SpecialOperationNodeType::SIN:			NodeUtils::Batch::Sin(instruction.DataType, a, result, count); return;
+			case SpecialOperationNodeType::VEC_SMOOTHSTEP:	NodeUtils::Batch::VSmoothstepValue(instruction.DataType, a, b, c, result, count); return;
+			case SpecialOperationNodeType::VEC_ROTX:	NodeUtils::Batch::VectorRotateX(instruction.DataType, a, b, result, count); return;
+		}
+
+		// -- Rest of Operations, value by value --
+		for (uint i = 0; i < count; ++i)
+			result[i] = SpecialOperationNode::ProcessOperation(op_type, instruction.DataType, a[i], b[i], c[i]);
+	}
+
+
+	void MaterialGraphProgram::RunBatchRandom(const GraphInstruction& instruction, glm::vec4* result, uint count)
+	{
+		// -- Same values than the Random Constant Nodes (varying instructions run in parallel jobs, so they draw them per thread) --
+		ConstantNodeType const_type = (ConstantNodeType)instruction.Operation;
+		if (const_type == ConstantNodeType::INT_RANDOM)
+		{
+			for (uint i = 0; i < count; ++i)
+				result[i] = glm::vec4((float)Random::GetThreadRandomInt(), 0.0f, 0.0f, 0.0f);
+
+			return;
+		}
+
+		int components = (int)const_type - (int)ConstantNodeType::FLOAT_RANDOM + 1;
+		for (uint i = 0; i < count; ++i)
+		{
+			glm::vec4 value = glm::vec4(0.0f);
+			for (int c = 0; c < components; ++c)
+				value[c] = Random::GetThreadRandomFloat();
+
+			result[i] = value;
+		}
+	}
+}
@@ -0,0 +1,146 @@
+#ifndef _MATERIALGRAPHPROGRAM_H_
+#define _MATERIALGRAPHPROGRAM_H_
+
+#include "MaterialNode.h"
+#include "MaterialNodePin.h"
+
+
+namespace Kaimos::MaterialEditor {
+
+	// ---- Graph Program Instructions ----
+	enum class GraphInstructionType { NONE, COPY, COMPOSE, VEC_COMPONENT, OPERATION, SPECIAL_OPERATION, RANDOM };
+
+	// Operates over the program registers: Output = Op(Inputs[0], Inputs[1], Inputs[2])
+	struct GraphInstruction
+	{
+		GraphInstructionType Type = GraphInstructionType::NONE;
+		int Operation = 0;																// Operation Node Type, Vector Component Index or Random Constant Type
+		PinDataType DataType = PinDataType::NONE, SecondDataType = PinDataType::NONE;
+
+		uint Inputs[3] = { 0, 0, 0 };
+		uint Output = 0;
+	};
+
+
+
+	// ---- Material Graph Program ----
+	// Flat, topologically ordered list of register instructions into which a Material Graph compiles its vertex attributes
+	// Instructions not depending on the vertex parameters are run once per evaluation, the rest, over batches of vertices
+	// Random constants are drawn per vertex (as varying instructions), like each vertex walked the graph on its own
+	class MaterialGraphProgram
+	{
+	public:
+
+		// --- Public Program Methods ---
+		void Compile(MainMaterialNode* main_node);
+		void Invalidate()	{ m_Compiled = false; }
+		bool IsCompiled()	const { return m_Compiled; }
+
+		// False if the vertices positions go untouched through the graph
+		bool ModifiesPositions() const { return m_Compiled && m_PositionOutput != s_PositionRegister; }
+
+		// True if it draws random values, so each evaluation gives different vertices (they can't be shared between components)
+		bool HasRandoms() const { return m_Compiled && m_HasRandoms; }
+
+		// Loads and runs the instructions not depending on the vertices, its result is needed to evaluate them
+		// Must be called on the main thread, as it reads the graph pins & constants
+		std::vector<glm::vec4> EvaluateUniforms() const;
+
+		// Evaluates the compiled vertex attributes over a range of vertices, only writing the ones flagged
+		// It doesn't touch the graph, so different ranges can be evaluated in parallel with the same uniforms
+		template<typename T>
+		void EvaluateVertices(const std::vector<glm::vec4>& uniforms, T* vertices, size_t count, bool position, bool normal, bool tex_coords) const
+		{
+			KS_PROFILE_FUNCTION();
+			std::vector<glm::vec4> columns = CreateColumns(uniforms);
+			if (columns.empty())
+				return;
+
+			glm::vec4* positions = &columns[s_PositionRegister * s_BatchSize];
+			glm::vec4* normals = &columns[s_NormalRegister * s_BatchSize];
+			glm::vec4* texcoords = &columns[s_TexCoordsRegister * s_BatchSize];
+
+			const glm::vec4* position_results = &columns[m_PositionOutput * s_BatchSize];
+			const glm::vec4* normal_results = &columns[m_NormalOutput * s_BatchSize];
+			const glm::vec4* tex_coords_results = &columns[m_TexCoordsOutput * s_BatchSize];
+
+			// -- Run Varying Instructions per Batch of Vertices --
+			for (size_t first = 0; first < count; first += s_BatchSize)
+			{
+				T* batch_vertices = vertices + first;
+				uint batch_count = (uint)std::min(count - first, (size_t)s_BatchSize);
+
+				for (uint i = 0; i < batch_count; ++i)
+				{
+					positions[i] = glm::vec4(batch_vertices[i].Pos, 0.0f);
+					normals[i] = glm::vec4(batch_vertices[i].Normal, 0.0f);
+					texcoords[i] = glm::vec4(batch_vertices[i].TexCoord, 0.0f, 0.0f);
+				}
+
+				RunBatchInstructions(m_VaryingInstructions, columns.data(), batch_count);
+
+				for (uint i = 0; i < batch_count; ++i)
+				{
+					if (position)
+						batch_vertices[i].Pos = glm::vec3(position_results[i]);
+					if (normal)
+						batch_vertices[i].Normal = glm::vec3(normal_results[i]);
+					if (tex_coords)
+						batch_vertices[i].TexCoord = glm::vec2(tex_coords_results[i]);
+				}
+			}
+		}
+
+		template<typename T>
+		void EvaluateVertices(std::vector<T>& vertices, bool position, bool normal, bool tex_coords) const
+		{
+			EvaluateVertices(EvaluateUniforms(), vertices.data(), vertices.size(), position, normal, tex_coords);
+		}
+
+	private:
+
+		// --- Private Compilation Methods ---
+		uint CompileInputPin(NodeInputPin* input_pin);
+		uint CompileNode(MaterialNode* node);
+		uint CompileOperationNode(OperationMaterialNode* node, bool& varying);
+		uint CompileSpecialOperationNode(SpecialOperationNode* node, bool& varying);
+		uint CompileConstantNode(ConstantMaterialNode* node, bool& varying);
+
+		uint AddRegister(bool varying);
+		void AddInstruction(const GraphInstruction& instruction, bool varying);
+		void ResetProgram();
+
+		// --- Private Execution Methods ---
+		std::vector<glm::vec4> CreateColumns(const std::vector<glm::vec4>& uniforms) const;
+		static void RunInstructions(const std::vector<GraphInstruction>& instructions, glm::vec4* registers);
+
+		// Runs the instructions over registers columns of s_BatchSize values (one per vertex), of which only "count" are used
+		static void RunBatchInstructions(const std::vector<GraphInstruction>& instructions, glm::vec4* columns, uint count);
+		static void RunBatchOperation(const GraphInstruction& instruction, const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count);
+		static void RunBatchSpecialOperation(const GraphInstruction& instruction, const glm::vec4* a, const glm::vec4* b, const glm::vec4* c, glm::vec4* result, uint count);
+		static void RunBatchRandom(const GraphInstruction& instruction, glm::vec4* result, uint count);
+
+	private:
+
+		// --- Registers Layout ---
+		static constexpr uint s_ZeroRegister = 0, s_PositionRegister = 1, s_NormalRegister = 2, s_TexCoordsRegister = 3;
+		static constexpr uint s_ReservedRegisters = 4;
+		static constexpr uint s_BatchSize = 256;
+
+		// --- Variables ---
+		bool m_Compiled = false, m_HasRandoms = false;
+		uint m_RegistersCount = s_ReservedRegisters;
+		uint m_PositionOutput = s_PositionRegister, m_NormalOutput = s_NormalRegister, m_TexCoordsOutput = s_TexCoordsRegister;
+
+		std::vector<GraphInstruction> m_UniformInstructions, m_VaryingInstructions;
+		std::vector<std::pair<NodeInputPin*, uint>> m_PinLoads;
+		std::vector<std::pair<ConstantMaterialNode*, uint>> m_ConstantLoads;
+
+		// Compilation-only state
+		std::unordered_map<MaterialNode*, uint> m_NodeRegisters;
+		std::unordered_set<MaterialNode*> m_NodesInStack;
+		std::vector<bool> m_VaryingRegisters;
+	};
+}
+
+#endif //_MATERIALGRAPHPROGRAM_H_
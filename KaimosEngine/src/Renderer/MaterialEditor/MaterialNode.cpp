@@ -38,7 +38,7 @@ namespace Kaimos::MaterialEditor {
 	}
 
 
-	void MaterialNode::DrawNodeUI()
+	bool MaterialNode::DrawNodeUI()
 	{
 		// -- Push Node Colors --
 		ImNodes::PushColorStyle(ImNodesCol_TitleBar, IM_COL32(m_NodeColor.r, m_NodeColor.g, m_NodeColor.b, 255));
@@ -59,9 +59,9 @@ namespace Kaimos::MaterialEditor {
 			m_NodeOutputPin->DrawUI();
 
 		// -- Draw Input Pins --
-		bool set_node_draggable = true;
+		bool set_node_draggable = true, values_edited = false;
 		for (Ref<NodeInputPin>& pin : m_NodeInputPins)
-			pin->DrawUI(set_node_draggable);
+			values_edited |= pin->DrawUI(set_node_draggable);
 
 		if (m_Type == MaterialNodeType::OPERATION)
 		{
@@ -85,6 +85,8 @@ namespace Kaimos::MaterialEditor {
 			if (pin->IsConnected())
 				ImNodes::Link(pin->GetID(), pin->GetID(), pin->GetOutputLinkedID());	// Links have the same ID than its input pin
 		}
+
+		return values_edited;
 	}
 
 
@@ -339,7 +341,7 @@ namespace Kaimos::MaterialEditor {
 	}
 
 
-	void MainMaterialNode::DrawNodeUI()
+	bool MainMaterialNode::DrawNodeUI()
 	{
 		bool set_node_draggable = true;
 		bool PBR_Pipeline = Renderer::IsSceneInPBRPipeline();
@@ -446,6 +448,9 @@ namespace Kaimos::MaterialEditor {
 		ImNodes::PopColorStyle();
 		ImNodes::PopColorStyle();
 		ImNodes::PopColorStyle();
+
+		// Its values are the material ones (uniforms), the vertex attributes pins have no values to edit
+		return false;
 	}
 
 	void MainMaterialNode::SyncValuesWithMaterial()
@@ -826,33 +831,30 @@ namespace Kaimos::MaterialEditor {
 				break;
 			}
 
-			// Random
+			// Random (thread-safe draws, as the program ones)
 			case ConstantNodeType::INT_RANDOM:
 			{
-				ret.x = Random::GetRandomInt();
+				ret.x = Random::GetThreadRandomInt();
 				break;
 			}
 			case ConstantNodeType::FLOAT_RANDOM:
 			{
-				ret.x = Random::GetRandomFloat();
+				ret.x = Random::GetThreadRandomFloat();
 				break;
 			}
 			case ConstantNodeType::VEC2_RANDOM:
 			{
-				std::vector<float> vec = Random::GetRandomFloatVector(2);
-				ret = glm::vec4(vec[0], vec[1], 0.0f, 0.0f);
+				ret = glm::vec4(Random::GetThreadRandomFloat(), Random::GetThreadRandomFloat(), 0.0f, 0.0f);
 				break;
 			}
 			case ConstantNodeType::VEC3_RANDOM:
 			{
-				std::vector<float> vec = Random::GetRandomFloatVector(3);
-				ret = glm::vec4(vec[0], vec[1], vec[2], 0.0f);
+				ret = glm::vec4(Random::GetThreadRandomFloat(), Random::GetThreadRandomFloat(), Random::GetThreadRandomFloat(), 0.0f);
 				break;
 			}
 			case ConstantNodeType::VEC4_RANDOM:
 			{
-				std::vector<float> vec = Random::GetRandomFloatVector(4);
-				ret = glm::vec4(vec[0], vec[1], vec[2], vec[3]);
+				ret = glm::vec4(Random::GetThreadRandomFloat(), Random::GetThreadRandomFloat(), Random::GetThreadRandomFloat(), Random::GetThreadRandomFloat());
 				break;
 			}
 			default:
@@ -975,15 +977,15 @@ namespace Kaimos::MaterialEditor {
 		glm::vec4 result = GetInputValue(0);
 
 		for (uint i = 1; i < m_NodeInputPins.size(); ++i)
-			result = ProcessOperation(result, GetInputValue(i), data_type, m_NodeInputPins[i]->GetType());
+			result = ProcessOperation(m_OperationType, result, GetInputValue(i), data_type, m_NodeInputPins[i]->GetType());
 
 		return result;
 	}
 
 
-	glm::vec4 OperationMaterialNode::ProcessOperation(const glm::vec4& a, const glm::vec4& b, PinDataType a_type, PinDataType b_type) const
+	glm::vec4 OperationMaterialNode::ProcessOperation(OperationNodeType op_type, const glm::vec4& a, const glm::vec4& b, PinDataType a_type, PinDataType b_type)
 	{
-		switch (m_OperationType)
+		switch (op_type)
 		{
 			// Addition & Subtraction
 			case OperationNodeType::ADDITION:			return NodeUtils::SumValues(a_type, a, b);
@@ -1170,9 +1172,9 @@ namespace Kaimos::MaterialEditor {
 
 		switch (m_InputsN)
 		{
-			case 1: return ProcessOperation(m_OperationOutputType, GetInputValue(0));
-			case 2: return ProcessOperation(m_OperationOutputType, GetInputValue(0), GetInputValue(1));
-			case 3: return ProcessOperation(m_OperationOutputType, GetInputValue(0), GetInputValue(1), GetInputValue(2));
+			case 1: return ProcessOperation(m_OperationType, m_OperationOutputType, GetInputValue(0));
+			case 2: return ProcessOperation(m_OperationType, m_OperationOutputType, GetInputValue(0), GetInputValue(1));
+			case 3: return ProcessOperation(m_OperationType, m_OperationOutputType, GetInputValue(0), GetInputValue(1), GetInputValue(2));
 		}
 
 		KS_FATAL_ERROR("A node has more than 3 inputs!");
@@ -1202,9 +1204,9 @@ namespace Kaimos::MaterialEditor {
 	}
 
 
-	glm::vec4 SpecialOperationNode::ProcessOperation(PinDataType op_type, const glm::vec4& a, const glm::vec4& b, const glm::vec4& c) const
+	glm::vec4 SpecialOperationNode::ProcessOperation(SpecialOperationNodeType operation, PinDataType op_type, const glm::vec4& a, const glm::vec4& b, const glm::vec4& c)
 	{
-		switch (m_OperationType)
+		switch (operation)
 		{
 			// Basics
 			case SpecialOperationNodeType::ABS:					return NodeUtils::AbsoluteValue(op_type, a);
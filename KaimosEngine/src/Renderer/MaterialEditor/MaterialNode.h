@@ -62,6 +62,7 @@ namespace Kaimos::MaterialEditor {
 	// ---- Base Material Node ----
 	class MaterialNode
 	{
+		friend class MaterialGraphProgram;
 	private:
 		virtual void SetNodeVariables() {}
 		virtual void SetNodeTooltip() = 0;
@@ -77,7 +78,8 @@ namespace Kaimos::MaterialEditor {
 		// --- Public Class Methods ---
 		~MaterialNode();
 
-		virtual void DrawNodeUI();
+		// Returns true if the values of its input pins were edited
+		virtual bool DrawNodeUI();
 		NodePin* FindPinInNode(uint pinID);
 
 		Ref<NodeInputPin> AddDeserializedInputPin(const std::string& pin_name, uint pin_id, int pin_datatype, const glm::vec4& pin_value, const glm::vec4& pin_defvalue, bool multitype);
@@ -133,6 +135,7 @@ namespace Kaimos::MaterialEditor {
 	class MainMaterialNode : public MaterialNode
 	{
 		friend class MaterialGraph;
+		friend class MaterialGraphProgram;
 	private:
 		virtual void SetNodeTooltip() override;
 	public:
@@ -144,7 +147,7 @@ namespace Kaimos::MaterialEditor {
 
 		~MainMaterialNode();
 
-		virtual void DrawNodeUI() override;
+		virtual bool DrawNodeUI() override;
 		void DeserializeMainNode(const YAML::Node& inputs_nodes);
 		bool IsVertexAttributeTimed(VertexParameterNodeType vtxpm_node_type) const;
 		
@@ -238,6 +241,7 @@ namespace Kaimos::MaterialEditor {
 	// ---- Constant Node ----
 	class ConstantMaterialNode : public MaterialNode
 	{
+		friend class MaterialGraphProgram;
 	private:
 		virtual void SetNodeVariables() override;
 		virtual void SetNodeTooltip() override;
@@ -262,6 +266,7 @@ namespace Kaimos::MaterialEditor {
 	// ---- Operation Node ----
 	class OperationMaterialNode : public MaterialNode
 	{
+		friend class MaterialGraphProgram;
 	private:
 		virtual void SetNodeVariables() override;
 		virtual void SetNodeTooltip() override;
@@ -281,7 +286,7 @@ namespace Kaimos::MaterialEditor {
 		virtual glm::vec4 CalculateNodeResult() override;
 		virtual void SerializeNode(YAML::Emitter& output_emitter) const override;
 
-		glm::vec4 ProcessOperation(const glm::vec4& a, const glm::vec4& b, PinDataType a_type, PinDataType b_type) const;
+		static glm::vec4 ProcessOperation(OperationNodeType op_type, const glm::vec4& a, const glm::vec4& b, PinDataType a_type, PinDataType b_type);
 
 		OperationNodeType m_OperationType = OperationNodeType::NONE;
 		PinDataType m_VecOperationType = PinDataType::FLOAT;
@@ -292,6 +297,7 @@ namespace Kaimos::MaterialEditor {
 	// ---- Special Operation Node ----
 	class SpecialOperationNode : public MaterialNode
 	{
+		friend class MaterialGraphProgram;
 	private:
 		virtual void SetNodeVariables() override;
 		virtual void SetNodeTooltip() override;
@@ -309,7 +315,7 @@ namespace Kaimos::MaterialEditor {
 		virtual glm::vec4 CalculateNodeResult() override;
 		virtual void SerializeNode(YAML::Emitter& output_emitter) const override;
 
-		glm::vec4 ProcessOperation(PinDataType op_type, const glm::vec4& a, const glm::vec4& b = glm::vec4(0.0f), const glm::vec4& c = glm::vec4(0.0f)) const;
+		static glm::vec4 ProcessOperation(SpecialOperationNodeType operation, PinDataType op_type, const glm::vec4& a, const glm::vec4& b = glm::vec4(0.0f), const glm::vec4& c = glm::vec4(0.0f));
 
 		// vec_comp must be VEC_X, VEC_Y, VEC_Z or VEC_W
 		float GetVectorComponent();
@@ -12,6 +12,7 @@ namespace Kaimos::MaterialEditor {
 	// ---- Node Pin Base Class ----
 	class NodePin
 	{
+		friend class MaterialGraphProgram;
 	protected:
 
 		// --- Protected Methods (for inheritance to use) ---
@@ -100,6 +101,7 @@ namespace Kaimos::MaterialEditor {
 	// ---- Input Pin Child Class ----
 	class NodeInputPin : public NodePin
 	{
+		friend class MaterialGraphProgram;
 	public:
 
 		// --- Public Class Methods ---
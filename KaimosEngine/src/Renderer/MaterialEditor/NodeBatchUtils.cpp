@@ -0,0 +1,282 @@
+#include "kspch.h"
+#include "NodeBatchUtils.h"
+#include "NodeUtils.h"
+#include "MaterialNodePin.h"
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(__SSE2__)
+	#define KS_NODES_SIMD 1
+	#include <emmintrin.h>
+#else
+	#define KS_NODES_SIMD 0
+#endif
+
+
+namespace Kaimos::MaterialEditor::NodeUtils::Batch {
+
+	// ----------------------- Helpers --------------------------------------------------------------------
+	// Kernels work on a vec4 per SSE register and mask out the components that the data type doesn't use, as the
+	// per-value operations return them as 0. Min/Max/Abs follow the glm comparisons so that results are the same bits
+#if KS_NODES_SIMD
+	static __m128 GetComponentsMask(PinDataType type)
+	{
+		switch (type)
+		{
+			case PinDataType::FLOAT:
+			case PinDataType::INT:		return _mm_castsi128_ps(_mm_set_epi32(0, 0, 0, -1));
+			case PinDataType::VEC2:		return _mm_castsi128_ps(_mm_set_epi32(0, 0, -1, -1));
+			case PinDataType::VEC3:		return _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+			case PinDataType::VEC4:		return _mm_castsi128_ps(_mm_set1_epi32(-1));
+		}
+
+		KS_FATAL_ERROR("Tried to perform a batch operation with a non-supported data type!");
+		return _mm_setzero_ps();
+	}
+
+	static inline __m128 LoadValue(const glm::vec4* value)				{ return _mm_loadu_ps(&value->x); }
+	static inline void StoreValue(glm::vec4* value, __m128 reg)			{ _mm_storeu_ps(&value->x, reg); }
+	static inline __m128 GetSignMask()									{ return _mm_castsi128_ps(_mm_set1_epi32(0x80000000)); }
+#endif
+
+	// Same bits, so that a value can reuse the results of the previous one (-0.0 and 0.0 don't)
+	static inline bool IsSameValue(float a, float b)					{ return std::memcmp(&a, &b, sizeof(float)) == 0; }
+
+
+
+
+	// ----------------------- Data Operations ------------------------------------------------------------
+	// ----------- Basics -----------
+	void SumValues(PinDataType values_type, const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count)
+	{
+	#if KS_NODES_SIMD
+		const __m128 mask = GetComponentsMask(values_type);
+		for (uint i = 0; i < count; ++i)
+			StoreValue(&result[i], _mm_and_ps(_mm_add_ps(LoadValue(&a[i]), LoadValue(&b[i])), mask));
+	#else
+		for (uint i = 0; i < count; ++i)
+			result[i] = NodeUtils::SumValues(values_type, a[i], b[i]);
+	#endif
+	}
+
+	void SubtractValues(PinDataType values_type, const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count)
+	{
+	#if KS_NODES_SIMD
+		const __m128 mask = GetComponentsMask(values_type);
+		for (uint i = 0; i < count; ++i)
+			StoreValue(&result[i], _mm_and_ps(_mm_sub_ps(LoadValue(&a[i]), LoadValue(&b[i])), mask));
+	#else
+		for (uint i = 0; i < count; ++i)
+			result[i] = NodeUtils::SubtractValues(values_type, a[i], b[i]);
+	#endif
+	}
+
+
+	// ---------- Multiply ----------
+	void MultiplyValues(PinDataType values_type, const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count)
+	{
+	#if KS_NODES_SIMD
+		const __m128 mask = GetComponentsMask(values_type);
+		for (uint i = 0; i < count; ++i)
+			StoreValue(&result[i], _mm_and_ps(_mm_mul_ps(LoadValue(&a[i]), LoadValue(&b[i])), mask));
+	#else
+		for (uint i = 0; i < count; ++i)
+			result[i] = NodeUtils::MultiplyValues(values_type, a[i], b[i]);
+	#endif
+	}
+
+	void MultiplyFloatAndVec(const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count, PinDataType a_type, PinDataType b_type)
+	{
+	#if KS_NODES_SIMD
+		// -- Float operand is broadcasted (no components masking, as in the per-value operation) --
+		if (a_type == PinDataType::FLOAT && IsVecType(b_type))
+		{
+			for (uint i = 0; i < count; ++i)
+			{
+				__m128 a_val = LoadValue(&a[i]);
+				StoreValue(&result[i], _mm_mul_ps(_mm_shuffle_ps(a_val, a_val, _MM_SHUFFLE(0, 0, 0, 0)), LoadValue(&b[i])));
+			}
+		}
+		else if (b_type == PinDataType::FLOAT && IsVecType(a_type))
+		{
+			for (uint i = 0; i < count; ++i)
+			{
+				__m128 b_val = LoadValue(&b[i]);
+				StoreValue(&result[i], _mm_mul_ps(_mm_shuffle_ps(b_val, b_val, _MM_SHUFFLE(0, 0, 0, 0)), LoadValue(&a[i])));
+			}
+		}
+		else
+		{
+			for (uint i = 0; i < count; ++i)
+				StoreValue(&result[i], _mm_mul_ps(LoadValue(&a[i]), LoadValue(&b[i])));
+		}
+	#else
+		for (uint i = 0; i < count; ++i)
+			result[i] = NodeUtils::MultiplyFloatAndVec(a[i], b[i], a_type, b_type);
+	#endif
+	}
+
+
+	// ------ Basic Specials --------
+	void AbsoluteValue(PinDataType op_type, const glm::vec4* a, glm::vec4* result, uint count)
+	{
+	#if KS_NODES_SIMD
+		// glm::abs is (x >= 0 ? x : -x)
+		const __m128 mask = GetComponentsMask(op_type), sign = GetSignMask(), zero = _mm_setzero_ps();
+		for (uint i = 0; i < count; ++i)
+		{
+			__m128 value = LoadValue(&a[i]);
+			__m128 positive = _mm_cmpge_ps(value, zero);
+			__m128 abs_value = _mm_or_ps(_mm_and_ps(positive, value), _mm_andnot_ps(positive, _mm_xor_ps(value, sign)));
+			StoreValue(&result[i], _mm_and_ps(abs_value, mask));
+		}
+	#else
+		for (uint i = 0; i < count; ++i)
+			result[i] = NodeUtils::AbsoluteValue(op_type, a[i]);
+	#endif
+	}
+
+	void MinValue(PinDataType op_type, const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count)
+	{
+	#if KS_NODES_SIMD
+		// glm::min(a, b) is (b < a ? b : a), which is _mm_min_ps(b, a)
+		const __m128 mask = GetComponentsMask(op_type);
+		for (uint i = 0; i < count; ++i)
+			StoreValue(&result[i], _mm_and_ps(_mm_min_ps(LoadValue(&b[i]), LoadValue(&a[i])), mask));
+	#else
+		for (uint i = 0; i < count; ++i)
+			result[i] = NodeUtils::MinValue(op_type, a[i], b[i]);
+	#endif
+	}
+
+	void MaxValue(PinDataType op_type, const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count)
+	{
+	#if KS_NODES_SIMD
+		// glm::max(a, b) is (a < b ? b : a), which is _mm_max_ps(b, a)
+		const __m128 mask = GetComponentsMask(op_type);
+		for (uint i = 0; i < count; ++i)
+			StoreValue(&result[i], _mm_and_ps(_mm_max_ps(LoadValue(&b[i]), LoadValue(&a[i])), mask));
+	#else
+		for (uint i = 0; i < count; ++i)
+			result[i] = NodeUtils::MaxValue(op_type, a[i], b[i]);
+	#endif
+	}
+
+	void Negate(PinDataType op_type, const glm::vec4* a, glm::vec4* result, uint count)
+	{
+	#if KS_NODES_SIMD
+		const __m128 mask = GetComponentsMask(op_type), sign = GetSignMask();
+		for (uint i = 0; i < count; ++i)
+			StoreValue(&result[i], _mm_and_ps(_mm_xor_ps(LoadValue(&a[i]), sign), mask));
+	#else
+		for (uint i = 0; i < count; ++i)
+			result[i] = NodeUtils::Negate(op_type, a[i]);
+	#endif
+	}
+
+
+	// ----------- Powers -----------
+	void SqrtValue(PinDataType op_type, const glm::vec4* a, glm::vec4* result, uint count)
+	{
+	#if KS_NODES_SIMD
+		// glm::max(x, 0.0f) is (x < 0 ? 0 : x), which is _mm_max_ps(0, x)
+		const __m128 mask = GetComponentsMask(op_type), zero = _mm_setzero_ps();
+		for (uint i = 0; i < count; ++i)
+			StoreValue(&result[i], _mm_and_ps(_mm_sqrt_ps(_mm_max_ps(zero, LoadValue(&a[i]))), mask));
+	#else
+		for (uint i = 0; i < count; ++i)
+			result[i] = NodeUtils::SqrtValue(op_type, a[i]);
+	#endif
+	}
+
+
+	// -------- Trigonometry --------
+	void Sin(PinDataType op_type, const glm::vec4* a, glm::vec4* result, uint count)
+	{
+		// SSE2 has no sine that gives the glm::sin bits, so the kernel only hoists the dispatch and runs glm::sin per component
+		switch (op_type)
+		{
+			case PinDataType::FLOAT:
+			case PinDataType::INT:
+				for (uint i = 0; i < count; ++i)
+					result[i] = glm::vec4(glm::sin(a[i].x), 0.0f, 0.0f, 0.0f);
+				return;
+			case PinDataType::VEC2:
+				for (uint i = 0; i < count; ++i)
+					result[i] = glm::vec4(glm::sin(a[i].x), glm::sin(a[i].y), 0.0f, 0.0f);
+				return;
+			case PinDataType::VEC3:
+				for (uint i = 0; i < count; ++i)
+					result[i] = glm::vec4(glm::sin(a[i].x), glm::sin(a[i].y), glm::sin(a[i].z), 0.0f);
+				return;
+			case PinDataType::VEC4:
+				for (uint i = 0; i < count; ++i)
+					result[i] = glm::vec4(glm::sin(a[i].x), glm::sin(a[i].y), glm::sin(a[i].z), glm::sin(a[i].w));
+				return;
+		}
+
+		KS_FATAL_ERROR("Tried to perform a non-supported Sinus operation!");
+	}
+
+
+	// --------- Smoothstep ---------
+	void VSmoothstepValue(PinDataType op_type, const glm::vec4* edge1, const glm::vec4* edge2, const glm::vec4* val, glm::vec4* result, uint count)
+	{
+	#if KS_NODES_SIMD
+		if (IsVecType(op_type))
+		{
+			// EnsureDivisor() moves edge2 to edge1 + 1 where they are epsilonEqual(), then glm::smoothstep() is
+			// t = clamp((x - e1) / (e2 - e1), 0, 1) as min(max(t, 0), 1) and t * t * (3 - 2 * t), in that order
+			const __m128 mask = GetComponentsMask(op_type), sign = GetSignMask(), zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+			const __m128 two = _mm_set1_ps(2.0f), three = _mm_set1_ps(3.0f), epsilon = _mm_set1_ps(FLT_EPSILON);
+			for (uint i = 0; i < count; ++i)
+			{
+				__m128 e1 = LoadValue(&edge1[i]), e2 = LoadValue(&edge2[i]);
+				__m128 equal_edges = _mm_cmplt_ps(_mm_andnot_ps(sign, _mm_sub_ps(e2, e1)), epsilon);
+				e2 = _mm_or_ps(_mm_and_ps(equal_edges, _mm_add_ps(e1, one)), _mm_andnot_ps(equal_edges, e2));
+
+				__m128 t = _mm_div_ps(_mm_sub_ps(LoadValue(&val[i]), e1), _mm_sub_ps(e2, e1));
+				t = _mm_min_ps(one, _mm_max_ps(zero, t));
+				__m128 smooth = _mm_mul_ps(_mm_mul_ps(t, t), _mm_sub_ps(three, _mm_mul_ps(two, t)));
+				StoreValue(&result[i], _mm_and_ps(smooth, mask));
+			}
+
+			return;
+		}
+	#endif
+
+		for (uint i = 0; i < count; ++i)
+			result[i] = NodeUtils::VSmoothstepValue(op_type, edge1[i], edge2[i], val[i]);
+	}
+
+
+	// ------ Vector Rotations ------
+	void VectorRotateX(PinDataType op_type, const glm::vec4* a, const glm::vec4* angle, glm::vec4* result, uint count)
+	{
+		if (!IsVecType(op_type))
+		{
+			for (uint i = 0; i < count; ++i)
+				result[i] = NodeUtils::VectorRotateX(op_type, a[i], angle[i].x);
+
+			return;
+		}
+
+		// -- The angle is mostly the same for all the vertices (a uniform), so its sine & cosine are reused while it doesn't change --
+		float last_angle = angle[0].x, angle_cos = glm::cos(last_angle), angle_sin = glm::sin(last_angle);
+		for (uint i = 0; i < count; ++i)
+		{
+			if (!IsSameValue(angle[i].x, last_angle))
+			{
+				last_angle = angle[i].x;
+				angle_cos = glm::cos(last_angle);
+				angle_sin = glm::sin(last_angle);
+			}
+
+			// Same operations than glm::rotateX(), a vec2 being rotated as a vec3 with z = 0 and the w of a vec3 being 0
+			const glm::vec4& value = a[i];
+			float z = op_type == PinDataType::VEC2 ? 0.0f : value.z;
+			float w = op_type == PinDataType::VEC4 ? value.w : 0.0f;
+			result[i] = glm::vec4(value.x, value.y * angle_cos - z * angle_sin, value.y * angle_sin + z * angle_cos, w);
+		}
+	}
+}
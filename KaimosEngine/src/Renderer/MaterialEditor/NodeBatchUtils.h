@@ -0,0 +1,43 @@
+#ifndef _NODEBATCHUTILS_H_
+#define _NODEBATCHUTILS_H_
+
+
+namespace Kaimos::MaterialEditor {
+
+	enum class PinDataType;
+
+	// Batch versions of the NodeUtils operations: they apply the operation over columns of "count" values
+	// (one per vertex) with the data type dispatched once per column, and give the same results than NodeUtils
+	// Operations without a batch kernel are run value by value with NodeUtils by the Material Graph Program
+	namespace NodeUtils::Batch {
+
+		// --- Data Operations ---
+		// - Basics -
+		void SumValues(PinDataType values_type, const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count);
+		void SubtractValues(PinDataType values_type, const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count);
+
+		// - Multiply -
+		void MultiplyValues(PinDataType values_type, const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count);
+		void MultiplyFloatAndVec(const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count, PinDataType a_type, PinDataType b_type);
+
+		// - Basic Specials -
+		void AbsoluteValue(PinDataType op_type, const glm::vec4* a, glm::vec4* result, uint count);
+		void MinValue(PinDataType op_type, const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count);
+		void MaxValue(PinDataType op_type, const glm::vec4* a, const glm::vec4* b, glm::vec4* result, uint count);
+		void Negate(PinDataType op_type, const glm::vec4* a, glm::vec4* result, uint count);
+
+		// - Powers -
+		void SqrtValue(PinDataType op_type, const glm::vec4* a, glm::vec4* result, uint count);
+
+		// - Trigonometry -
+		void Sin(PinDataType op_type, const glm::vec4* a, glm::vec4* result, uint count);
+
+		// - Smoothstep -
+		void VSmoothstepValue(PinDataType op_type, const glm::vec4* edge1, const glm::vec4* edge2, const glm::vec4* val, glm::vec4* result, uint count);
+
+		// - Vector Rotations -
+		void VectorRotateX(PinDataType op_type, const glm::vec4* a, const glm::vec4* angle, glm::vec4* result, uint count);
+	}
+}
+
+#endif //_NODEBATCHUTILS_H_
@@ -0,0 +1,11 @@
+#include "kspch.h"
+#include "NullContext.h"
+
+namespace Kaimos {
+
+	// ----------------------- Public Class Methods ----------------------------------------------------------
+	void NullContext::Init()
+	{
+		KS_ENGINE_INFO("--- Null Context Initialized (headless) ---");
+	}
+}
@@ -0,0 +1,21 @@
+#ifndef _NULLCONTEXT_H_
+#define _NULLCONTEXT_H_
+
+#include "Renderer/Foundations/GraphicsContext.h"
+
+namespace Kaimos {
+
+	// Context of the headless backend, there's no window surface to present to
+	class NullContext : public GraphicsContext
+	{
+	public:
+
+		// --- Public Class Methods ---
+		virtual void Init() override;
+
+		// --- Public RendererAPI Methods ---
+		virtual void SwapBuffers() override {}
+	};
+}
+
+#endif //_NULLCONTEXT_H_
@@ -0,0 +1,75 @@
+#include "kspch.h"
+#include "NullRendererAPI.h"
+
+namespace Kaimos {
+
+	// ----------------------- Globals -----------------------------------------------------------------------
+	static NullRendererAPI::Statistics s_NullStats = {};
+
+
+
+	// ----------------------- Commands Recorded -------------------------------------------------------------
+	const NullRendererAPI::Statistics& NullRendererAPI::GetStats()
+	{
+		return s_NullStats;
+	}
+
+	void NullRendererAPI::ResetStats()
+	{
+		s_NullStats = {};
+	}
+
+	NullRendererAPI::Statistics& NullRendererAPI::GetRecordedStats()
+	{
+		return s_NullStats;
+	}
+
+
+
+	// ----------------------- Public Class Methods ----------------------------------------------------------
+	void NullRendererAPI::Init()
+	{
+		KS_TRACE("Initializing Null Renderer API (headless, no GPU commands are issued)");
+		ResetStats();
+	}
+
+
+
+	// ----------------------- Public RendererAPI Methods ----------------------------------------------------
+	void NullRendererAPI::Clear() const
+	{
+		++s_NullStats.Clears;
+	}
+
+	void NullRendererAPI::DrawIndexed(const Ref<VertexArray>& vertex_array, uint index_count) const
+	{
+		uint count = index_count ? index_count : vertex_array->GetIndexBuffer()->GetCount();
+		++s_NullStats.DrawCalls;
+		s_NullStats.IndicesDrawn += count;
+	}
+
+	void NullRendererAPI::DrawIndexedBaseVertex(const Ref<VertexArray>& vertex_array, uint index_count, uint first_index, uint base_vertex) const
+	{
+		++s_NullStats.DrawCalls;
+		s_NullStats.IndicesDrawn += index_count;
+	}
+
+	void NullRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertex_array, uint index_count, uint instance_count, uint base_instance) const
+	{
+		uint count = index_count ? index_count : vertex_array->GetIndexBuffer()->GetCount();
+		++s_NullStats.DrawCalls;
+		s_NullStats.IndicesDrawn += count * instance_count;
+		s_NullStats.InstancesDrawn += instance_count;
+	}
+
+	void NullRendererAPI::DrawUnindexed(const Ref<VertexArray>& vertex_array, uint count) const
+	{
+		++s_NullStats.DrawCalls;
+		s_NullStats.VerticesDrawn += count;
+	}
+
+	void NullRendererAPI::SetViewport(uint x, uint y, uint width, uint height)
+	{
+		++s_NullStats.ViewportChanges;
+	}
+}
@@ -0,0 +1,53 @@
+#ifndef _NULLRENDERERAPI_H_
+#define _NULLRENDERERAPI_H_
+
+#include "Renderer/Foundations/RendererAPI.h"
+
+namespace Kaimos {
+
+	// Headless backend: the commands (and the ones of the null resources) are only counted, nothing touches a GPU
+	// It lets the CPU side of the frames (culling, batching, material graphs...) run and be measured without a window or GL context
+	class NullRendererAPI : public RendererAPI
+	{
+	public:
+
+		// --- Commands Recorded ---
+		struct Statistics
+		{
+			uint DrawCalls = 0, IndicesDrawn = 0, VerticesDrawn = 0, InstancesDrawn = 0;
+			uint Clears = 0, ViewportChanges = 0;
+			uint ShaderBinds = 0, UniformsSet = 0, TextureBinds = 0, FramebufferBinds = 0;
+			uint BuffersCreated = 0, TexturesCreated = 0;
+
+			uint64_t BufferBytesUploaded = 0, TextureBytesUploaded = 0;
+			uint64_t StreamedBytes = 0;		// Committed in streaming buffers
+		};
+
+		static const Statistics& GetStats();
+		static void ResetStats();
+		static Statistics& GetRecordedStats();	// The null resources add their commands here
+
+	public:
+
+		// --- Public Class Methods ---
+		virtual void Init() override;
+
+		// --- Public RendererAPI Methods ---
+		virtual void EnableDepth() const override {}
+		virtual void EnableCubemapFiltering() const override {}
+
+		virtual void SetClearColor(const glm::vec4& color) const override {}
+		virtual void Clear() const override;
+
+		virtual void DrawIndexed(const Ref<VertexArray>& vertex_array, uint index_count = 0) const override;
+		virtual void DrawIndexedBaseVertex(const Ref<VertexArray>& vertex_array, uint index_count, uint first_index, uint base_vertex) const override;
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertex_array, uint index_count, uint instance_count, uint base_instance = 0) const override;
+		virtual void DrawUnindexed(const Ref<VertexArray>& vertex_array, uint count) const override;
+		virtual void SetViewport(uint x, uint y, uint width, uint height) override;
+
+		// --- Capabilities ---
+		virtual bool SupportsBindlessTextures() const override { return false; }
+	};
+}
+
+#endif //_NULLRENDERERAPI_H_
@@ -0,0 +1,183 @@
+#include "kspch.h"
+#include "NullBuffer.h"
+
+#include "Renderer/Null/NullRendererAPI.h"
+
+namespace Kaimos {
+
+	// ----------------------- Globals -----------------------------------------------------------------------
+	// Fences of the streaming buffers rings, there's no GPU reading them so they are always signaled
+	class NullRingFences : public RingFences
+	{
+	public:
+
+		virtual uint64_t Insert() override					{ return ++m_LastFence; }
+		virtual bool IsSignaled(uint64_t fence) override	{ return true; }
+		virtual bool Wait(uint64_t fence) override			{ return false; }
+		virtual void Release(uint64_t fence) override		{}
+
+	private:
+
+		uint64_t m_LastFence = 0;
+	};
+
+	static void RecordBufferUpload(uint size)
+	{
+		NullRendererAPI::GetRecordedStats().BufferBytesUploaded += size;
+	}
+
+
+
+	// ---------------------------- VERTEX BUFFER ------------------------------------------------------------
+	// ----------------------- Public Class Methods ----------------------------------------------------------
+	NullVertexBuffer::NullVertexBuffer(float* vertices, uint size)
+	{
+		++NullRendererAPI::GetRecordedStats().BuffersCreated;
+		RecordBufferUpload(size);
+	}
+
+	NullVertexBuffer::NullVertexBuffer(uint size, bool streaming)
+	{
+		++NullRendererAPI::GetRecordedStats().BuffersCreated;
+		if (streaming)
+		{
+			m_StreamingData.resize(size);
+			m_Ring = CreateScopePtr<RingAllocator>(size, CreateScopePtr<NullRingFences>());
+		}
+	}
+
+
+
+	// ----------------------- Streaming Methods -------------------------------------------------------------
+	void* NullVertexBuffer::Reserve(uint size, uint alignment)
+	{
+		KS_ENGINE_ASSERT(m_Ring, "Reserving memory of a non-streaming Vertex Buffer!");
+		uint offset = m_Ring->Reserve(size, alignment);
+		return offset == UINT_MAX ? nullptr : m_StreamingData.data() + offset;
+	}
+
+	uint NullVertexBuffer::Commit(uint size)
+	{
+		KS_ENGINE_ASSERT(m_Ring, "Committing memory of a non-streaming Vertex Buffer!");
+		NullRendererAPI::GetRecordedStats().StreamedBytes += size;
+		return m_Ring->Commit(size);
+	}
+
+	void NullVertexBuffer::Retire()
+	{
+		KS_ENGINE_ASSERT(m_Ring, "Retiring memory of a non-streaming Vertex Buffer!");
+		m_Ring->Retire();
+	}
+
+
+
+	// ----------------------- Getters/Setters ---------------------------------------------------------------
+	void NullVertexBuffer::SetData(const void* data, uint size)
+	{
+		RecordBufferUpload(size);
+	}
+
+
+
+	// ---------------------------- INDEX BUFFER -------------------------------------------------------------
+	// ----------------------- Public Class Methods ----------------------------------------------------------
+	NullIndexBuffer::NullIndexBuffer(uint* indices, uint count)
+		: m_Count(count)
+	{
+		++NullRendererAPI::GetRecordedStats().BuffersCreated;
+		RecordBufferUpload(count * sizeof(uint));
+	}
+
+	NullIndexBuffer::NullIndexBuffer(uint count, bool streaming)
+		: m_Count(count)
+	{
+		++NullRendererAPI::GetRecordedStats().BuffersCreated;
+		if (streaming)
+		{
+			m_StreamingData.resize(count);
+			m_Ring = CreateScopePtr<RingAllocator>(count * sizeof(uint), CreateScopePtr<NullRingFences>());
+		}
+	}
+
+
+
+	// ----------------------- Streaming Methods -------------------------------------------------------------
+	uint* NullIndexBuffer::Reserve(uint count)
+	{
+		KS_ENGINE_ASSERT(m_Ring, "Reserving memory of a non-streaming Index Buffer!");
+		uint offset = m_Ring->Reserve(count * sizeof(uint), sizeof(uint));
+		return offset == UINT_MAX ? nullptr : m_StreamingData.data() + offset / sizeof(uint);
+	}
+
+	uint NullIndexBuffer::Commit(uint count)
+	{
+		KS_ENGINE_ASSERT(m_Ring, "Committing memory of a non-streaming Index Buffer!");
+		NullRendererAPI::GetRecordedStats().StreamedBytes += count * sizeof(uint);
+		return m_Ring->Commit(count * sizeof(uint)) / sizeof(uint);
+	}
+
+	void NullIndexBuffer::Retire()
+	{
+		KS_ENGINE_ASSERT(m_Ring, "Retiring memory of a non-streaming Index Buffer!");
+		m_Ring->Retire();
+	}
+
+
+
+	// ----------------------- Getters/Setters ---------------------------------------------------------------
+	void NullIndexBuffer::SetData(const void* data, uint count)
+	{
+		RecordBufferUpload(count * sizeof(uint));
+	}
+
+
+
+	// ---------------------------- UNIFORM BUFFER -----------------------------------------------------------
+	// ----------------------- Public Class Methods ----------------------------------------------------------
+	NullUniformBuffer::NullUniformBuffer(uint size, uint binding)
+		: m_Binding(binding)
+	{
+		++NullRendererAPI::GetRecordedStats().BuffersCreated;
+	}
+
+
+
+	// ----------------------- Getters/Setters ---------------------------------------------------------------
+	void NullUniformBuffer::SetData(const void* data, uint size, uint offset)
+	{
+		RecordBufferUpload(size);
+	}
+
+
+
+	// ---------------------------- STORAGE BUFFER -----------------------------------------------------------
+	// ----------------------- Public Class Methods ----------------------------------------------------------
+	NullStorageBuffer::NullStorageBuffer(uint size, uint binding)
+		: m_Binding(binding)
+	{
+		++NullRendererAPI::GetRecordedStats().BuffersCreated;
+	}
+
+
+
+	// ----------------------- Getters/Setters ---------------------------------------------------------------
+	void NullStorageBuffer::SetData(const void* data, uint size, uint offset)
+	{
+		RecordBufferUpload(size);
+	}
+
+
+
+	// ---------------------------- VERTEX ARRAY -------------------------------------------------------------
+	// ----------------------- Public Vertex Array Methods ---------------------------------------------------
+	void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertex_buffer)
+	{
+		KS_ENGINE_ASSERT(vertex_buffer->GetLayout().GetElements().size(), "VBuffer has no layout!");
+		m_VertexBuffers.push_back(vertex_buffer);
+	}
+
+	void NullVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& index_buffer)
+	{
+		m_IndexBuffer = index_buffer;
+	}
+}
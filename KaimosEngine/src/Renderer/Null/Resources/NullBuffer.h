@@ -0,0 +1,142 @@
+#ifndef _NULLBUFFER_H_
+#define _NULLBUFFER_H_
+
+#include "Renderer/Resources/Buffer.h"
+#include "Renderer/Resources/RingAllocator.h"
+
+namespace Kaimos {
+
+	// ---- VERTEX BUFFER ----
+	// Streaming ones keep their ring in CPU memory, as the renderer writes the vertices straight into it
+	class NullVertexBuffer : public VertexBuffer
+	{
+	public:
+
+		// --- Public Class Methods ---
+		NullVertexBuffer(float* vertices, uint size);
+		NullVertexBuffer(uint size, bool streaming = false);
+
+		// --- Public Vertex Buffer Methods ---
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		// --- Streaming Methods ---
+		virtual void* Reserve(uint size, uint alignment = 1) override;
+		virtual uint Commit(uint size) override;
+		virtual void Retire() override;
+
+		// --- Getters/Setters ---
+		virtual const BufferLayout& GetLayout()				const override	{ return m_Layout; }
+		virtual void SetLayout(const BufferLayout& layout)	override		{ m_Layout = layout; }
+
+		virtual void SetData(const void* data, uint size)	override;
+
+	private:
+
+		BufferLayout m_Layout;
+
+		// Streaming
+		std::vector<uint8_t> m_StreamingData;
+		ScopePtr<RingAllocator> m_Ring = nullptr;
+	};
+
+
+
+	// ---- INDEX BUFFER ----
+	class NullIndexBuffer : public IndexBuffer
+	{
+	public:
+
+		// --- Public Class Methods ---
+		NullIndexBuffer(uint* indices, uint count);
+		NullIndexBuffer(uint count, bool streaming = false);
+
+		// --- Public Index Buffer Methods ---
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		// --- Streaming Methods ---
+		virtual uint* Reserve(uint count) override;
+		virtual uint Commit(uint count) override;
+		virtual void Retire() override;
+
+		// -- Getters/Setters --
+		virtual uint GetCount() const { return m_Count; }
+		virtual void SetData(const void* data, uint count) override;
+
+	private:
+
+		uint m_Count = 0;
+
+		// Streaming
+		std::vector<uint> m_StreamingData;
+		ScopePtr<RingAllocator> m_Ring = nullptr;
+	};
+
+
+
+	// ---- UNIFORM BUFFER ----
+	class NullUniformBuffer : public UniformBuffer
+	{
+	public:
+
+		// --- Public Class Methods ---
+		NullUniformBuffer(uint size, uint binding);
+
+		// --- Getters/Setters ---
+		virtual uint GetBinding() const override { return m_Binding; }
+		virtual void SetData(const void* data, uint size, uint offset = 0) override;
+
+	private:
+
+		uint m_Binding = 0;
+	};
+
+
+
+	// ---- STORAGE BUFFER ----
+	class NullStorageBuffer : public StorageBuffer
+	{
+	public:
+
+		// --- Public Class Methods ---
+		NullStorageBuffer(uint size, uint binding);
+
+		// --- Public Storage Buffer Methods ---
+		virtual void Bind() const override {}
+
+		// --- Getters/Setters ---
+		virtual uint GetBinding() const override { return m_Binding; }
+		virtual void SetData(const void* data, uint size, uint offset = 0) override;
+
+	private:
+
+		uint m_Binding = 0;
+	};
+
+
+
+	// ---- VERTEX ARRAY ----
+	class NullVertexArray : public VertexArray
+	{
+	public:
+
+		// --- Public Vertex Array Methods ---
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertex_buffer) override;
+		virtual void SetIndexBuffer(const Ref<IndexBuffer>& index_buffer) override;
+
+		// --- Getters ---
+		inline virtual const Ref<IndexBuffer>& GetIndexBuffer()					const override { return m_IndexBuffer; }
+		inline virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers()	const override { return m_VertexBuffers; }
+
+	private:
+
+		Ref<IndexBuffer> m_IndexBuffer = nullptr;
+		std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+	};
+}
+
+#endif //_NULLBUFFER_H_
@@ -0,0 +1,33 @@
+#include "kspch.h"
+#include "NullFramebuffer.h"
+
+#include "Renderer/Null/NullRendererAPI.h"
+
+namespace Kaimos {
+
+	// ----------------------- Public Class Methods ----------------------------------------------------------
+	NullFramebuffer::NullFramebuffer(const FramebufferSettings& settings)
+		: m_FBOSettings(settings)
+	{
+	}
+
+
+
+	// ----------------------- Public FBO Methods ------------------------------------------------------------
+	void NullFramebuffer::Bind(uint width, uint height)
+	{
+		++NullRendererAPI::GetRecordedStats().FramebufferBinds;
+	}
+
+	void NullFramebuffer::Resize(uint width, uint height, bool generate_depth_renderbuffer)
+	{
+		if (width == 0 || height == 0)
+		{
+			KS_ENGINE_WARN("Warning: Tried to resize FBO to {0}x{1}, aborting operation", width, height);
+			return;
+		}
+
+		m_FBOSettings.Width = width;
+		m_FBOSettings.Height = height;
+	}
+}
@@ -0,0 +1,41 @@
+#ifndef _NULLFRAMEBUFFER_H_
+#define _NULLFRAMEBUFFER_H_
+
+#include "Renderer/Resources/Framebuffer.h"
+
+namespace Kaimos {
+
+	// Framebuffer without attachments, it only keeps its settings (size) updated, and reading it gives no entity
+	class NullFramebuffer : public Framebuffer
+	{
+	public:
+
+		// --- Public Class Methods ---
+		NullFramebuffer(const FramebufferSettings& settings);
+
+		// --- Public FBO Methods ---
+		virtual void Bind(uint width = 0, uint height = 0) override;
+		virtual void Unbind() override {}
+
+		virtual void Resize(uint width, uint height, bool generate_depth_renderbuffer = false) override;
+		virtual void ClearFBOTexture(uint index, int value) override {}
+		virtual void AttachColorTexture(TEXTURE_TARGET target, uint target_index, uint texture_id, uint mip_level = 0) override {}
+		virtual void CreateAndAttachRedTexture(uint target_index, uint width, uint height) override {}
+
+		virtual void ResizeAndBindRenderBuffer(uint width, uint height) override {}
+
+	public:
+
+		// --- Getters ---
+		virtual int GetPixelFromFBO(uint index, int x, int y) override		{ return -1; }
+		virtual uint GetFBOTextureID(uint index = 0) const override		{ return 0; }
+
+		virtual const FramebufferSettings& GetFBOSettings() const override { return m_FBOSettings; }
+
+	private:
+
+		FramebufferSettings m_FBOSettings;
+	};
+}
+
+#endif //_NULLFRAMEBUFFER_H_
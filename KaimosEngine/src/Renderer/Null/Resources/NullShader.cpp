@@ -0,0 +1,52 @@
+#include "kspch.h"
+#include "NullShader.h"
+
+#include "Renderer/Null/NullRendererAPI.h"
+
+namespace Kaimos {
+
+	// ----------------------- Public Class Methods ----------------------------------------------------------
+	NullShader::NullShader(const std::string& name)
+		: m_Name(name)
+	{
+	}
+
+
+
+	// ----------------------- Public Shader Methods ---------------------------------------------------------
+	void NullShader::Bind() const
+	{
+		++NullRendererAPI::GetRecordedStats().ShaderBinds;
+	}
+
+
+
+	// ----------------------- Uniforms ----------------------------------------------------------------------
+	UniformHandle NullShader::GetUniformHandle(const std::string& name)
+	{
+		auto it = m_UniformIndices.find(name);
+		if (it != m_UniformIndices.end())
+			return { it->second };
+
+		int index = (int)m_UniformIndices.size();
+		m_UniformIndices.insert({ name, index });
+		return { index };
+	}
+
+	void NullShader::SetUniformFloat(UniformHandle uniform, float value)						{ RecordUniform(uniform); }
+	void NullShader::SetUniformFloat2(UniformHandle uniform, const glm::vec2& value)			{ RecordUniform(uniform); }
+	void NullShader::SetUniformFloat3(UniformHandle uniform, const glm::vec3& value)			{ RecordUniform(uniform); }
+	void NullShader::SetUniformFloat4(UniformHandle uniform, const glm::vec4& value)			{ RecordUniform(uniform); }
+	void NullShader::SetUniformMat4(UniformHandle uniform, const glm::mat4& value)				{ RecordUniform(uniform); }
+	void NullShader::SetUniformInt(UniformHandle uniform, int value)							{ RecordUniform(uniform); }
+	void NullShader::SetUniformIntArray(UniformHandle uniform, int* values_array, uint size)	{ RecordUniform(uniform); }
+
+
+
+	// ----------------------- Private Null Shader Methods ---------------------------------------------------
+	void NullShader::RecordUniform(UniformHandle uniform) const
+	{
+		if (uniform.IsValid())
+			++NullRendererAPI::GetRecordedStats().UniformsSet;
+	}
+}
@@ -0,0 +1,57 @@
+#ifndef _NULLSHADER_H_
+#define _NULLSHADER_H_
+
+#include "Renderer/Resources/Shader.h"
+
+namespace Kaimos {
+
+	// Shader with nothing to compile, any uniform name resolves to a valid handle so the callers caching them work as with a real one
+	class NullShader : public Shader
+	{
+	public:
+
+		// --- Public Class Methods ---
+		NullShader(const std::string& name);
+
+		// --- Public Shader Methods ---
+		virtual void Bind() const override;
+		virtual void Unbind() const override {}
+
+		// --- Getters ---
+		inline virtual const std::string& GetName() const override { return m_Name; }
+
+	public:
+
+		// --- Uniforms ---
+		virtual UniformHandle GetUniformHandle(const std::string& name)								override;
+
+		virtual void SetUniformFloat(UniformHandle uniform, float value)							override;
+		virtual void SetUniformFloat2(UniformHandle uniform, const glm::vec2& value)				override;
+		virtual void SetUniformFloat3(UniformHandle uniform, const glm::vec3& value)				override;
+		virtual void SetUniformFloat4(UniformHandle uniform, const glm::vec4& value)				override;
+		virtual void SetUniformMat4(UniformHandle uniform, const glm::mat4& value)					override;
+		virtual void SetUniformInt(UniformHandle uniform, int value)								override;
+		virtual void SetUniformIntArray(UniformHandle uniform, int* values_array, uint size)		override;
+
+		// Keep the by-name setters visible
+		using Shader::SetUniformFloat;
+		using Shader::SetUniformFloat2;
+		using Shader::SetUniformFloat3;
+		using Shader::SetUniformFloat4;
+		using Shader::SetUniformMat4;
+		using Shader::SetUniformInt;
+		using Shader::SetUniformIntArray;
+
+	private:
+
+		// --- Private Null Shader Methods ---
+		void RecordUniform(UniformHandle uniform) const;
+
+	private:
+
+		std::string m_Name = "Unnamed Shader";
+		std::unordered_map<std::string, int> m_UniformIndices;	// Name & handle index
+	};
+}
+
+#endif //_NULLSHADER_H_
@@ -0,0 +1,111 @@
+#include "kspch.h"
+#include "NullTexture.h"
+
+#include "Renderer/Null/NullRendererAPI.h"
+
+namespace Kaimos {
+
+	// ----------------------- Globals -----------------------------------------------------------------------
+	static uint s_LastTextureID = 0;
+
+	static uint CreateTextureID()
+	{
+		++NullRendererAPI::GetRecordedStats().TexturesCreated;
+		return ++s_LastTextureID;
+	}
+
+	static void RecordTextureBind()
+	{
+		++NullRendererAPI::GetRecordedStats().TextureBinds;
+	}
+
+
+
+	// ---------------------------- TEXTURE 2D ---------------------------------------------------------------
+	// ----------------------- Public Class Methods ----------------------------------------------------------
+	NullTexture2D::NullTexture2D(uint width, uint height)
+	{
+		m_ID = CreateTextureID();
+		m_Width = width;
+		m_Height = height;
+	}
+
+	NullTexture2D::NullTexture2D(const std::string& filepath)
+		: m_Filepath(filepath)
+	{
+		m_ID = CreateTextureID();
+		Ref<TextureData> data = TextureData::Load(filepath);
+		if (!data)
+			return;
+
+		m_Width = data->GetWidth();
+		m_Height = data->GetHeight();
+		m_Channels = data->GetChannels();
+		NullRendererAPI::GetRecordedStats().TextureBytesUploaded += GetMemorySize();
+	}
+
+	NullTexture2D::NullTexture2D(const TextureData& data)
+		: m_Filepath(data.GetFilepath())
+	{
+		m_ID = CreateTextureID();
+		m_Width = data.GetWidth();
+		m_Height = data.GetHeight();
+		m_Channels = data.GetChannels();
+		NullRendererAPI::GetRecordedStats().TextureBytesUploaded += GetMemorySize();
+	}
+
+
+
+	// ----------------------- Public Texture Methods --------------------------------------------------------
+	void NullTexture2D::SetData(void* data, uint size)
+	{
+		KS_ENGINE_ASSERT(size == GetMemorySize(), "Data must be entire texture!");
+		NullRendererAPI::GetRecordedStats().TextureBytesUploaded += size;
+	}
+
+	void NullTexture2D::Bind(uint slot) const
+	{
+		RecordTextureBind();
+	}
+
+
+
+	// ---------------------------- OTHER TEXTURES -----------------------------------------------------------
+	// ----------------------- Public Class Methods ----------------------------------------------------------
+	NullHDRTexture2D::NullHDRTexture2D(const std::string& filepath)
+		: m_Filepath(filepath)
+	{
+		m_ID = CreateTextureID();
+	}
+
+	NullLUTTexture::NullLUTTexture(uint size)
+	{
+		m_ID = CreateTextureID();
+		m_Width = m_Height = size;
+	}
+
+	NullCubemapTexture::NullCubemapTexture(uint width, uint height)
+	{
+		m_ID = CreateTextureID();
+		m_Width = width;
+		m_Height = height;
+	}
+
+
+
+	// ----------------------- Public Texture Methods --------------------------------------------------------
+	void NullHDRTexture2D::Bind(uint slot) const
+	{
+		RecordTextureBind();
+	}
+
+	void NullLUTTexture::Bind(uint slot) const
+	{
+		RecordTextureBind();
+	}
+
+	void NullCubemapTexture::Bind(uint slot) const
+	{
+		RecordTextureBind();
+	}
+}
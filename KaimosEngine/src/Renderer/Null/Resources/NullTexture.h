@@ -0,0 +1,72 @@
+#ifndef _NULLTEXTURE_H_
+#define _NULLTEXTURE_H_
+
+#include "Renderer/Resources/Texture.h"
+
+namespace Kaimos {
+
+	// Null textures get a unique ID (the renderer tells textures apart by it) and the size of what they'd hold, but no pixels
+	class NullTexture2D : public Texture2D
+	{
+	public:
+
+		// --- Public Class Methods ---
+		NullTexture2D(uint width, uint height);
+		NullTexture2D(const std::string& filepath);		// The image is still decoded, to know its size
+		NullTexture2D(const TextureData& data);
+
+		// --- Public Texture Methods ---
+		virtual void SetData(void* data, uint size)	override;
+		virtual void Bind(uint slot = 0)			const override;
+
+		// --- Getters ---
+		virtual const std::string GetFilepath()	const override { return m_Filepath; }
+		virtual uint64_t GetMemorySize()		const override { return (uint64_t)m_Width * m_Height * m_Channels; }
+		virtual uint64_t GetBindlessHandle()	override { return 0; }
+
+	private:
+
+		std::string m_Filepath = "";
+		uint m_Channels = 4;
+	};
+
+
+
+	class NullHDRTexture2D : public HDRTexture2D
+	{
+	public:
+
+		// --- Public Class Methods ---
+		NullHDRTexture2D(const std::string& filepath);
+
+		// --- Public Texture Methods ---
+		virtual void Bind(uint slot = 0)			const override;
+		virtual const std::string GetFilepath()	const override { return m_Filepath; }
+
+	private:
+
+		std::string m_Filepath = "";
+	};
+
+
+
+	class NullLUTTexture : public LUTTexture
+	{
+	public:
+		NullLUTTexture(uint size);
+		virtual void Bind(uint slot = 0) const override;
+	};
+
+
+
+	class NullCubemapTexture : public CubemapTexture
+	{
+	public:
+
+		NullCubemapTexture(uint width, uint height);
+		virtual void Bind(uint slot = 0) const override;
+		virtual void GenerateMipMap() const override {}
+	};
+}
+
+#endif //_NULLTEXTURE_H_
@@ -1,5 +1,6 @@
 #include "kspch.h"
 #include "OGLContext.h"
+#include "OGLExtensions.h"
 
 #include <GLFW/glfw3.h>
 #include <glad/glad.h>
@@ -29,6 +30,9 @@ namespace Kaimos {
 		glGetIntegerv(GL_MAJOR_VERSION, &v_maj);
 		glGetIntegerv(GL_MINOR_VERSION, &v_min);
 		KS_ENGINE_ASSERT((v_maj == 4 && v_min <= 6), "Wrong OpenGL version!");
+
+		// -- Optional Extensions Loading --
+		OGLExtensions::LoadExtensions((void* (*)(const char*))glfwGetProcAddress);
 	}
 
 
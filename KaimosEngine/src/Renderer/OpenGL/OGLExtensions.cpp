@@ -0,0 +1,69 @@
+#include "kspch.h"
+#include "OGLExtensions.h"
+
+#include <glad/glad.h>
+
+namespace Kaimos {
+
+	// ----------------------- Globals --------------------------------------------------------------------
+	typedef GLuint64 (APIENTRY* PFN_GetTextureHandleARB)(GLuint texture);
+	typedef void (APIENTRY* PFN_MakeTextureHandleResidentARB)(GLuint64 handle);
+	typedef void (APIENTRY* PFN_MakeTextureHandleNonResidentARB)(GLuint64 handle);
+
+	static PFN_GetTextureHandleARB s_GetTextureHandle = nullptr;
+	static PFN_MakeTextureHandleResidentARB s_MakeTextureHandleResident = nullptr;
+	static PFN_MakeTextureHandleNonResidentARB s_MakeTextureHandleNonResident = nullptr;
+
+	bool OGLExtensions::s_BindlessTextures = false;
+
+	static bool IsExtensionSupported(const char* extension_name)
+	{
+		GLint extensions_count = 0;
+		glGetIntegerv(GL_NUM_EXTENSIONS, &extensions_count);
+
+		for (GLint i = 0; i < extensions_count; ++i)
+			if (strcmp((const char*)glGetStringi(GL_EXTENSIONS, i), extension_name) == 0)
+				return true;
+
+		return false;
+	}
+
+
+
+	// ----------------------- Public Class Methods -------------------------------------------------------
+	void OGLExtensions::LoadExtensions(void* (*get_proc_address)(const char* name))
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- ARB_bindless_texture --
+		if (IsExtensionSupported("GL_ARB_bindless_texture"))
+		{
+			s_GetTextureHandle = (PFN_GetTextureHandleARB)get_proc_address("glGetTextureHandleARB");
+			s_MakeTextureHandleResident = (PFN_MakeTextureHandleResidentARB)get_proc_address("glMakeTextureHandleResidentARB");
+			s_MakeTextureHandleNonResident = (PFN_MakeTextureHandleNonResidentARB)get_proc_address("glMakeTextureHandleNonResidentARB");
+			s_BindlessTextures = s_GetTextureHandle && s_MakeTextureHandleResident && s_MakeTextureHandleNonResident;
+		}
+
+		KS_TRACE("OpenGL Bindless Textures: {0}", s_BindlessTextures ? "Supported" : "Not Supported");
+	}
+
+
+
+	// ----------------------- ARB_bindless_texture -------------------------------------------------------
+	uint64_t OGLExtensions::GetResidentTextureHandle(uint texture_id)
+	{
+		if (!s_BindlessTextures)
+			return 0;
+
+		// Texture parameters & storage can't change anymore after this (its data can)
+		GLuint64 handle = s_GetTextureHandle(texture_id);
+		s_MakeTextureHandleResident(handle);
+		return handle;
+	}
+
+	void OGLExtensions::ReleaseTextureHandle(uint64_t handle)
+	{
+		if (s_BindlessTextures && handle != 0)
+			s_MakeTextureHandleNonResident(handle);
+	}
+}
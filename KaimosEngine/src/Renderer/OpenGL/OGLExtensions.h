@@ -0,0 +1,26 @@
+#ifndef _OGLEXTENSIONS_H_
+#define _OGLEXTENSIONS_H_
+
+namespace Kaimos {
+
+	// ---- OpenGL Extensions not loaded by Glad ----
+	// Loaded on context creation if the driver exposes them, so check their availability before using them
+	class OGLExtensions
+	{
+	public:
+
+		// --- Public Class Methods ---
+		static void LoadExtensions(void* (*get_proc_address)(const char* name));
+
+		// --- ARB_bindless_texture ---
+		static bool HasBindlessTextures() { return s_BindlessTextures; }
+		static uint64_t GetResidentTextureHandle(uint texture_id);	// Handle of the texture, made resident so shaders can sample it
+		static void ReleaseTextureHandle(uint64_t handle);			// Call it before deleting the texture
+
+	private:
+
+		static bool s_BindlessTextures;
+	};
+}
+
+#endif //_OGLEXTENSIONS_H_
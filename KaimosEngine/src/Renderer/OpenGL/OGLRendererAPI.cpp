@@ -1,5 +1,6 @@
 #include "kspch.h"
 #include "OGLRendererAPI.h"
+#include "OGLExtensions.h"
 
 #include <glad/glad.h>
 
@@ -86,6 +87,19 @@ namespace Kaimos {
 		//glBindTexture(GL_TEXTURE_2D, 0); // TODO/OJU: Should we actually do this? Take it into account on materials system/3D Renderer
 	}
 
+	void OGLRendererAPI::DrawIndexedBaseVertex(const Ref<VertexArray>& vertex_array, uint index_count, uint first_index, uint base_vertex) const
+	{
+		// Draws a range of the index buffer, with its indices offset by base_vertex (for streamed batches in a bigger buffer)
+		glDrawElementsBaseVertex(GL_TRIANGLES, index_count, GL_UNSIGNED_INT, (const void*)(first_index * sizeof(uint)), (GLint)base_vertex);
+	}
+
+	void OGLRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertex_array, uint index_count, uint instance_count, uint base_instance) const
+	{
+		// Base instance offsets the per-instance attributes, so several instance ranges can live in the same buffer
+		uint count = index_count ? index_count : vertex_array->GetIndexBuffer()->GetCount();
+		glDrawElementsInstancedBaseInstance(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, instance_count, base_instance);
+	}
+
 	void OGLRendererAPI::DrawUnindexed(const Ref<VertexArray>& vertex_array, uint count) const
 	{
 		glDrawArrays(GL_TRIANGLES, 0, count);
@@ -95,4 +109,12 @@ namespace Kaimos {
 	{
 		glViewport(x, y, width, height);
 	}
+
+
+
+	// ----------------------- Capabilities ---------------------------------------------------------------
+	bool OGLRendererAPI::SupportsBindlessTextures() const
+	{
+		return OGLExtensions::HasBindlessTextures();
+	}
 }
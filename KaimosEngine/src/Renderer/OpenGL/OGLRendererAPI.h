@@ -20,8 +20,13 @@ namespace Kaimos {
 		virtual void Clear() const override;
 
 		virtual void DrawIndexed(const Ref<VertexArray>& vertex_array, uint index_count = 0) const override;
+		virtual void DrawIndexedBaseVertex(const Ref<VertexArray>& vertex_array, uint index_count, uint first_index, uint base_vertex) const override;
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertex_array, uint index_count, uint instance_count, uint base_instance = 0) const override;
 		virtual void DrawUnindexed(const Ref<VertexArray>& vertex_array, uint count) const override;
 		virtual void SetViewport(uint x, uint y, uint width, uint height) override;
+
+		// --- Capabilities ---
+		virtual bool SupportsBindlessTextures() const override;
 	};
 }
 
@@ -21,13 +21,71 @@ namespace Kaimos {
 			case SHADER_DATATYPE::INT2:			return GL_INT;
 			case SHADER_DATATYPE::INT3:			return GL_INT;
 			case SHADER_DATATYPE::INT4:			return GL_INT;
+			case SHADER_DATATYPE::UINT:			return GL_UNSIGNED_INT;
 			case SHADER_DATATYPE::BOOL:			return GL_BOOL;
+			case SHADER_DATATYPE::HALF2:		return GL_HALF_FLOAT;
+			case SHADER_DATATYPE::SHORT2_NORM:	return GL_SHORT;
 		}
 
 		KS_FATAL_ERROR("ShaderDataType passed Unknown or Incorrect!");
 		return (GLenum)0;
 	}
 
+
+	// Fences of the streaming buffers rings, as OpenGL sync objects
+	class OGLRingFences : public RingFences
+	{
+	public:
+
+		virtual uint64_t Insert() override
+		{
+			return (uint64_t)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		}
+
+		virtual bool IsSignaled(uint64_t fence) override
+		{
+			GLenum result = glClientWaitSync((GLsync)fence, 0, 0);
+			return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+		}
+
+		virtual bool Wait(uint64_t fence) override
+		{
+			if (IsSignaled(fence))
+				return false;
+
+			// Flushing the commands the first time, so the fence gets to the GPU and the wait can end
+			KS_PROFILE_SCOPE("Ring Buffer Wait");
+			GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+			while (true)
+			{
+				GLenum result = glClientWaitSync((GLsync)fence, flags, 1000000); // 1ms
+				if (result != GL_TIMEOUT_EXPIRED)
+					break;
+
+				flags = 0;
+			}
+
+			return true;
+		}
+
+		virtual void Release(uint64_t fence) override
+		{
+			glDeleteSync((GLsync)fence);
+		}
+	};
+
+	// Creates the immutable storage of a streaming buffer & maps it for its whole lifetime
+	// (coherent, so the written data is seen by the GPU without flushing it)
+	static void* CreatePersistentStorage(uint buffer_id, uint size)
+	{
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glNamedBufferStorage(buffer_id, size, nullptr, flags | GL_DYNAMIC_STORAGE_BIT);
+
+		void* mapped_data = glMapNamedBufferRange(buffer_id, 0, size, flags);
+		KS_ENGINE_ASSERT(mapped_data, "Couldn't map the Streaming Buffer!");
+		return mapped_data;
+	}
+
 	
 
 	// ---------------------------- VERTEX BUFFER ---------------------------------------------------------
@@ -40,17 +98,28 @@ namespace Kaimos {
 		glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
 	}
 
-	OGLVertexBuffer::OGLVertexBuffer(uint size)
+	OGLVertexBuffer::OGLVertexBuffer(uint size, bool streaming)
 	{
 		KS_PROFILE_FUNCTION();
 		glCreateBuffers(1, &m_BufferID);
 		glBindBuffer(GL_ARRAY_BUFFER, m_BufferID);
-		glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+
+		if (streaming)
+		{
+			m_MappedData = (uint8_t*)CreatePersistentStorage(m_BufferID, size);
+			m_Ring = CreateScopePtr<RingAllocator>(size, CreateScopePtr<OGLRingFences>());
+		}
+		else
+			glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
 	}
 
 	OGLVertexBuffer::~OGLVertexBuffer()
 	{
 		KS_PROFILE_FUNCTION();
+		m_Ring.reset();
+		if (m_MappedData)
+			glUnmapNamedBuffer(m_BufferID);
+
 		glDeleteBuffers(1, &m_BufferID);
 	}
 
@@ -69,6 +138,28 @@ namespace Kaimos {
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
+
+
+	// ----------------------- Streaming Methods ----------------------------------------------------------
+	void* OGLVertexBuffer::Reserve(uint size, uint alignment)
+	{
+		KS_ENGINE_ASSERT(m_Ring, "Reserving memory of a non-streaming Vertex Buffer!");
+		uint offset = m_Ring->Reserve(size, alignment);
+		return offset == UINT_MAX ? nullptr : m_MappedData + offset;
+	}
+
+	uint OGLVertexBuffer::Commit(uint size)
+	{
+		KS_ENGINE_ASSERT(m_Ring, "Committing memory of a non-streaming Vertex Buffer!");
+		return m_Ring->Commit(size);
+	}
+
+	void OGLVertexBuffer::Retire()
+	{
+		KS_ENGINE_ASSERT(m_Ring, "Retiring memory of a non-streaming Vertex Buffer!");
+		m_Ring->Retire();
+	}
+
 	
 
 	// ----------------------- Getters/Setters ------------------------------------------------------------
@@ -96,17 +187,28 @@ namespace Kaimos {
 		glBufferData(GL_ARRAY_BUFFER, count * sizeof(uint), indices, GL_STATIC_DRAW);
 	}
 
-	OGLIndexBuffer::OGLIndexBuffer(uint count)
+	OGLIndexBuffer::OGLIndexBuffer(uint count, bool streaming)
 	{
 		KS_PROFILE_FUNCTION();
 		glCreateBuffers(1, &m_BufferID);
 		glBindBuffer(GL_ARRAY_BUFFER, m_BufferID);
-		glBufferData(GL_ARRAY_BUFFER, count * sizeof(uint), nullptr, GL_DYNAMIC_DRAW);
+
+		if (streaming)
+		{
+			m_MappedData = (uint*)CreatePersistentStorage(m_BufferID, count * sizeof(uint));
+			m_Ring = CreateScopePtr<RingAllocator>(count * sizeof(uint), CreateScopePtr<OGLRingFences>());
+		}
+		else
+			glBufferData(GL_ARRAY_BUFFER, count * sizeof(uint), nullptr, GL_DYNAMIC_DRAW);
 	}
 
 	OGLIndexBuffer::~OGLIndexBuffer()
 	{
 		KS_PROFILE_FUNCTION();
+		m_Ring.reset();
+		if (m_MappedData)
+			glUnmapNamedBuffer(m_BufferID);
+
 		glDeleteBuffers(1, &m_BufferID);
 	}
 
@@ -127,6 +229,28 @@ namespace Kaimos {
 
 
 
+	// ----------------------- Streaming Methods ----------------------------------------------------------
+	uint* OGLIndexBuffer::Reserve(uint count)
+	{
+		KS_ENGINE_ASSERT(m_Ring, "Reserving memory of a non-streaming Index Buffer!");
+		uint offset = m_Ring->Reserve(count * sizeof(uint), sizeof(uint));
+		return offset == UINT_MAX ? nullptr : m_MappedData + offset / sizeof(uint);
+	}
+
+	uint OGLIndexBuffer::Commit(uint count)
+	{
+		KS_ENGINE_ASSERT(m_Ring, "Committing memory of a non-streaming Index Buffer!");
+		return m_Ring->Commit(count * sizeof(uint)) / sizeof(uint);
+	}
+
+	void OGLIndexBuffer::Retire()
+	{
+		KS_ENGINE_ASSERT(m_Ring, "Retiring memory of a non-streaming Index Buffer!");
+		m_Ring->Retire();
+	}
+
+
+
 	// ----------------------- Getters/Setters ------------------------------------------------------------
 	void OGLIndexBuffer::SetData(const void* data, uint count)
 	{
@@ -137,6 +261,70 @@ namespace Kaimos {
 
 
 
+	// ---------------------------- UNIFORM BUFFER --------------------------------------------------------
+	// ----------------------- Public Class Methods -------------------------------------------------------
+	OGLUniformBuffer::OGLUniformBuffer(uint size, uint binding)
+		: m_Binding(binding)
+	{
+		KS_PROFILE_FUNCTION();
+		glCreateBuffers(1, &m_BufferID);
+		glNamedBufferData(m_BufferID, size, nullptr, GL_DYNAMIC_DRAW);
+		glBindBufferBase(GL_UNIFORM_BUFFER, m_Binding, m_BufferID);
+	}
+
+	OGLUniformBuffer::~OGLUniformBuffer()
+	{
+		KS_PROFILE_FUNCTION();
+		glDeleteBuffers(1, &m_BufferID);
+	}
+
+
+
+	// ----------------------- Getters/Setters ------------------------------------------------------------
+	void OGLUniformBuffer::SetData(const void* data, uint size, uint offset)
+	{
+		KS_PROFILE_FUNCTION();
+		glNamedBufferSubData(m_BufferID, offset, size, data);
+	}
+
+
+
+	// ---------------------------- STORAGE BUFFER --------------------------------------------------------
+	// ----------------------- Public Class Methods -------------------------------------------------------
+	OGLStorageBuffer::OGLStorageBuffer(uint size, uint binding)
+		: m_Binding(binding)
+	{
+		KS_PROFILE_FUNCTION();
+		glCreateBuffers(1, &m_BufferID);
+		glNamedBufferData(m_BufferID, size, nullptr, GL_DYNAMIC_DRAW);
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, m_Binding, m_BufferID);
+	}
+
+	OGLStorageBuffer::~OGLStorageBuffer()
+	{
+		KS_PROFILE_FUNCTION();
+		glDeleteBuffers(1, &m_BufferID);
+	}
+
+
+
+	// ----------------------- Public Storage Buffer Methods ----------------------------------------------
+	void OGLStorageBuffer::Bind() const
+	{
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, m_Binding, m_BufferID);
+	}
+
+
+
+	// ----------------------- Getters/Setters ------------------------------------------------------------
+	void OGLStorageBuffer::SetData(const void* data, uint size, uint offset)
+	{
+		KS_PROFILE_FUNCTION();
+		glNamedBufferSubData(m_BufferID, offset, size, data);
+	}
+
+
+
 	// ---------------------------- VERTEX ARRAY ----------------------------------------------------------
 	// ----------------------- Public Class Methods -------------------------------------------------------
 	OGLVertexArray::OGLVertexArray()
@@ -183,13 +371,20 @@ namespace Kaimos {
 				case SHADER_DATATYPE::FLOAT2:
 				case SHADER_DATATYPE::FLOAT3:
 				case SHADER_DATATYPE::FLOAT4:
+				case SHADER_DATATYPE::HALF2:
+				case SHADER_DATATYPE::SHORT2_NORM:
 				{
+					// Packed shorts are always normalized, otherwise the shader would read them as integer values
+					bool normalized = element.Normalized || element.Type == SHADER_DATATYPE::SHORT2_NORM;
 					glEnableVertexAttribArray(m_VBufferIndex);
 					glVertexAttribPointer(m_VBufferIndex, element.GetElementTypeCount(),
 						ShaderDataTypeToOpenGLType(element.Type),
-						element.Normalized ? GL_TRUE : GL_FALSE,
+						normalized ? GL_TRUE : GL_FALSE,
 						layout.GetStride(), (const void*)element.Offset);
 
+					if (element.PerInstance)
+						glVertexAttribDivisor(m_VBufferIndex, 1);
+
 					++m_VBufferIndex;
 					break;
 				}
@@ -197,6 +392,7 @@ namespace Kaimos {
 				case SHADER_DATATYPE::INT2:
 				case SHADER_DATATYPE::INT3:
 				case SHADER_DATATYPE::INT4:
+				case SHADER_DATATYPE::UINT:
 				case SHADER_DATATYPE::BOOL:
 				{
 					glEnableVertexAttribArray(m_VBufferIndex);
@@ -204,6 +400,9 @@ namespace Kaimos {
 						ShaderDataTypeToOpenGLType(element.Type),
 						layout.GetStride(), (const void*)element.Offset);
 
+					if (element.PerInstance)
+						glVertexAttribDivisor(m_VBufferIndex, 1);
+
 					++m_VBufferIndex;
 					break;
 				}
@@ -2,6 +2,7 @@
 #define _OGLBUFFER_H_
 
 #include "Renderer/Resources/Buffer.h"
+#include "Renderer/Resources/RingAllocator.h"
 
 namespace Kaimos {
 
@@ -12,13 +13,18 @@ namespace Kaimos {
 
 		// --- Public Class Methods ---
 		OGLVertexBuffer(float* vertices, uint size);
-		OGLVertexBuffer(uint size);
+		OGLVertexBuffer(uint size, bool streaming = false);
 		virtual ~OGLVertexBuffer();
 
 		// --- Public Vertex Buffer Methods ---
 		virtual void Bind() const override;
 		virtual void Unbind() const override;
 
+		// --- Streaming Methods ---
+		virtual void* Reserve(uint size, uint alignment = 1) override;
+		virtual uint Commit(uint size) override;
+		virtual void Retire() override;
+
 		// --- Getters/Setters ---
 		virtual const BufferLayout& GetLayout()				const override	{ return m_Layout; }
 		virtual void SetLayout(const BufferLayout& layout)	override		{ m_Layout = layout; }
@@ -29,6 +35,10 @@ namespace Kaimos {
 
 		uint m_BufferID = 0;
 		BufferLayout m_Layout;
+
+		// Streaming
+		uint8_t* m_MappedData = nullptr;
+		ScopePtr<RingAllocator> m_Ring = nullptr;
 	};
 
 
@@ -40,12 +50,17 @@ namespace Kaimos {
 
 		// --- Public Class Methods ---
 		OGLIndexBuffer(uint* indices, uint count);
-		OGLIndexBuffer(uint count);
+		OGLIndexBuffer(uint count, bool streaming = false);
 		virtual ~OGLIndexBuffer();
 
 		// --- Public Index Buffer Methods ---
 		virtual void Bind() const override;
 		virtual void Unbind() const override;
+
+		// --- Streaming Methods ---
+		virtual uint* Reserve(uint count) override;
+		virtual uint Commit(uint count) override;
+		virtual void Retire() override;
 		
 		// -- Getters/Setters --
 		virtual uint GetCount() const { return m_Count; }
@@ -55,6 +70,55 @@ namespace Kaimos {
 
 		uint m_BufferID = 0;
 		uint m_Count = 0;
+
+		// Streaming
+		uint* m_MappedData = nullptr;
+		ScopePtr<RingAllocator> m_Ring = nullptr;
+	};
+
+
+
+	// ---- UNIFORM BUFFER ----
+	class OGLUniformBuffer : public UniformBuffer
+	{
+	public:
+
+		// --- Public Class Methods ---
+		OGLUniformBuffer(uint size, uint binding);
+		virtual ~OGLUniformBuffer();
+
+		// --- Getters/Setters ---
+		virtual uint GetBinding() const override { return m_Binding; }
+		virtual void SetData(const void* data, uint size, uint offset = 0) override;
+
+	private:
+
+		uint m_BufferID = 0;
+		uint m_Binding = 0;
+	};
+
+
+
+	// ---- STORAGE BUFFER ----
+	class OGLStorageBuffer : public StorageBuffer
+	{
+	public:
+
+		// --- Public Class Methods ---
+		OGLStorageBuffer(uint size, uint binding);
+		virtual ~OGLStorageBuffer();
+
+		// --- Public Storage Buffer Methods ---
+		virtual void Bind() const override;
+
+		// --- Getters/Setters ---
+		virtual uint GetBinding() const override { return m_Binding; }
+		virtual void SetData(const void* data, uint size, uint offset = 0) override;
+
+	private:
+
+		uint m_BufferID = 0;
+		uint m_Binding = 0;
 	};
 
 
@@ -35,11 +35,19 @@ namespace Kaimos {
 
 	
 	// ----------------------- Public Class Methods -------------------------------------------------------
-	OGLShader::OGLShader(const std::string& filepath)
+	OGLShader::OGLShader(const std::string& filepath, const std::vector<std::string>& defines)
 	{
-		// -- Compile Shader --
 		KS_PROFILE_FUNCTION();
-		CompileShader(PreProcessShader(ReadShaderFile(filepath)));
+
+		// -- Process Shader Sources --
+		std::string file_source = ReadShaderFile(filepath);
+		std::unordered_map<GLenum, std::string> sources = PreProcessShader(file_source);
+
+		// -- Set Shader Variant Defines & Compile Shader --
+		if (!defines.empty())
+			InjectDefines(sources, defines);
+
+		CompileShader(sources);
 	}
 
 
@@ -249,6 +257,33 @@ namespace Kaimos {
 	}
 
 
+	void OGLShader::InjectDefines(std::unordered_map<GLenum, std::string>& shader_sources, const std::vector<std::string>& defines)
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- Build Defines Block --
+		std::string defines_block;
+		for (const std::string& define : defines)
+			defines_block += "#define " + define + "\n";
+
+		// -- Place it after the #version line of every shader stage (GLSL requires #version to be the first statement) --
+		for (auto& [type, source] : shader_sources)
+		{
+			size_t version_pos = source.find("#version");
+			size_t eol = version_pos == std::string::npos ? std::string::npos : source.find_first_of("\r\n", version_pos);
+
+			if (eol == std::string::npos)
+			{
+				KS_ERROR("Couldn't inject defines in {0} Shader '{1}' - #version line not found", StringFromShaderType(type), m_Name);
+				continue;
+			}
+
+			size_t next_line_pos = source.find_first_not_of("\r\n", eol);
+			source.insert(next_line_pos == std::string::npos ? source.size() : next_line_pos, defines_block);
+		}
+	}
+
+
 	void OGLShader::CompileShader(const std::unordered_map<GLenum, std::string>& shader_sources)
 	{
 		KS_PROFILE_FUNCTION();
@@ -341,67 +376,111 @@ namespace Kaimos {
 			glDetachShader(program, id);
 			glDeleteShader(id);
 		}
+
+		// -- Fill Uniforms Table --
+		ReflectUniforms();
 	}
 
 	
-	int OGLShader::GetUniformLocation(const std::string& name)
+	// Fills the uniforms table with the active uniforms of the program (uniform blocks members have no location)
+	void OGLShader::ReflectUniforms()
 	{
-		if (m_UniformCache.find(name) != m_UniformCache.end())
-			return m_UniformCache[name];
+		KS_PROFILE_FUNCTION();
+		m_UniformLocations.clear();
+		m_UniformIndices.clear();
 
-		int location = glGetUniformLocation(m_ShaderID, name.c_str());
-		if (location == -1)
+		GLint uniforms_count = 0, max_name_length = 0;
+		glGetProgramiv(m_ShaderID, GL_ACTIVE_UNIFORMS, &uniforms_count);
+		glGetProgramiv(m_ShaderID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_name_length);
+
+		std::vector<GLchar> name_buffer(max_name_length + 1);
+		m_UniformLocations.reserve(uniforms_count);
+
+		for (GLint i = 0; i < uniforms_count; ++i)
 		{
-			//KS_WARN("Tried to retrieve an unexisting uniform at Shader '{0}' ('{1}')", m_Name, name);
-			return location;
+			GLint size = 0;
+			GLenum type = 0;
+			GLsizei name_length = 0;
+			glGetActiveUniform(m_ShaderID, (GLuint)i, max_name_length, &name_length, &size, &type, name_buffer.data());
+
+			std::string name(name_buffer.data(), name_length);
+			int location = glGetUniformLocation(m_ShaderID, name.c_str());
+			if (location == -1)
+				continue;
+
+			int index = (int)m_UniformLocations.size();
+			m_UniformLocations.push_back(location);
+			m_UniformIndices[name] = index;
+
+			// Arrays are reported as "name[0]", but they are set by their name
+			if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+				m_UniformIndices[name.substr(0, name.size() - 3)] = index;
 		}
-
-		m_UniformCache[name] = location;
-		return location;
 	}
 
 
 
 	// ----------------------- Uniforms -------------------------------------------------------------------
-	void OGLShader::SetUniformFloat(const std::string& name, float value)
+	UniformHandle OGLShader::GetUniformHandle(const std::string& name)
+	{
+		std::unordered_map<std::string, int>::const_iterator it = m_UniformIndices.find(name);
+		if (it != m_UniformIndices.end())
+			return { it->second };
+
+		// Not reflected (like array elements), it's resolved and added to the table (or remembered as not found)
+		int location = glGetUniformLocation(m_ShaderID, name.c_str());
+		int index = -1;
+		if (location != -1)
+		{
+			index = (int)m_UniformLocations.size();
+			m_UniformLocations.push_back(location);
+		}
+		//else
+		//	KS_WARN("Tried to retrieve an unexisting uniform at Shader '{0}' ('{1}')", m_Name, name);
+
+		m_UniformIndices[name] = index;
+		return { index };
+	}
+
+	void OGLShader::SetUniformFloat(UniformHandle uniform, float value)
 	{
 		KS_PROFILE_FUNCTION();
-		glUniform1f(GetUniformLocation(name), value);
+		glUniform1f(GetUniformLocation(uniform), value);
 	}
 
-	void OGLShader::SetUniformFloat2(const std::string& name, const glm::vec2& value)
+	void OGLShader::SetUniformFloat2(UniformHandle uniform, const glm::vec2& value)
 	{
 		KS_PROFILE_FUNCTION();
-		glUniform2f(GetUniformLocation(name), value.x, value.y);
+		glUniform2f(GetUniformLocation(uniform), value.x, value.y);
 	}
 
-	void OGLShader::SetUniformFloat3(const std::string& name, const glm::vec3& value)
+	void OGLShader::SetUniformFloat3(UniformHandle uniform, const glm::vec3& value)
 	{
 		KS_PROFILE_FUNCTION();
-		glUniform3f(GetUniformLocation(name), value.x, value.y, value.z);
+		glUniform3f(GetUniformLocation(uniform), value.x, value.y, value.z);
 	}
 
-	void OGLShader::SetUniformFloat4(const std::string& name, const glm::vec4& value)
+	void OGLShader::SetUniformFloat4(UniformHandle uniform, const glm::vec4& value)
 	{
 		KS_PROFILE_FUNCTION();
-		glUniform4f(GetUniformLocation(name), value.x, value.y, value.z, value.w);
+		glUniform4f(GetUniformLocation(uniform), value.x, value.y, value.z, value.w);
 	}
 
-	void OGLShader::SetUniformMat4(const std::string& name, const glm::mat4& value)
+	void OGLShader::SetUniformMat4(UniformHandle uniform, const glm::mat4& value)
 	{
 		KS_PROFILE_FUNCTION();
-		glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, glm::value_ptr(value));
+		glUniformMatrix4fv(GetUniformLocation(uniform), 1, GL_FALSE, glm::value_ptr(value));
 	}
 	
-	void OGLShader::SetUniformInt(const std::string& name, int value)
+	void OGLShader::SetUniformInt(UniformHandle uniform, int value)
 	{
 		KS_PROFILE_FUNCTION();
-		glUniform1i(GetUniformLocation(name), value);
+		glUniform1i(GetUniformLocation(uniform), value);
 	}
 
-	void OGLShader::SetUniformIntArray(const std::string& name, int* values_array, uint size)
+	void OGLShader::SetUniformIntArray(UniformHandle uniform, int* values_array, uint size)
 	{
 		KS_PROFILE_FUNCTION();
-		glUniform1iv(GetUniformLocation(name), size, values_array);
+		glUniform1iv(GetUniformLocation(uniform), size, values_array);
 	}
 }
@@ -16,7 +16,7 @@ namespace Kaimos {
 
 		// --- Public Class Methods ---
 		OGLShader(const std::string& name, const std::string& vertex_src, const std::string& fragment_Src);
-		OGLShader(const std::string& filepath);
+		OGLShader(const std::string& filepath, const std::vector<std::string>& defines = {});
 		virtual ~OGLShader();
 
 		// --- Public Shader Methods ---
@@ -31,28 +31,44 @@ namespace Kaimos {
 		// --- Uniforms Set/Upload ---
 		// By now is like this, but maybe we'd like to divide in 2 functions, a API-Specific Call (opengl -> glUniform) and a
 		// high-level call/concept (where it might be set inside a uniform buffer, might set it individually not API-tied...)
-		virtual void SetUniformFloat(const std::string& name, float value)						override;
-		virtual void SetUniformFloat3(const std::string& name, const glm::vec3& value)			override;
-		virtual void SetUniformFloat2(const std::string& name, const glm::vec2& value)			override;
-		virtual void SetUniformFloat4(const std::string& name, const glm::vec4& value)			override;
-		virtual void SetUniformMat4(const std::string& name, const glm::mat4& value)			override;
-		virtual void SetUniformInt(const std::string& name, int value)							override;
-		virtual void SetUniformIntArray(const std::string& name, int* values_array, uint size)	override;
+		virtual UniformHandle GetUniformHandle(const std::string& name)								override;
+
+		virtual void SetUniformFloat(UniformHandle uniform, float value)							override;
+		virtual void SetUniformFloat2(UniformHandle uniform, const glm::vec2& value)				override;
+		virtual void SetUniformFloat3(UniformHandle uniform, const glm::vec3& value)				override;
+		virtual void SetUniformFloat4(UniformHandle uniform, const glm::vec4& value)				override;
+		virtual void SetUniformMat4(UniformHandle uniform, const glm::mat4& value)					override;
+		virtual void SetUniformInt(UniformHandle uniform, int value)								override;
+		virtual void SetUniformIntArray(UniformHandle uniform, int* values_array, uint size)		override;
+
+		// Keep the by-name setters visible
+		using Shader::SetUniformFloat;
+		using Shader::SetUniformFloat2;
+		using Shader::SetUniformFloat3;
+		using Shader::SetUniformFloat4;
+		using Shader::SetUniformMat4;
+		using Shader::SetUniformInt;
+		using Shader::SetUniformIntArray;
 
 	private:
 
 		// --- Private OGL Shader Methods ---
 		std::string ReadShaderFile(const std::string& filepath);
 		const std::unordered_map<GLenum, std::string> PreProcessShader(std::string& source);
+		void InjectDefines(std::unordered_map<GLenum, std::string>& shader_sources, const std::vector<std::string>& defines);
 		
 		void CompileShader(const std::unordered_map<GLenum, std::string>&shader_sources);
-		int GetUniformLocation(const std::string& name);
+		void ReflectUniforms();
+		inline int GetUniformLocation(UniformHandle uniform) const { return uniform.IsValid() ? m_UniformLocations[uniform.Index] : -1; }
 
 	private:
 
 		uint m_ShaderID = 0;
 		std::string m_Name = "Unnamed Shader";
-		std::unordered_map<std::string, int> m_UniformCache;
+
+		// Uniform locations by handle index, filled with the active uniforms on compilation (and any other name resolved later)
+		std::vector<int> m_UniformLocations;
+		std::unordered_map<std::string, int> m_UniformIndices;	// Name & handle index (-1 if not found)
 	};
 }
 
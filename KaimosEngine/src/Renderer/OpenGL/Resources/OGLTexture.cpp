@@ -1,5 +1,6 @@
 #include "kspch.h"
 #include "OGLTexture.h"
+#include "Renderer/OpenGL/OGLExtensions.h"
 
 #include <stb_image.h>
 
@@ -19,7 +20,7 @@ namespace Kaimos {
 		glCreateTextures(GL_TEXTURE_2D, 1, &m_ID);
 
 		// -- Texture Storage --
-		glTextureStorage2D(m_ID, 1, GL_RGBA8, m_Width, m_Height);
+		glTextureStorage2D(m_ID, m_MipLevels, m_InternalFormat, m_Width, m_Height);
 
 		// -- Texture Parameters Setup --
 		glTextureParameteri(m_ID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
@@ -31,40 +32,69 @@ namespace Kaimos {
 
 	OGLTexture2D::OGLTexture2D(const std::string& filepath)
 	{
-		// -- Check Paths --
-		// In this case we check "assets" for textures and "internal" for icons
-		if (filepath.find("assets") == std::string::npos && filepath.find("internal") == std::string::npos)
-		{
-			KS_ERROR("Cannot load an out-of-project texture! Try moving it inside 'assets/' folder.\nCurrent Filepath: {0}", filepath);
-			return;
-		}
-		
-		std::filesystem::path path = filepath;
-		if (!std::filesystem::exists(path))
-		{
-			KS_ERROR("Unexisting Path Loading Texture: {0}", filepath);
-			return;
-		}
+		KS_PROFILE_FUNCTION();
+		Ref<TextureData> data = TextureData::Load(filepath);
+		if (data)
+			CreateFromData(*data);
+	}
 
-		// -- Texture Load --
+	OGLTexture2D::OGLTexture2D(const TextureData& data)
+	{
 		KS_PROFILE_FUNCTION();
-		int w, h, channels;
-		stbi_set_flip_vertically_on_load(1);
-		stbi_uc* texture_data = nullptr;
+		CreateFromData(data);
+	}
 
-		{
-			KS_PROFILE_SCOPE("TEXTURE STBI LOAD - OGLTexture2D::OGLTexture2D(const std::string& path)");
-			texture_data = stbi_load(filepath.c_str(), &w, &h, &channels, 0);
-		}
+	OGLTexture2D::~OGLTexture2D()
+	{
+		KS_PROFILE_FUNCTION();
+		OGLExtensions::ReleaseTextureHandle(m_BindlessHandle);
+		glDeleteTextures(1, &m_ID);
+	}
 
-		// -- Check for Failure --
-		if (!texture_data)
-		{
-			KS_ERROR("Failed to load texture data from path: {0}", filepath);
-			return;
-		}
+	
+	// ----------------------- Public Texture Methods -----------------------------------------------------
+	void OGLTexture2D::SetData(void* data, uint size)
+	{
+		KS_PROFILE_FUNCTION();
 
-		m_Width = w; m_Height = h, m_Filepath = filepath;
+		uint bpp = m_DataFormat == GL_RGBA ? 4 : 3; // Bytes per pixel
+		KS_ENGINE_ASSERT(size == m_Width * m_Height * bpp, "Data passed must be the same size than the entire texture size");
+		glTextureSubImage2D(m_ID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+	}
+
+	void OGLTexture2D::Bind(uint slot) const
+	{
+		KS_PROFILE_FUNCTION();
+		glBindTextureUnit(slot, m_ID); //Slot/Unit refers to the (opengl) slot in which the texture is bound, in case we bind +1 textures at a time
+	}
+
+	uint64_t OGLTexture2D::GetBindlessHandle()
+	{
+		if (m_BindlessHandle == 0)
+			m_BindlessHandle = OGLExtensions::GetResidentTextureHandle(m_ID);
+
+		return m_BindlessHandle;
+	}
+
+	uint64_t OGLTexture2D::GetMemorySize() const
+	{
+		// -- Bytes per Pixel of the Internal Format (drivers pad GL_RGB8 to 4 bytes, as GL_RGBA8) --
+		uint bpp = m_InternalFormat == GL_R8 ? 1 : 4;
+
+		// -- Sum the Mip Chain --
+		uint64_t size = 0;
+		for (uint level = 0; level < m_MipLevels; ++level)
+			size += (uint64_t)std::max(m_Width >> level, 1u) * std::max(m_Height >> level, 1u) * bpp;
+
+		return size;
+	}
+
+
+	// ----------------------- Private Texture Methods ----------------------------------------------------
+	void OGLTexture2D::CreateFromData(const TextureData& data)
+	{
+		m_Width = data.GetWidth(); m_Height = data.GetHeight(), m_Filepath = data.GetFilepath();
+		uint channels = data.GetChannels();
 
 		// -- Image channels (RGBA) processing --
 		if (channels == 4)
@@ -89,7 +119,7 @@ namespace Kaimos {
 		glCreateTextures(GL_TEXTURE_2D, 1, &m_ID);
 
 		// -- For mipmaps, modify "levels" parameter. To work with gamma and all that stuff, the "internalFormat" parameter (GL_SRGBA8) --> GL_RGB8 = image RGBA with 8 bits per channel (8b R, 8b G, 8b B) --
-		glTextureStorage2D(m_ID, 1, m_InternalFormat, m_Width, m_Height);	// Allocate memory in GPU for the texture
+		glTextureStorage2D(m_ID, m_MipLevels, m_InternalFormat, m_Width, m_Height);	// Allocate memory in GPU for the texture
 
 		// --- Texture Parameters Setup ---
 		// Texture filters to minificate and magnificate textures when they are smaller than geometry's pixels to fill
@@ -99,33 +129,7 @@ namespace Kaimos {
 		glTextureParameteri(m_ID, GL_TEXTURE_WRAP_S, GL_REPEAT);
 		glTextureParameteri(m_ID, GL_TEXTURE_WRAP_T, GL_REPEAT);
 
-		glTextureSubImage2D(m_ID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, texture_data); // X,Y Offset can be use to upload partially a texture, you can change a region of an already uploaded texture
-		
-		// -- Free STBI Image --
-		stbi_image_free(texture_data);
-	}
-
-	OGLTexture2D::~OGLTexture2D()
-	{
-		KS_PROFILE_FUNCTION();
-		glDeleteTextures(1, &m_ID);
-	}
-
-	
-	// ----------------------- Public Texture Methods -----------------------------------------------------
-	void OGLTexture2D::SetData(void* data, uint size)
-	{
-		KS_PROFILE_FUNCTION();
-
-		uint bpp = m_DataFormat == GL_RGBA ? 4 : 3; // Bytes per pixel
-		KS_ENGINE_ASSERT(size == m_Width * m_Height * bpp, "Data passed must be the same size than the entire texture size");
-		glTextureSubImage2D(m_ID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
-	}
-
-	void OGLTexture2D::Bind(uint slot) const
-	{
-		KS_PROFILE_FUNCTION();
-		glBindTextureUnit(slot, m_ID); //Slot/Unit refers to the (opengl) slot in which the texture is bound, in case we bind +1 textures at a time
+		glTextureSubImage2D(m_ID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data.GetPixels()); // X,Y Offset can be use to upload partially a texture, you can change a region of an already uploaded texture
 	}
 
 
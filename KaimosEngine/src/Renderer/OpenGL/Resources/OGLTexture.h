@@ -13,6 +13,7 @@ namespace Kaimos {
 		// --- Public Class Methods ---
 		OGLTexture2D(uint width, uint height);
 		OGLTexture2D(const std::string& filepath);
+		OGLTexture2D(const TextureData& data);
 		virtual ~OGLTexture2D();
 
 		// --- Public Texture Methods ---
@@ -21,11 +22,20 @@ namespace Kaimos {
 
 		// --- Getters ---
 		virtual const std::string GetFilepath()	const override { return m_Filepath; }
+		virtual uint64_t GetMemorySize()		const override;
+		virtual uint64_t GetBindlessHandle()	override;
+
+	private:
+
+		// --- Private Texture Methods ---
+		void CreateFromData(const TextureData& data);
 
 	private:
 
 		std::string m_Filepath = ""; // TODO: This is not 100% necessary, but OK for debugging... However shouldn't be here, there should be an "AssetManager" with a map storing [resource, path]
 		GLenum m_InternalFormat = 0, m_DataFormat = 0;
+		uint m_MipLevels = 1;
+		uint64_t m_BindlessHandle = 0;
 	};
 
 
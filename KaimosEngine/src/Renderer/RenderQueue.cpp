@@ -0,0 +1,120 @@
+#include "kspch.h"
+#include "RenderQueue.h"
+
+#include "Core/Utils/Jobs/JobSystem.h"
+
+
+namespace Kaimos {
+
+	// ----------------------- Globals --------------------------------------------------------------------
+	static constexpr uint s_PacketsPerJob = 2048;
+	static constexpr uint s_RadixSortThreshold = 256;		// Smaller queues are sorted by comparison
+	static constexpr uint s_RadixBits = 8, s_RadixPasses = 64 / s_RadixBits, s_RadixBuckets = 1 << s_RadixBits;
+
+	static constexpr uint64_t GetFieldMask(uint bits)
+	{
+		return (1ull << bits) - 1ull;
+	}
+
+
+
+	// ----------------------- Public Sort Key Methods ----------------------------------------------------
+	uint64_t RenderQueue::GetMaterialKey(uint texture_set, uint material_index)
+	{
+		return (((uint64_t)texture_set & GetFieldMask(TextureSetBits)) << MaterialBits) | ((uint64_t)material_index & GetFieldMask(MaterialBits));
+	}
+
+	uint64_t RenderQueue::GetSortKey(uint layer, uint64_t material_key, float depth, bool front_to_back)
+	{
+		// -- Depth Quantization --
+		// Positive floats keep their order when read as uints, so the top bits (exponent & highest mantissa bits) are the key
+		float positive_depth = depth > 0.0f ? depth : 0.0f;
+		uint depth_bits = 0;
+		memcpy(&depth_bits, &positive_depth, sizeof(float));
+
+		uint64_t depth_key = (uint64_t)(depth_bits >> (31 - DepthBits));
+		if (!front_to_back)
+			depth_key = GetFieldMask(DepthBits) - depth_key;
+
+		// -- Key Packing --
+		uint64_t key = (uint64_t)layer & GetFieldMask(LayerBits);
+		key = (key << (TextureSetBits + MaterialBits)) | (material_key & GetFieldMask(TextureSetBits + MaterialBits));
+		return (key << DepthBits) | depth_key;
+	}
+
+
+
+	// ----------------------- Public Queue Methods -------------------------------------------------------
+	void RenderQueue::Build(uint draws_count, const std::function<uint64_t(uint)>& sort_key_function)
+	{
+		KS_PROFILE_FUNCTION();
+		m_Packets.resize(draws_count);
+
+		auto build_packet = [this, &sort_key_function](uint index) { m_Packets[index] = { sort_key_function(index), index }; };
+		if (draws_count <= s_PacketsPerJob || JobSystem::GetWorkersCount() == 0)
+		{
+			for (uint i = 0; i < draws_count; ++i)
+				build_packet(i);
+
+			return;
+		}
+
+		JobSystem::Dispatch(draws_count, s_PacketsPerJob, build_packet);
+		JobSystem::Wait();
+	}
+
+	void RenderQueue::Sort()
+	{
+		KS_PROFILE_FUNCTION();
+		uint packets_count = (uint)m_Packets.size();
+		if (packets_count < s_RadixSortThreshold)
+		{
+			std::sort(m_Packets.begin(), m_Packets.end(), [](const DrawPacket& a, const DrawPacket& b)
+				{
+					return a.SortKey < b.SortKey || (a.SortKey == b.SortKey && a.Index < b.Index);
+				});
+
+			return;
+		}
+
+		// -- Histograms of all the Key Bytes (in a single read of the packets) --
+		std::vector<uint> histograms(s_RadixPasses * s_RadixBuckets, 0);
+		for (const DrawPacket& packet : m_Packets)
+			for (uint pass = 0; pass < s_RadixPasses; ++pass)
+				++histograms[pass * s_RadixBuckets + ((packet.SortKey >> (pass * s_RadixBits)) & (s_RadixBuckets - 1))];
+
+		// -- LSD Passes (bytes shared by all the keys are skipped, which are most of them in scenes with few materials) --
+		m_SortBuffer.resize(packets_count);
+		DrawPacket* source = m_Packets.data();
+		DrawPacket* destination = m_SortBuffer.data();
+
+		for (uint pass = 0; pass < s_RadixPasses; ++pass)
+		{
+			uint shift = pass * s_RadixBits;
+			uint* histogram = &histograms[pass * s_RadixBuckets];
+			if (histogram[(source[0].SortKey >> shift) & (s_RadixBuckets - 1)] == packets_count)
+				continue;
+
+			uint offset = 0;
+			for (uint bucket = 0; bucket < s_RadixBuckets; ++bucket)
+			{
+				uint bucket_count = histogram[bucket];
+				histogram[bucket] = offset;
+				offset += bucket_count;
+			}
+
+			for (uint i = 0; i < packets_count; ++i)
+				destination[histogram[(source[i].SortKey >> shift) & (s_RadixBuckets - 1)]++] = source[i];
+
+			std::swap(source, destination);
+		}
+
+		if (source != m_Packets.data())
+			m_Packets.swap(m_SortBuffer);
+	}
+
+	void RenderQueue::Clear()
+	{
+		m_Packets.clear();
+	}
+}
@@ -0,0 +1,53 @@
+#ifndef _RENDERQUEUE_H_
+#define _RENDERQUEUE_H_
+
+namespace Kaimos {
+
+	// ---- Draw Packet ----
+	// Sort key of a draw & the index of the draw in the array of whoever built the queue
+	struct DrawPacket
+	{
+		uint64_t SortKey = 0;
+		uint Index = 0;
+	};
+
+
+
+	// ---- Render Queue ----
+	// Draw packets sorted by their key before being submitted to the batch renderers, so draws sharing textures & materials are
+	// batched together (less texture slots overflows and state changes) and, within a material, are drawn in depth order
+	// It's CPU-only (no GPU resources), so it can be built & sorted without a renderer
+	class RenderQueue
+	{
+	public:
+
+		// --- Sort Key Layout (most significant first) ---
+		// Layer | Texture Set | Material | Depth
+		static constexpr uint LayerBits = 4, TextureSetBits = 16, MaterialBits = 20, DepthBits = 24;
+
+		// Material field of a key, the texture set is a hash of the material textures & the material is its index in the materials table
+		static uint64_t GetMaterialKey(uint texture_set, uint material_index);
+
+		// Depth is quantized (negative ones are taken as 0), front_to_back = false makes farther draws go first
+		static uint64_t GetSortKey(uint layer, uint64_t material_key, float depth, bool front_to_back);
+
+		// --- Public Queue Methods ---
+		// Builds a packet for each draw in [0, draws_count) with the key sort_key_function(draw) returns, in parallel for big queues
+		void Build(uint draws_count, const std::function<uint64_t(uint)>& sort_key_function);
+
+		// Radix sort of the packets by key (stable, so draws with the same key keep their order)
+		void Sort();
+		void Clear();
+
+		// --- Getters ---
+		const std::vector<DrawPacket>& GetPackets()	const { return m_Packets; }
+		uint GetPacketsCount()						const { return (uint)m_Packets.size(); }
+
+	private:
+
+		std::vector<DrawPacket> m_Packets;
+		std::vector<DrawPacket> m_SortBuffer;		// Ping-pong buffer of the radix sort passes
+	};
+}
+
+#endif //_RENDERQUEUE_H_
@@ -4,6 +4,9 @@
 #include "Core/Resources/ResourceManager.h"
 
 #include "OpenGL/Resources/OGLShader.h"
+#include "Resources/Buffer.h"
+#include "RenderQueue.h"
+#include "Resources/BatchFormats.h"
 #include "Resources/Mesh.h"
 #include "Resources/Material.h"
 #include "Resources/Shader.h"
@@ -13,12 +16,116 @@
 
 #include "Renderer2D.h"
 #include "Renderer3D.h"
+#include "LightClusters.h"
+#include "Scene/KaimosYAMLExtension.h"
 
 #include <yaml-cpp/yaml.h>
 
 
 namespace Kaimos {
 
+	// --- Lights Buffers ---
+	// Mirror the std140 "Lights" uniform block (binding 0) and the std430 point lights & clusters buffers (bindings 1-3)
+	// of the lighting shaders, so their layouts must match
+	static constexpr uint MaxDirLights = 10, MaxPointLights = 4096;
+	static constexpr uint MaxClusterLightIndices = LightClusters::ClustersCount * 64;
+	static constexpr uint LightsUBOBinding = 0, PointLightsSSBOBinding = 1, LightClustersSSBOBinding = 2, LightIndicesSSBOBinding = 3;
+
+	struct DirectionalLightData
+	{
+		glm::vec4 Radiance = glm::vec4(0.0f);
+		glm::vec3 Direction = glm::vec3(0.0f);
+		float Intensity = 0.0f;
+		float SpecularStrength = 0.0f;
+		float Padding[3] = { 0.0f };
+	};
+
+	struct PointLightData
+	{
+		glm::vec4 Radiance = glm::vec4(0.0f);
+		glm::vec3 Position = glm::vec3(0.0f);
+		float Intensity = 0.0f;
+		float SpecularStrength = 0.0f;
+		float MinRadius = 0.0f, MaxRadius = 0.0f;	// MinRadius is the PBR "Radius"
+		float FalloffFactor = 0.0f, AttL = 0.0f, AttQ = 0.0f;
+		float Padding[2] = { 0.0f };
+	};
+
+	struct LightsUBOData
+	{
+		glm::mat4 View = glm::mat4(1.0f), Projection = glm::mat4(1.0f);
+		glm::vec4 ClusterDepthParameters = glm::vec4(0.0f);		// See LightClusters::GetDepthParameters()
+		glm::ivec4 ClusterGrid = glm::ivec4(0);					// Clusters in x, y & z, and 1 if the projection is perspective
+		int DirectionalLightsNum = 0;
+		int Padding[3] = { 0 };
+		DirectionalLightData DirectionalLights[MaxDirLights];
+	};
+
+	static_assert(sizeof(DirectionalLightData) == 48 && sizeof(PointLightData) == 64, "Light structs don't match std140 layout!");
+	static_assert(sizeof(LightClusters::Cluster) == 8, "Light clusters don't match the shaders uvec2!");
+
+	// Point lights clusters of a view (like a camera entity), rebuilt when its camera or the point lights change
+	// Views rendered in the same frame keep theirs, the least recently used one is replaced past MaxLightsViews
+	static constexpr uint MaxLightsViews = 4;
+	struct LightsView
+	{
+		uint ViewID = 0, LastUse = 0;
+		glm::mat4 View = glm::mat4(0.0f), Projection = glm::mat4(0.0f);
+		uint PointLightsVersion = 0;		// Of the point lights it was clustered with
+		LightClusters Clusters;
+		Ref<StorageBuffer> ClustersSSBO = nullptr, IndicesSSBO = nullptr;
+	};
+
+
+
+	// --- Materials Table ---
+	// An entry per material, mirrors the std430 "Materials" buffer (binding 4) of the batch shaders, which grows if the materials don't fit
+	static constexpr uint InitialMaterialsTableCapacity = 256, MaterialsSSBOBinding = 4;
+	static_assert(sizeof(MaterialData) == 112, "Materials table doesn't match std430 layout!");
+
+	static MaterialData GetMaterialData(Material& material, const MaterialTextureIndices& tex_indices, bool bindless_textures, const Ref<Texture2D> default_textures[2])
+	{
+		MaterialData data;
+		data.Color = material.Color;
+		data.NormalStrength = material.Bumpiness;
+		data.Shininess = material.Smoothness * 256.0f;
+		data.SpecularStrength = material.Specularity;
+		data.Roughness = material.Roughness;
+		data.Metallic = material.Metallic;
+		data.AmbientOcclusion = material.AmbientOcclusion;
+
+		data.TexIndex = (int)tex_indices.Albedo;
+		data.NormTexIndex = (int)tex_indices.Normal;
+		data.SpecTexIndex = (int)tex_indices.Specular;
+		data.RoughTexIndex = (int)tex_indices.Roughness;
+		data.MetalTexIndex = (int)tex_indices.Metallic;
+		data.AOTexIndex = (int)tex_indices.AmbientOcc;
+
+		// Bindless textures are sampled from the handles, which take the same index in the entry than in MATERIAL_TEXTURES
+		if (bindless_textures)
+		{
+			for (uint i = 0; i < MaterialData::TexturesCount; ++i)
+			{
+				const Ref<Texture2D>& texture = material.GetTexture((MATERIAL_TEXTURES)i);
+				data.TextureHandles[i] = texture ? texture->GetBindlessHandle() : default_textures[i == (uint)MATERIAL_TEXTURES::NORMAL ? 1 : 0]->GetBindlessHandle();
+			}
+		}
+
+		return data;
+	}
+
+
+
+	// --- Scene Shader Uniforms ---
+	// Resolved once each time the scene shader changes
+	struct SceneShaderUniforms
+	{
+		UniformHandle ViewProjection, ViewPos, SceneColor;
+		UniformHandle IrradianceMap, PrefilterSpecularMap, BRDF_LUTMap;
+	};
+
+
+
 	struct RendererData
 	{
 		std::string LastScene = "";
@@ -26,21 +133,46 @@ namespace Kaimos {
 		// Renderer Stuff
 		glm::mat4 ViewProjectionMatrix = glm::mat4(1.0f);
 		glm::vec3 SceneColor = glm::vec3(1.0f);
-		const uint MaxDirLights = 10, MaxPointLights = 100;
 		bool PBR_Pipeline = false;
 		uint CameraUIDisplayOption = 0;
+
+		// Bindless Textures (batched scenes sample the textures from the handles in the materials table, so they don't need texture slots)
+		bool BindlessTexturesEnabled = true;
+		bool BindlessTextures = false;		// If the current scene shader uses them
 		
 		// Shaders & Materials
 		ShaderLibrary Shaders;
+		Ref<Shader> SceneShader = nullptr;
+		SceneShaderUniforms SceneUniforms;
+
+		// Lights (last uploaded data is kept to only re-upload it, and re-cluster lights, when it changes)
+		// Point lights are shared by all the views, while each view has its own clusters
+		Ref<UniformBuffer> LightsUBO = nullptr;
+		Ref<StorageBuffer> PointLightsSSBO = nullptr;
+		LightsUBOData LightsData;
+		std::vector<PointLightData> PointLightsData;
+		uint PointLightsVersion = 0;
+		bool LightsDataUploaded = false;
+
+		std::vector<LightsView> LightsViews;
+		uint CurrentLightsView = UINT_MAX, LightsViewsUses = 0;
 		uint DefaultMaterialID = 0;
 		std::unordered_map<uint, Ref<Material>> Materials;
 
+		// Materials Table (table index of each material by its ID, only the entries changed since the last upload are uploaded)
+		Ref<StorageBuffer> MaterialsSSBO = nullptr;
+		uint MaterialsSSBOCapacity = 0;
+		std::vector<MaterialData> MaterialsTable;
+		std::unordered_map<uint, uint> MaterialsTableIndices;
+		uint DirtyMaterialsBegin = UINT_MAX, DirtyMaterialsEnd = 0;
+
 		// Textures
 		// Although 32 is MaxTextures on OpenGL, the last ones must be for Environment Mapping
 		uint TextureSlotIndex = 2;									// Slot 0 -> White Texture, Slot 1 -> Normal Texture
 		static const uint MaxTextureSlots = 29;						// TODO: RenderCapabilities - Variables based on what the hardware can do
 		std::array<Ref<Texture2D>, MaxTextureSlots> TextureSlots;
-		Ref<Texture2D> WhiteTexture = nullptr, NormalTexture = nullptr;
+		std::unordered_map<uint, uint> TextureSlotIndices;			// Slot of each texture in the current batch, by texture ID
+		Ref<Texture2D> DefaultTextures[2] = { nullptr, nullptr };	// White & Normal textures
 
 		// Environment Mapping
 		Ref<VertexArray> CubeVArray = nullptr;
@@ -76,24 +208,41 @@ namespace Kaimos {
 		// -- Shaders Creation --
 		s_RendererData->Shaders.Load("BatchedShader", "assets/shaders/BatchRenderingShader.glsl");
 		s_RendererData->Shaders.Load("PBR_BatchedShader", "assets/shaders/PBR_BatchRenderingShader.glsl");
+		s_RendererData->Shaders.Load("InstancedShader", "assets/shaders/BatchRenderingShader.glsl", { "INSTANCED_RENDERING" });
+		s_RendererData->Shaders.Load("PBR_InstancedShader", "assets/shaders/PBR_BatchRenderingShader.glsl", { "INSTANCED_RENDERING" });
+
+		if (RenderCommand::SupportsBindlessTextures())
+		{
+			s_RendererData->Shaders.Load("Bindless_BatchedShader", "assets/shaders/BatchRenderingShader.glsl", { "BINDLESS_TEXTURES" });
+			s_RendererData->Shaders.Load("PBR_Bindless_BatchedShader", "assets/shaders/PBR_BatchRenderingShader.glsl", { "BINDLESS_TEXTURES" });
+		}
+
 		s_RendererData->Shaders.Load("EquirectangularToCubemap", "assets/shaders/ibl/EquirectangularToCubemapShader.glsl");
 		s_RendererData->Shaders.Load("CubemapConvolution", "assets/shaders/ibl/CubemapConvolutionShader.glsl");
 		s_RendererData->Shaders.Load("IBL_Prefiltered", "assets/shaders/ibl/IBL_PrefilteringShader.glsl");
 		s_RendererData->Shaders.Load("BRDF_Integration", "assets/shaders/ibl/BRDFConvolutionShader.glsl");
 		s_RendererData->Shaders.Load("SkyboxShader", "assets/shaders/SkyboxShader.glsl");
 
+		// -- Lights Buffers Creation --
+		s_RendererData->LightsUBO = UniformBuffer::Create(sizeof(LightsUBOData), LightsUBOBinding);
+		s_RendererData->PointLightsSSBO = StorageBuffer::Create(MaxPointLights * sizeof(PointLightData), PointLightsSSBOBinding);
+
+		// -- Materials Table Buffer Creation --
+		s_RendererData->MaterialsSSBOCapacity = InitialMaterialsTableCapacity;
+		s_RendererData->MaterialsSSBO = StorageBuffer::Create(InitialMaterialsTableCapacity * sizeof(MaterialData), MaterialsSSBOBinding);
+
 		// -- Default Textures Creation --
 		uint white_data = 0xffffffff; // Full Fs for every channel there (2x4 channels - rgba -)
-		s_RendererData->WhiteTexture = Texture2D::Create(1, 1);
-		s_RendererData->WhiteTexture->SetData(&white_data, sizeof(white_data)); // or sizeof(uint)
+		s_RendererData->DefaultTextures[0] = Texture2D::Create(1, 1);
+		s_RendererData->DefaultTextures[0]->SetData(&white_data, sizeof(white_data)); // or sizeof(uint)
 
 		uint normal_data = 0xffff8080;
-		s_RendererData->NormalTexture = Texture2D::Create(1, 1);
-		s_RendererData->NormalTexture->SetData(&normal_data, sizeof(normal_data)); // or sizeof(uint)
+		s_RendererData->DefaultTextures[1] = Texture2D::Create(1, 1);
+		s_RendererData->DefaultTextures[1]->SetData(&normal_data, sizeof(normal_data)); // or sizeof(uint)
 
 		// -- Texture Slots Filling --
-		s_RendererData->TextureSlots[0] = s_RendererData->WhiteTexture;
-		s_RendererData->TextureSlots[1] = s_RendererData->NormalTexture;
+		s_RendererData->TextureSlots[0] = s_RendererData->DefaultTextures[0];
+		s_RendererData->TextureSlots[1] = s_RendererData->DefaultTextures[1];
 		int texture_samplers[s_RendererData->MaxTextureSlots];
 
 		for (uint i = 0; i < s_RendererData->MaxTextureSlots; ++i)
@@ -140,8 +289,13 @@ namespace Kaimos {
 			texture.reset();
 		
 		s_RendererData->Materials.clear();
-		s_RendererData->WhiteTexture.reset();
-		s_RendererData->NormalTexture.reset();
+		s_RendererData->SceneShader.reset();
+		s_RendererData->LightsUBO.reset();
+		s_RendererData->PointLightsSSBO.reset();
+		s_RendererData->LightsViews.clear();
+		s_RendererData->MaterialsSSBO.reset();
+		s_RendererData->DefaultTextures[0].reset();
+		s_RendererData->DefaultTextures[1].reset();
 		delete s_RendererData;
 	}
 
@@ -149,7 +303,7 @@ namespace Kaimos {
 
 	// ----------------------- Public Renderer Methods -------------------------------------------------------
 	// Takes all scene parameters & makes sure shaders we use get the right uniforms
-	bool Renderer::BeginScene(const glm::mat4& view_projection_matrix, const glm::vec3& camera_pos, const std::vector<std::pair<Ref<Light>, glm::vec3>>& dir_lights, const std::vector<std::pair<Ref<PointLight>, glm::vec3>>& point_lights)
+	bool Renderer::BeginScene(const glm::mat4& view_matrix, const glm::mat4& projection_matrix, const glm::vec3& camera_pos, const std::vector<std::pair<Ref<Light>, glm::vec3>>& dir_lights, bool instanced_rendering)
 	{
 		KS_PROFILE_FUNCTION();
 		if (s_CompileEnvironmentMap)
@@ -159,14 +313,35 @@ namespace Kaimos {
 			return false;
 		}
 
-		Ref<Shader> shader = s_RendererData->PBR_Pipeline ? GetShader("PBR_BatchedShader") : GetShader("BatchedShader");
+		Ref<Shader> shader = nullptr;
+		s_RendererData->BindlessTextures = !instanced_rendering && IsBindlessTexturesSupported() && s_RendererData->BindlessTexturesEnabled;
+
+		if (instanced_rendering)
+			shader = s_RendererData->PBR_Pipeline ? GetShader("PBR_InstancedShader") : GetShader("InstancedShader");
+		else if (s_RendererData->BindlessTextures)
+			shader = s_RendererData->PBR_Pipeline ? GetShader("PBR_Bindless_BatchedShader") : GetShader("Bindless_BatchedShader");
+		else
+			shader = s_RendererData->PBR_Pipeline ? GetShader("PBR_BatchedShader") : GetShader("BatchedShader");
+
+		SceneShaderUniforms& uniforms = s_RendererData->SceneUniforms;
+		if (shader && shader != s_RendererData->SceneShader)
+		{
+			uniforms.ViewProjection = shader->GetUniformHandle("u_ViewProjection");
+			uniforms.ViewPos = shader->GetUniformHandle("u_ViewPos");
+			uniforms.SceneColor = shader->GetUniformHandle("u_SceneColor");
+			uniforms.IrradianceMap = shader->GetUniformHandle("u_IrradianceMap");
+			uniforms.PrefilterSpecularMap = shader->GetUniformHandle("u_PrefilterSpecularMap");
+			uniforms.BRDF_LUTMap = shader->GetUniformHandle("u_BRDF_LUTMap");
+		}
+
+		s_RendererData->SceneShader = shader;
 		if (shader)
 		{
 			// Set Common Shader Uniforms
 			shader->Bind();
-			shader->SetUniformMat4("u_ViewProjection", view_projection_matrix);
-			shader->SetUniformFloat3("u_ViewPos", camera_pos);
-			shader->SetUniformFloat3("u_SceneColor", s_RendererData->SceneColor);
+			shader->SetUniformMat4(uniforms.ViewProjection, projection_matrix * view_matrix);
+			shader->SetUniformFloat3(uniforms.ViewPos, camera_pos);
+			shader->SetUniformFloat3(uniforms.SceneColor, s_RendererData->SceneColor);
 
 			// Bind Environment Textures
 			if (s_RendererData->IrradianceCubemap && s_RendererData->PrefilterCubemap && s_RendererData->BRDF_LutTexture)
@@ -174,52 +349,13 @@ namespace Kaimos {
 				s_RendererData->IrradianceCubemap->Bind(29);
 				s_RendererData->PrefilterCubemap->Bind(30);
 				s_RendererData->BRDF_LutTexture->Bind(31);
-				shader->SetUniformInt("u_IrradianceMap", 29);
-				shader->SetUniformInt("u_PrefilterSpecularMap", 30);
-				shader->SetUniformInt("u_BRDF_LUTMap", 31);
-			}
-
-			// Set Directional Lights Uniforms
-			uint dir_lights_num = dir_lights.size() >= s_RendererData->MaxDirLights ? s_RendererData->MaxDirLights : dir_lights.size();
-			shader->SetUniformInt("u_DirectionalLightsNum", dir_lights_num);
-
-			for (uint i = 0; i < dir_lights_num; ++i)
-			{
-				Ref<Light> light = dir_lights[i].first;
-				std::string light_array_uniform = "u_DirectionalLights[" + std::to_string(i) + "].";
-
-				shader->SetUniformFloat4(light_array_uniform + "Radiance", light->Radiance);
-				shader->SetUniformFloat3(light_array_uniform + "Direction", dir_lights[i].second);
-				shader->SetUniformFloat(light_array_uniform + "Intensity", light->Intensity);
-				shader->SetUniformFloat(light_array_uniform + "SpecularStrength", light->SpecularStrength);
+				shader->SetUniformInt(uniforms.IrradianceMap, 29);
+				shader->SetUniformInt(uniforms.PrefilterSpecularMap, 30);
+				shader->SetUniformInt(uniforms.BRDF_LUTMap, 31);
 			}
 
-			// Set Point Lights Uniforms
-			uint point_lights_num = point_lights.size() >= s_RendererData->MaxPointLights ? s_RendererData->MaxPointLights : point_lights.size();
-			shader->SetUniformInt("u_PointLightsNum", point_lights_num);
-
-			for (uint i = 0; i < point_lights_num; ++i)
-			{
-				Ref<PointLight> light = point_lights[i].first;
-				std::string light_array_uniform = "u_PointLights[" + std::to_string(i) + "].";
-
-				// if()else() with pbr_pipeline passing (or not) values to it
-				shader->SetUniformFloat4(light_array_uniform + "Radiance", light->Radiance);
-				shader->SetUniformFloat3(light_array_uniform + "Position", point_lights[i].second);
-				shader->SetUniformFloat(light_array_uniform + "Intensity", light->Intensity);
-				shader->SetUniformFloat(light_array_uniform + "FalloffFactor", light->FalloffMultiplier);
-				shader->SetUniformFloat(light_array_uniform + "SpecularStrength", light->SpecularStrength);
-
-				if (s_RendererData->PBR_Pipeline)
-					shader->SetUniformFloat(light_array_uniform + "Radius", light->GetMinRadius());
-				else
-				{
-					shader->SetUniformFloat(light_array_uniform + "MinRadius", light->GetMinRadius());
-					shader->SetUniformFloat(light_array_uniform + "MaxRadius", light->GetMaxRadius());
-					shader->SetUniformFloat(light_array_uniform + "AttL", light->GetLinearAttenuationFactor());
-					shader->SetUniformFloat(light_array_uniform + "AttQ", light->GetQuadraticAttenuationFactor());
-				}
-			}
+			// Upload Lights
+			UploadLights(view_matrix, projection_matrix, dir_lights);
 		}
 		else
 			KS_FATAL_ERROR("Renderer: Tried to Render with a null Shader!");
@@ -268,6 +404,140 @@ namespace Kaimos {
 		//vertexArray->Unbind(); //TODO: ?
 	}
 
+	void Renderer::ClusterLights(uint view_id, const glm::mat4& view_matrix, const glm::mat4& projection_matrix, const std::vector<std::pair<Ref<PointLight>, glm::vec3>>& point_lights)
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- Point Lights (shared by all the views, only uploaded if they changed) --
+		std::vector<PointLightData> point_lights_data(glm::min<size_t>(point_lights.size(), MaxPointLights));
+		for (size_t i = 0; i < point_lights_data.size(); ++i)
+		{
+			const Ref<PointLight>& light = point_lights[i].first;
+			PointLightData& light_data = point_lights_data[i];
+
+			light_data.Radiance = light->Radiance;
+			light_data.Position = point_lights[i].second;
+			light_data.Intensity = light->Intensity;
+			light_data.SpecularStrength = light->SpecularStrength;
+			light_data.MinRadius = light->GetMinRadius();
+			light_data.MaxRadius = light->GetMaxRadius();
+			light_data.FalloffFactor = light->FalloffMultiplier;
+			light_data.AttL = light->GetLinearAttenuationFactor();
+			light_data.AttQ = light->GetQuadraticAttenuationFactor();
+		}
+
+		const std::vector<PointLightData>& last_point_lights = s_RendererData->PointLightsData;
+		if (s_RendererData->PointLightsVersion == 0 || point_lights_data.size() != last_point_lights.size()
+			|| std::memcmp(point_lights_data.data(), last_point_lights.data(), point_lights_data.size() * sizeof(PointLightData)) != 0)
+		{
+			if (!point_lights_data.empty())
+				s_RendererData->PointLightsSSBO->SetData(point_lights_data.data(), (uint)(point_lights_data.size() * sizeof(PointLightData)));
+
+			s_RendererData->PointLightsData = std::move(point_lights_data);
+			++s_RendererData->PointLightsVersion;
+		}
+
+		// -- View Selection (a new view takes a free one or the least recently used) --
+		std::vector<LightsView>& views = s_RendererData->LightsViews;
+		std::vector<LightsView>::iterator view_it = std::find_if(views.begin(), views.end(), [view_id](const LightsView& view) { return view.ViewID == view_id; });
+		if (view_it == views.end())
+		{
+			if (views.size() < MaxLightsViews)
+			{
+				LightsView& new_view = views.emplace_back();
+				new_view.ClustersSSBO = StorageBuffer::Create(LightClusters::ClustersCount * sizeof(LightClusters::Cluster), LightClustersSSBOBinding);
+				new_view.IndicesSSBO = StorageBuffer::Create(MaxClusterLightIndices * sizeof(uint), LightIndicesSSBOBinding);
+				view_it = views.end() - 1;
+				s_RendererData->CurrentLightsView = UINT_MAX;
+			}
+			else
+				view_it = std::min_element(views.begin(), views.end(), [](const LightsView& a, const LightsView& b) { return a.LastUse < b.LastUse; });
+
+			view_it->ViewID = view_id;
+			view_it->PointLightsVersion = 0;
+		}
+
+		LightsView& lights_view = *view_it;
+		lights_view.LastUse = ++s_RendererData->LightsViewsUses;
+
+		uint view_index = (uint)(view_it - views.begin());
+		if (view_index != s_RendererData->CurrentLightsView)
+		{
+			lights_view.ClustersSSBO->Bind();
+			lights_view.IndicesSSBO->Bind();
+			s_RendererData->CurrentLightsView = view_index;
+		}
+
+		// -- Point Lights Clustering --
+		// Without point lights all the clusters are empty whatever the camera, so moving it doesn't re-upload them
+		// MaxRadius is the influence range, though the PBR shader cuts the lights at MinRadius, so the biggest is taken
+		const std::vector<PointLightData>& lights_data = s_RendererData->PointLightsData;
+		bool lights_changed = lights_view.PointLightsVersion != s_RendererData->PointLightsVersion;
+		bool camera_changed = view_matrix != lights_view.View || projection_matrix != lights_view.Projection;
+
+		if (lights_changed || (camera_changed && !lights_data.empty()))
+		{
+			std::vector<Maths::BoundingSphere> light_spheres;
+			light_spheres.reserve(lights_data.size());
+			for (const PointLightData& light_data : lights_data)
+				light_spheres.push_back({ light_data.Position, glm::max(light_data.MinRadius, light_data.MaxRadius) });
+
+			LightClusters& clusters = lights_view.Clusters;
+			clusters.Build(view_matrix, projection_matrix, light_spheres, MaxClusterLightIndices);
+			lights_view.ClustersSSBO->SetData(clusters.GetClusters().data(), LightClusters::ClustersCount * sizeof(LightClusters::Cluster));
+
+			const std::vector<uint>& light_indices = clusters.GetLightIndices();
+			if (!light_indices.empty())
+				lights_view.IndicesSSBO->SetData(light_indices.data(), (uint)(light_indices.size() * sizeof(uint)));
+
+			lights_view.View = view_matrix;
+			lights_view.Projection = projection_matrix;
+			lights_view.PointLightsVersion = s_RendererData->PointLightsVersion;
+		}
+	}
+
+
+
+	// ----------------------- Private Renderer Methods ------------------------------------------------------
+	// Packs the directional lights into the lights uniform block, along with the clusters parameters of the current lights view
+	void Renderer::UploadLights(const glm::mat4& view_matrix, const glm::mat4& projection_matrix, const std::vector<std::pair<Ref<Light>, glm::vec3>>& dir_lights)
+	{
+		KS_PROFILE_FUNCTION();
+		LightsUBOData data = {};
+		data.View = view_matrix;
+		data.Projection = projection_matrix;
+
+		// -- Directional Lights --
+		data.DirectionalLightsNum = (int)glm::min<size_t>(dir_lights.size(), MaxDirLights);
+		for (int i = 0; i < data.DirectionalLightsNum; ++i)
+		{
+			const Ref<Light>& light = dir_lights[i].first;
+			DirectionalLightData& light_data = data.DirectionalLights[i];
+
+			light_data.Radiance = light->Radiance;
+			light_data.Direction = dir_lights[i].second;
+			light_data.Intensity = light->Intensity;
+			light_data.SpecularStrength = light->SpecularStrength;
+		}
+
+		// -- Clusters Parameters (of the view clustered last, see ClusterLights()) --
+		const std::vector<LightsView>& views = s_RendererData->LightsViews;
+		const LightClusters* clusters = s_RendererData->CurrentLightsView < views.size() ? &views[s_RendererData->CurrentLightsView].Clusters : nullptr;
+		data.ClusterDepthParameters = clusters ? clusters->GetDepthParameters() : glm::vec4(0.0f);
+		data.ClusterGrid = glm::ivec4(LightClusters::GridX, LightClusters::GridY, LightClusters::GridZ, clusters && clusters->IsPerspective() ? 1 : 0);
+
+		// -- Lights Uniform Block Upload (only the used part of the Directional Lights array) --
+		const LightsUBOData& last_data = s_RendererData->LightsData;
+		if (!s_RendererData->LightsDataUploaded || std::memcmp(&data, &last_data, sizeof(LightsUBOData)) != 0)
+		{
+			uint upload_size = (uint)(offsetof(LightsUBOData, DirectionalLights) + data.DirectionalLightsNum * sizeof(DirectionalLightData));
+			s_RendererData->LightsUBO->SetData(&data, upload_size);
+			s_RendererData->LightsData = data;
+		}
+
+		s_RendererData->LightsDataUploaded = true;
+	}
+
 
 
 	// ----------------------- Public Renderer Serialization Methods -----------------------------------------
@@ -276,8 +546,11 @@ namespace Kaimos {
 		KS_PROFILE_FUNCTION();
 		KS_TRACE("Serializing Kaimos Renderer");
 
-		// -- Begin Renderer Map --
-		YAML::Emitter output;
+		// -- Begin Renderer Map (written into a temporary file as it goes, replacing the save file at the end) --
+		std::string filepath = INTERNAL_SETTINGS_PATH + std::string("KaimosRendererSettings.kaimossave");
+		std::ofstream file(GetYAMLTempFilepath(filepath), std::ios::trunc);
+
+		YAML::Emitter output(file);
 		output << YAML::BeginMap;
 		output << YAML::Key << "KaimosSaveFile" << YAML::Value << "KaimosRenderer";
 		
@@ -299,10 +572,8 @@ namespace Kaimos {
 		output << YAML::EndSeq;
 		output << YAML::EndMap;
 
-		// -- Save File --
-		std::string filepath = INTERNAL_SETTINGS_PATH + std::string("KaimosRendererSettings.kaimossave");
-		std::ofstream file(filepath.c_str());
-		file << output.c_str();
+		if (!CommitYAMLFile(file, filepath, output.good()))
+			KS_ERROR("Couldn't write '{0}' file", filepath);
 	}
 
 	void Renderer::DeserializeRenderer()
@@ -322,7 +593,56 @@ namespace Kaimos {
 			return;
 		}
 
-		try { data = YAML::LoadFile(filename); }
+		// -- Setup (before the first material, as the settings come first in the file) --
+		bool setup_done = false;
+		auto setup = [&setup_done](const YAML::Node& root)
+		{
+			if (setup_done)
+				return;
+
+			setup_done = true;
+			if (root["LastScene"])
+				SetLastScene(root["LastScene"].as<std::string>());
+
+			if (root["DefaultMaterialID"])
+				CreateDefaultMaterial(root["DefaultMaterialID"].as<uint>());
+			else
+				CreateDefaultMaterial();
+		};
+
+		// -- Materials (as the file is parsed, without keeping the previous materials nodes) --
+		auto on_material = [&setup](const YAML::Node& material_subnode, const YAML::Node& root)
+		{
+			if (!root["KaimosSaveFile"])
+				return;
+
+			setup(root);
+			auto graph_subnode = material_subnode["AttachedGraph"];
+			if (material_subnode["Material"] && graph_subnode)
+			{
+				// Get or Create Material with ID
+				uint mat_id = material_subnode["Material"].as<uint>();
+				Ref<Material> material = GetMaterial(mat_id);
+				if (!material)
+				{
+					const std::string mat_name = material_subnode["Name"] ? material_subnode["Name"].as<std::string>() : "MAT_NONAME_ONLOAD";
+					material = CreateMaterialWithID(mat_id, mat_name);
+				}
+
+				// Remove the Graph (if exists)
+				material->RemoveGraph();
+
+				// Create a graph with ID and call him to deseralize passing file
+				uint graph_id = graph_subnode["MaterialGraph"].as<uint>();
+				ScopePtr<MaterialEditor::MaterialGraph> mat_graph = CreateScopePtr<MaterialEditor::MaterialGraph>(new MaterialEditor::MaterialGraph(graph_id));
+				mat_graph->DeserializeGraph(graph_subnode, material);
+
+				// Finally, assign graph & texture to material
+				material->SetGraphUniqueRef(mat_graph);
+			}
+		};
+
+		try { data = LoadYAMLFileStreamed(filename, "Materials", on_material); }
 		catch (const YAML::ParserException& exception)
 		{
 			KS_ERROR("Error Loading Renderer\nError: {0}", exception.what());
@@ -335,45 +655,8 @@ namespace Kaimos {
 			return;
 		}
 
-		// -- Setup --
-		if (data["LastScene"])
-			SetLastScene(data["LastScene"].as<std::string>());
-
-		if (data["DefaultMaterialID"])
-			CreateDefaultMaterial(data["DefaultMaterialID"].as<uint>());
-		else
-			CreateDefaultMaterial();
-
-		YAML::Node materials_node = data["Materials"];
-		if (materials_node)
-		{
-			for (auto material_subnode : materials_node)
-			{
-				auto graph_subnode = material_subnode["AttachedGraph"];
-				if (material_subnode["Material"] && graph_subnode)
-				{
-					// Get or Create Material with ID
-					uint mat_id = material_subnode["Material"].as<uint>();
-					Ref<Material> material = GetMaterial(mat_id);
-					if (!material)
-					{
-						const std::string mat_name = material_subnode["Name"] ? material_subnode["Name"].as<std::string>() : "MAT_NONAME_ONLOAD";
-						material = CreateMaterialWithID(mat_id, mat_name);
-					}
-
-					// Remove the Graph (if exists)
-					material->RemoveGraph();
-
-					// Create a graph with ID and call him to deseralize passing file
-					uint graph_id = graph_subnode["MaterialGraph"].as<uint>();
-					ScopePtr<MaterialEditor::MaterialGraph> mat_graph = CreateScopePtr<MaterialEditor::MaterialGraph>(new MaterialEditor::MaterialGraph(graph_id));
-					mat_graph->DeserializeGraph(graph_subnode, material);
-
-					// Finally, assign graph & texture to material
-					material->SetGraphUniqueRef(mat_graph);
-				}
-			}
-		}
+		// -- Setup (if there were no materials) --
+		setup(data);
 	}
 
 
@@ -438,12 +721,27 @@ namespace Kaimos {
 
 	const uint Renderer::GetMaxDirLights()
 	{
-		return s_RendererData->MaxDirLights;
+		return MaxDirLights;
 	}
 
 	const uint Renderer::GetMaxPointLights()
 	{
-		return s_RendererData->MaxPointLights;
+		return MaxPointLights;
+	}
+
+	bool Renderer::IsBindlessTexturesSupported()
+	{
+		return RenderCommand::SupportsBindlessTextures();
+	}
+
+	bool Renderer::IsBindlessTexturesEnabled()
+	{
+		return s_RendererData->BindlessTexturesEnabled;
+	}
+
+	void Renderer::SetBindlessTexturesEnabled(bool enabled)
+	{
+		s_RendererData->BindlessTexturesEnabled = enabled;
 	}
 
 	bool Renderer::IsSceneInPBRPipeline()
@@ -461,6 +759,11 @@ namespace Kaimos {
 		}
 	}
 
+	Ref<Shader> Renderer::GetSceneShader()
+	{
+		return s_RendererData->SceneShader;
+	}
+
 	uint Renderer::GetEnvironmentMapID()
 	{
 		if (s_RendererData->EnvironmentHDRMap)
@@ -764,6 +1067,7 @@ namespace Kaimos {
 	void Renderer::ResetTextureSlotIndex()
 	{
 		s_RendererData->TextureSlotIndex = 2; // 0 is white texture, 1 is normal texture
+		s_RendererData->TextureSlotIndices.clear();
 	}
 
 	void Renderer::BindTextures()
@@ -795,43 +1099,129 @@ namespace Kaimos {
 		if (s_RendererData->TextureSlotIndex >= (s_RendererData->MaxTextureSlots - tex_count - 1))
 		{
 			NextBatchFunction();
-			s_RendererData->TextureSlotIndex = 2; // 0 is white texture, 1 is normal texture
+			ResetTextureSlotIndex();
 		}
 	}
 
 	uint Renderer::GetTextureIndex(const Ref<Texture2D>& texture, bool is_normal, std::function<void()> NextBatchFunction)
 	{
-		uint ret = is_normal ? 1 : 0;
-		if (texture)
+		if (!texture)
+			return is_normal ? 1 : 0;
+
+		// -- Find Texture if Exists --
+		auto it = s_RendererData->TextureSlotIndices.find(texture->GetTextureID());
+		if (it != s_RendererData->TextureSlotIndices.end())
+			return it->second;
+
+		// -- If it doesn't exists, add it to batch data (New Batch if Needed) --
+		if (s_RendererData->TextureSlotIndex >= s_RendererData->MaxTextureSlots)
 		{
-			// -- Find Texture if Exists --
-			for (uint i = 1; i < s_RendererData->TextureSlotIndex; ++i)
-			{
-				if (*s_RendererData->TextureSlots[i] == *texture)
-				{
-					ret = i;
-					break;
-				}
-			}
+			NextBatchFunction();
+			ResetTextureSlotIndex();
+		}
 
-			// -- If it doesn't exists, add it to batch data --
-			if (ret == 0 || ret == 1)
-			{
-				// - New Batch if Needed -
-				if (s_RendererData->TextureSlotIndex >= s_RendererData->MaxTextureSlots)
-				{
-					NextBatchFunction();
-					s_RendererData->TextureSlotIndex = 2; // 0 is white texture, 1 is normal texture
-				}
+		uint slot = s_RendererData->TextureSlotIndex++;
+		s_RendererData->TextureSlots[slot] = texture;
+		s_RendererData->TextureSlotIndices.insert({ texture->GetTextureID(), slot });
+		return slot;
+	}
 
-				// - Set Texture -
-				ret = s_RendererData->TextureSlotIndex;
-				s_RendererData->TextureSlots[s_RendererData->TextureSlotIndex] = texture;
-				++s_RendererData->TextureSlotIndex;
-			}
+	MaterialTextureIndices Renderer::GetMaterialTextureIndices(const Ref<Material>& material, std::function<void()> NextBatchFunction)
+	{
+		// -- Bindless Textures: Indices of the Material Texture Handles (no slots used) --
+		MaterialTextureIndices tex_indices;
+		if (s_RendererData->BindlessTextures)
+		{
+			tex_indices.Albedo = (uint)MATERIAL_TEXTURES::ALBEDO;
+			tex_indices.Normal = (uint)MATERIAL_TEXTURES::NORMAL;
+			tex_indices.Specular = (uint)MATERIAL_TEXTURES::SPECULAR;
+			tex_indices.Roughness = (uint)MATERIAL_TEXTURES::ROUGHNESS;
+			tex_indices.Metallic = (uint)MATERIAL_TEXTURES::METALLIC;
+			tex_indices.AmbientOcc = (uint)MATERIAL_TEXTURES::AMBIENT_OC;
+			return tex_indices;
+		}
+
+		// -- Texture Slots of the Batch --
+		CheckMaterialFitsInBatch(material, NextBatchFunction);
+		tex_indices.Albedo = GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::ALBEDO), false, NextBatchFunction);
+		tex_indices.Normal = GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::NORMAL), true, NextBatchFunction);
+
+		if (s_RendererData->PBR_Pipeline)
+		{
+			tex_indices.Roughness = GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::ROUGHNESS), false, NextBatchFunction);
+			tex_indices.Metallic = GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::METALLIC), false, NextBatchFunction);
+			tex_indices.AmbientOcc = GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::AMBIENT_OC), false, NextBatchFunction);
 		}
+		else
+			tex_indices.Specular = GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::SPECULAR), false, NextBatchFunction);
 
-		return ret;
+		return tex_indices;
+	}
+
+
+
+	// ----------------------- Public Renderer Materials Table Methods ---------------------------------------
+	uint Renderer::GetMaterialTableIndex(const Ref<Material>& material, const MaterialTextureIndices& tex_indices)
+	{
+		// -- Find Material Entry (materials created out of the renderer get one now) --
+		auto it = s_RendererData->MaterialsTableIndices.find(material->GetID());
+		uint index = it != s_RendererData->MaterialsTableIndices.end() ? it->second : AddMaterialTableEntry(material->GetID());
+
+		// -- Patch the Entry if the Material or its Texture Slots changed --
+		MaterialData data = GetMaterialData(*material, tex_indices, s_RendererData->BindlessTextures, s_RendererData->DefaultTextures);
+		MaterialData& entry = s_RendererData->MaterialsTable[index];
+		if (memcmp(&entry, &data, sizeof(MaterialData)) != 0)
+		{
+			entry = data;
+			s_RendererData->DirtyMaterialsBegin = glm::min(s_RendererData->DirtyMaterialsBegin, index);
+			s_RendererData->DirtyMaterialsEnd = glm::max(s_RendererData->DirtyMaterialsEnd, index + 1);
+		}
+
+		return index;
+	}
+
+	void Renderer::UploadMaterialsTable()
+	{
+		KS_PROFILE_FUNCTION();
+		if (s_RendererData->DirtyMaterialsBegin >= s_RendererData->DirtyMaterialsEnd)
+			return;
+
+		// -- Grow Buffer if the Table doesn't fit (then it's all re-uploaded) --
+		uint table_size = (uint)s_RendererData->MaterialsTable.size();
+		if (table_size > s_RendererData->MaterialsSSBOCapacity)
+		{
+			s_RendererData->MaterialsSSBOCapacity = glm::max(table_size, s_RendererData->MaterialsSSBOCapacity * 2);
+			s_RendererData->MaterialsSSBO = StorageBuffer::Create(s_RendererData->MaterialsSSBOCapacity * sizeof(MaterialData), MaterialsSSBOBinding);
+			s_RendererData->DirtyMaterialsBegin = 0;
+			s_RendererData->DirtyMaterialsEnd = table_size;
+		}
+
+		// -- Upload Changed Entries --
+		uint begin = s_RendererData->DirtyMaterialsBegin, count = s_RendererData->DirtyMaterialsEnd - begin;
+		s_RendererData->MaterialsSSBO->SetData(&s_RendererData->MaterialsTable[begin], count * sizeof(MaterialData), begin * sizeof(MaterialData));
+
+		s_RendererData->DirtyMaterialsBegin = UINT_MAX;
+		s_RendererData->DirtyMaterialsEnd = 0;
+	}
+
+	uint64_t Renderer::GetMaterialSortKey(uint material_id)
+	{
+		auto material_it = s_RendererData->Materials.find(material_id);
+		if (material_it == s_RendererData->Materials.end())
+			return 0;
+
+		// -- Texture Set: (FNV-1a) Hash of the Material Textures --
+		uint64_t texture_set = 14695981039346656037ull;
+		for (uint i = 0; i < MaterialData::TexturesCount; ++i)
+		{
+			const Ref<Texture2D>& texture = material_it->second->GetTexture((MATERIAL_TEXTURES)i);
+			texture_set = (texture_set ^ (texture ? texture->GetTextureID() : 0)) * 1099511628211ull;
+		}
+
+		// -- Material: Index in the Materials Table (or its ID if it has no entry yet) --
+		auto index_it = s_RendererData->MaterialsTableIndices.find(material_id);
+		uint material_index = index_it != s_RendererData->MaterialsTableIndices.end() ? index_it->second : material_id;
+		return RenderQueue::GetMaterialKey((uint)(texture_set ^ (texture_set >> 32)), material_index);
 	}
 
 
@@ -840,7 +1230,7 @@ namespace Kaimos {
 	Ref<Material> Renderer::CreateMaterial(const std::string& name)
 	{
 		Ref<Material> material = CreateRef<Material>(name);
-		s_RendererData->Materials.insert({ material->GetID(), material });
+		AddMaterial(material);
 		return material;
 	}
 
@@ -857,6 +1247,21 @@ namespace Kaimos {
 		return s_RendererData->Materials.find(material_id) != s_RendererData->Materials.end();
 	}
 
+	void Renderer::AddMaterial(const Ref<Material>& material)
+	{
+		if (s_RendererData->Materials.insert({ material->GetID(), material }).second)
+			AddMaterialTableEntry(material->GetID());
+	}
+
+	uint Renderer::AddMaterialTableEntry(uint material_id)
+	{
+		// Values are set on the first draw of the material, as its texture slots aren't known until then
+		uint index = (uint)s_RendererData->MaterialsTable.size();
+		s_RendererData->MaterialsTable.push_back(MaterialData());
+		s_RendererData->MaterialsTableIndices.insert({ material_id, index });
+		return index;
+	}
+
 	void Renderer::CreateDefaultMaterial(uint default_mat_id)
 	{
 		if (!MaterialExists(s_RendererData->DefaultMaterialID))
@@ -864,12 +1269,12 @@ namespace Kaimos {
 			if (default_mat_id == 0)
 			{
 				Ref<Material> material = CreateRef<Material>("DefaultMaterial");
-				s_RendererData->Materials.insert({ material->GetID(), material });
+				AddMaterial(material);
 				s_RendererData->DefaultMaterialID = material->GetID();
 			}
 			else
 			{
-				s_RendererData->Materials.insert({ default_mat_id, CreateRef<Material>(new Material(default_mat_id, "DefaultMaterial")) });
+				AddMaterial(CreateRef<Material>(new Material(default_mat_id, "DefaultMaterial")));
 				s_RendererData->DefaultMaterialID = default_mat_id;
 			}
 		}
@@ -886,7 +1291,7 @@ namespace Kaimos {
 		}
 
 		Ref<Material> mat = CreateRef<Material>(new Material(material_id, name));
-		s_RendererData->Materials.insert({ material_id, mat });
+		AddMaterial(mat);
 		return mat;
 	}
 
@@ -10,6 +10,7 @@ namespace Kaimos {
 	class Material;
 	class Shader;
 	class Texture2D;
+	struct MaterialTextureIndices;
 
 	class Light;
 	class PointLight;
@@ -24,10 +25,14 @@ namespace Kaimos {
 		static void Shutdown();
 
 		// --- Public Renderer Methods ---
-		static bool BeginScene(const glm::mat4& view_projection_matrix, const glm::vec3& camera_pos, const std::vector<std::pair<Ref<Light>, glm::vec3>>& dir_lights, const std::vector<std::pair<Ref<PointLight>, glm::vec3>>& point_lights);
+		static bool BeginScene(const glm::mat4& view_matrix, const glm::mat4& projection_matrix, const glm::vec3& camera_pos, const std::vector<std::pair<Ref<Light>, glm::vec3>>& dir_lights, bool instanced_rendering = false);
 		static void EndScene(const glm::mat4& view_matrix, const glm::mat4& projection_matrix);
 
 		static void Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertex_array, const glm::mat4& transformation = glm::mat4(1.0f));
+
+		// Uploads the point lights & clusters them for a view (like a camera entity ID), the scene is then begun with the same view
+		// Clustering waits for the Job System, so call it before dispatching the frame jobs that rendering mustn't wait for (like timed vertices)
+		static void ClusterLights(uint view_id, const glm::mat4& view_matrix, const glm::mat4& projection_matrix, const std::vector<std::pair<Ref<PointLight>, glm::vec3>>& point_lights);
 		
 		// --- Public Renderer Serialization Methods ---
 		static void SerializeRenderer();
@@ -52,8 +57,13 @@ namespace Kaimos {
 		static const uint GetMaxDirLights();
 		static const uint GetMaxPointLights();
 
+		static bool IsBindlessTexturesSupported();
+		static bool IsBindlessTexturesEnabled();
+		static void SetBindlessTexturesEnabled(bool enabled);
+
 		static bool IsSceneInPBRPipeline();
 		static void SetPBRPipeline(bool pbr_pipeline);
+		static Ref<Shader> GetSceneShader();
 
 		static uint GetEnvironmentMapID();
 		static glm::ivec2 GetEnvironmentMapSize();
@@ -82,6 +92,18 @@ namespace Kaimos {
 		static void CheckMaterialFitsInBatch(const Ref<Material>& material, std::function<void()> NextBatchFunction);
 		static uint GetTextureIndex(const Ref<Texture2D>& texture, bool is_normal, std::function<void()> NextBatchFunction);
 
+		// Indices of the material textures for the current scene: texture slots of the batch, or the handles of its materials table entry if bindless textures are used
+		static MaterialTextureIndices GetMaterialTextureIndices(const Ref<Material>& material, std::function<void()> NextBatchFunction);
+
+		// --- Public Renderer Materials Table Methods ---
+		// Index of the material in the GPU materials table, its entry is patched if the material values or texture slots changed
+		// The batch renderers must upload the table (only the changed entries are) before drawing
+		static uint GetMaterialTableIndex(const Ref<Material>& material, const MaterialTextureIndices& tex_indices);
+		static void UploadMaterialsTable();
+
+		// Material field of the render queue sort keys (only reads the renderer data, so render queues can be built in the Job System)
+		static uint64_t GetMaterialSortKey(uint material_id);
+
 		// --- Public Renderer Materials Methods ---
 		static Ref<Material> CreateMaterial(const std::string& name);
 		static bool IsDefaultMaterial(uint material_id);
@@ -96,11 +118,16 @@ namespace Kaimos {
 
 	private:
 
+		// --- Private Renderer Methods ---
+		static void UploadLights(const glm::mat4& view_matrix, const glm::mat4& projection_matrix, const std::vector<std::pair<Ref<Light>, glm::vec3>>& dir_lights);
+
 		// --- Private Environment Map Methods ---
 		static void CompileEnvironmentMap();
 
 		// --- Private Renderer Materials & Shaders Methods ---
 		inline static bool MaterialExists(uint material_id);
+		static void AddMaterial(const Ref<Material>& material);
+		static uint AddMaterialTableEntry(uint material_id);
 		static void CreateDefaultMaterial(uint default_mat_id = 0);
 		static Ref<Material> CreateMaterialWithID(uint material_id, const std::string& name);
 
@@ -3,6 +3,7 @@
 
 #include "Foundations/RenderCommand.h"
 #include "Resources/Buffer.h"
+#include "Resources/BatchFormats.h"
 #include "Resources/Material.h"
 
 #include "Scene/ECS/Components.h"
@@ -19,18 +20,16 @@ namespace Kaimos {
 
 		static const uint MaxQuads = 20000;
 		static const uint MaxIndices = MaxQuads * 6;
+		static const uint StreamedBatches = 3;		// Batches fitting in the vertex rings, so the GPU can draw some while others are written
 
+		// Batch vertices are written straight into the (mapped) ring of the vertex buffer in use
+		// (both pipelines share the vertex format, the material values of each come from the materials table)
 		uint QuadIndicesDrawCount = 0;
-		NonPBRQuadVertex* NonPBR_QuadVBufferBase	= nullptr;
-		NonPBRQuadVertex* NonPBR_QuadVBufferPtr		= nullptr;
+		BatchVertex* QuadVBufferBase		= nullptr;
+		BatchVertex* QuadVBufferPtr			= nullptr;
 
-		PBRQuadVertex* PBR_QuadVBufferBase			= nullptr;
-		PBRQuadVertex* PBR_QuadVBufferPtr			= nullptr;
-
-		Ref<VertexArray> QuadVArray					= nullptr;
-		Ref<VertexBuffer> QuadVBuffer				= nullptr;
-		Ref<VertexArray> PBRQuadVArray				= nullptr;
-		Ref<VertexBuffer> PBRQuadVBuffer			= nullptr;
+		Ref<VertexArray> QuadVArray			= nullptr;
+		Ref<VertexBuffer> QuadVBuffer		= nullptr;
 	};
 	
 	static Renderer2DData* s_Data = nullptr;	// On shutdown, this is deleted, and ~VertexArray() called, freeing GPU Memory too
@@ -83,66 +82,20 @@ namespace Kaimos {
 		// -- Vertex Buffer & Array --
 		const uint max_vertices = s_Data->MaxQuads * 4;
 
-		s_Data->NonPBR_QuadVBufferBase = new NonPBRQuadVertex[max_vertices];
 		s_Data->QuadVArray = VertexArray::Create();
-		s_Data->QuadVBuffer = VertexBuffer::Create(max_vertices * sizeof(NonPBRQuadVertex));
-
-		s_Data->PBR_QuadVBufferBase = new PBRQuadVertex[max_vertices];
-		s_Data->PBRQuadVArray = VertexArray::Create();
-		s_Data->PBRQuadVBuffer = VertexBuffer::Create(max_vertices * sizeof(PBRQuadVertex));
+		s_Data->QuadVBuffer = VertexBuffer::CreateStreaming(s_Data->StreamedBatches * max_vertices * sizeof(BatchVertex));
 
 		// -- Vertex Layout & Index Buffer Creation --
 		index_buffer = IndexBuffer::Create(quad_indices, s_Data->MaxIndices);
-		BufferLayout non_pbr_layout = {
-			{ SHADER_DATATYPE::FLOAT3,	"a_Position" },
-			{ SHADER_DATATYPE::FLOAT3,	"a_Normal" },
-			{ SHADER_DATATYPE::FLOAT3,	"a_Tangent" },
-			{ SHADER_DATATYPE::FLOAT2,	"a_TexCoord" },
-			{ SHADER_DATATYPE::FLOAT4,	"a_Color" },
-			{ SHADER_DATATYPE::FLOAT,	"a_NormalStrength" },
-			{ SHADER_DATATYPE::INT,		"a_TexIndex" },
-			{ SHADER_DATATYPE::INT,		"a_NormTexIndex" },
-			{ SHADER_DATATYPE::INT,		"a_EntityID" },
-
-			{ SHADER_DATATYPE::FLOAT ,	"a_Shininess" },
-			{ SHADER_DATATYPE::FLOAT ,	"a_SpecularStrength" },
-			{ SHADER_DATATYPE::INT ,	"a_SpecTexIndex" }
-		};
-
-		BufferLayout pbr_layout = {
-			{ SHADER_DATATYPE::FLOAT3,	"a_Position" },
-			{ SHADER_DATATYPE::FLOAT3,	"a_Normal" },
-			{ SHADER_DATATYPE::FLOAT3,	"a_Tangent" },
-			{ SHADER_DATATYPE::FLOAT2,	"a_TexCoord" },
-			{ SHADER_DATATYPE::FLOAT4,	"a_Color" },
-			{ SHADER_DATATYPE::FLOAT,	"a_NormalStrength" },
-			{ SHADER_DATATYPE::INT,		"a_TexIndex" },
-			{ SHADER_DATATYPE::INT,		"a_NormTexIndex" },
-			{ SHADER_DATATYPE::INT,		"a_EntityID" },
-
-			{ SHADER_DATATYPE::FLOAT,	"a_Roughness" },
-			{ SHADER_DATATYPE::FLOAT,	"a_Metallic" },
-			{ SHADER_DATATYPE::FLOAT,	"a_AmbientOcclusionValue" },
-			{ SHADER_DATATYPE::INT,		"a_RoughTexIndex" },
-			{ SHADER_DATATYPE::INT,		"a_MetalTexIndex" },
-			{ SHADER_DATATYPE::INT,		"a_AOTexIndex" }
-		};
+		s_Data->QuadVBuffer->SetLayout(BatchVertex::GetLayout());
 
 		// -- Vertex Array Filling --
-		s_Data->QuadVBuffer->SetLayout(non_pbr_layout);
 		s_Data->QuadVArray->AddVertexBuffer(s_Data->QuadVBuffer);
 		s_Data->QuadVArray->SetIndexBuffer(index_buffer);
 
+		// -- Arrays Unbinding & Indices Deletion --
 		s_Data->QuadVArray->Unbind();
 		s_Data->QuadVBuffer->Unbind();
-
-		s_Data->PBRQuadVBuffer->SetLayout(pbr_layout);
-		s_Data->PBRQuadVArray->AddVertexBuffer(s_Data->PBRQuadVBuffer);
-		s_Data->PBRQuadVArray->SetIndexBuffer(index_buffer);
-
-		// -- Arrays Unbinding & Indices Deletion --
-		s_Data->PBRQuadVArray->Unbind();
-		s_Data->PBRQuadVBuffer->Unbind();
 		index_buffer->Unbind();
 		delete[] quad_indices;
 	}
@@ -155,8 +108,6 @@ namespace Kaimos {
 
 		// This is deleted here (manually), and not treated as smart pointer, waiting for the end of the program lifetime
 		// because there is still some code of the graphics (OpenGL) that it has to run to free VRAM (for ex. deleting VArrays, Shaders...)
-		delete[] s_Data->NonPBR_QuadVBufferBase;
-		delete[] s_Data->PBR_QuadVBufferBase;
 		delete s_Data;
 	}
 
@@ -166,7 +117,7 @@ namespace Kaimos {
 	void Renderer2D::BeginScene()
 	{
 		KS_PROFILE_FUNCTION();
-		Renderer::IsSceneInPBRPipeline() ? s_Data->PBRQuadVArray->Bind() : s_Data->QuadVArray->Bind();
+		s_Data->QuadVArray->Bind();
 		StartBatch();
 	}
 
@@ -187,25 +138,17 @@ namespace Kaimos {
 		if (s_Data->QuadIndicesDrawCount == 0)
 			return;
 
-		// -- Set Vertex Buffer Data --
+		// -- Commit Written Vertices --
 		// Data cast: uint8_t = 1 byte large, subtraction give elements in terms of bytes
-		Ref<VertexArray> v_array = nullptr;
-		if (Renderer::IsSceneInPBRPipeline())
-		{
-			uint data_size = (uint)((uint8_t*)s_Data->PBR_QuadVBufferPtr - (uint8_t*)s_Data->PBR_QuadVBufferBase);
-			s_Data->PBRQuadVBuffer->SetData(s_Data->PBR_QuadVBufferBase, data_size);
-			v_array = s_Data->PBRQuadVArray;
-		}
-		else
-		{
-			uint data_size = (uint)((uint8_t*)s_Data->NonPBR_QuadVBufferPtr - (uint8_t*)s_Data->NonPBR_QuadVBufferBase);
-			s_Data->QuadVBuffer->SetData(s_Data->NonPBR_QuadVBufferBase, data_size);
-			v_array = s_Data->QuadVArray;
-		}
+		uint data_size = (uint)((uint8_t*)s_Data->QuadVBufferPtr - (uint8_t*)s_Data->QuadVBufferBase);
+		uint base_vertex = s_Data->QuadVBuffer->Commit(data_size) / sizeof(BatchVertex);
 
-		// -- Bind Textures & Draw Vertex Array --
+		// -- Bind Textures & Materials & Draw Vertex Array --
+		// The quad indices are the same for all batches, base vertex offsets them to the batch vertices in the ring
 		Renderer::BindTextures();
-		RenderCommand::DrawIndexed(v_array, s_Data->QuadIndicesDrawCount);
+		Renderer::UploadMaterialsTable();
+		RenderCommand::DrawIndexedBaseVertex(s_Data->QuadVArray, s_Data->QuadIndicesDrawCount, 0, base_vertex);
+		s_Data->QuadVBuffer->Retire();
 		++s_Data->RendererStats.DrawCalls;
 	}
 	
@@ -214,10 +157,10 @@ namespace Kaimos {
 		KS_PROFILE_FUNCTION();
 		s_Data->QuadIndicesDrawCount = 0;
 
-		if(Renderer::IsSceneInPBRPipeline())
-			s_Data->PBR_QuadVBufferPtr = s_Data->PBR_QuadVBufferBase;
-		else
-			s_Data->NonPBR_QuadVBufferPtr = s_Data->NonPBR_QuadVBufferBase;
+		// -- Reserve a whole Batch in the Vertex Ring (waits if the GPU is still drawing it) --
+		const uint max_vertices = s_Data->MaxQuads * 4;
+		void* batch_memory = s_Data->QuadVBuffer->Reserve(max_vertices * sizeof(BatchVertex), sizeof(BatchVertex));
+		s_Data->QuadVBufferBase = s_Data->QuadVBufferPtr = (BatchVertex*)batch_memory;
 	}
 	
 	void Renderer2D::NextBatch()
@@ -227,19 +170,14 @@ namespace Kaimos {
 		StartBatch();
 	}
 
-	void Renderer2D::SetBaseVertexData(QuadVertex* dynamic_vertex, const QuadVertex& quad_vertex, const glm::mat4& transform, const Ref<Material>& material, uint albedo_ix, uint norm_ix, uint ent_id)
+	void Renderer2D::SetBaseVertexData(BatchVertex* dynamic_vertex, const QuadVertex& quad_vertex, const glm::mat4& transform, uint material_index, int ent_id)
 	{
 		dynamic_vertex->Pos = transform * glm::vec4(quad_vertex.Pos, 1.0f);
-		dynamic_vertex->Normal = glm::normalize(glm::vec3(transform * glm::vec4(quad_vertex.Normal, 0.0f)));
-		dynamic_vertex->Tangent = glm::normalize(glm::vec3(transform * glm::vec4(quad_vertex.Tangent, 0.0f)));
-		dynamic_vertex->TexCoord = quad_vertex.TexCoord;
-
-		dynamic_vertex->Color = material->Color;
-		dynamic_vertex->Bumpiness = material->Bumpiness;
-
-		dynamic_vertex->TexIndex = (int)albedo_ix;
-		dynamic_vertex->NormTexIndex = (int)norm_ix;
-		dynamic_vertex->EntityID = (int)ent_id;
+		dynamic_vertex->Normal = PackOctahedral(glm::normalize(glm::vec3(transform * glm::vec4(quad_vertex.Normal, 0.0f))));
+		dynamic_vertex->Tangent = PackOctahedral(glm::normalize(glm::vec3(transform * glm::vec4(quad_vertex.Tangent, 0.0f))));
+		dynamic_vertex->TexCoord = PackHalf2(quad_vertex.TexCoord);
+		dynamic_vertex->MaterialIndex = material_index;
+		dynamic_vertex->EntityID = ent_id;
 	}
 
 
@@ -256,62 +194,16 @@ namespace Kaimos {
 		if (!material)
 			KS_FATAL_ERROR("Tried to Render a Sprite with a null Material!");
 
-		// -- Update Sprite Timed Vertices --
-		static float accumulated_dt = 0.0f;
-		accumulated_dt += dt.GetMilliseconds();
-		if (accumulated_dt > 200.0f)
-		{
-			sprite_component.UpdateTimedVertices();
-			accumulated_dt = 0.0f;
-		}
-
 		// -- Get Texture indexes --
-		bool pbr = Renderer::IsSceneInPBRPipeline();
-		Renderer::CheckMaterialFitsInBatch(material, &NextBatch);
-
-		uint tex_ix, norm_ix, spec_ix, rough_ix, met_ix, ao_ix;
-		tex_ix = Renderer::GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::ALBEDO), false, &NextBatch);
-		norm_ix = Renderer::GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::NORMAL), true, &NextBatch);
-
-		if (pbr)
-		{
-			rough_ix = Renderer::GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::ROUGHNESS), false, &NextBatch);
-			met_ix = Renderer::GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::METALLIC), false, &NextBatch);
-			ao_ix = Renderer::GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::AMBIENT_OC), false, &NextBatch);
-		}
-		else
-			spec_ix = Renderer::GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::SPECULAR), false, &NextBatch);
+		MaterialTextureIndices tex_indices = Renderer::GetMaterialTextureIndices(material, &NextBatch);
+		uint material_index = Renderer::GetMaterialTableIndex(material, tex_indices);
 
 		// -- Setup Vertex Array & Vertex Attributes --
 		constexpr size_t quad_vertex_count = 4;
 		for (size_t i = 0; i < quad_vertex_count; ++i)
 		{
-			QuadVertex& quad_vertex = sprite_component.QuadVertices[i];
-
-			if (pbr)
-			{
-				SetBaseVertexData(s_Data->PBR_QuadVBufferPtr, quad_vertex, transform, material, tex_ix, norm_ix, entity_id);
-
-				s_Data->PBR_QuadVBufferPtr->Roughness = material->Roughness;
-				s_Data->PBR_QuadVBufferPtr->Metallic = material->Metallic;
-				s_Data->PBR_QuadVBufferPtr->AmbientOcc = material->AmbientOcclusion;
-
-				s_Data->PBR_QuadVBufferPtr->RoughTexIndex = (int)rough_ix;
-				s_Data->PBR_QuadVBufferPtr->MetalTexIndex = (int)met_ix;
-				s_Data->PBR_QuadVBufferPtr->AOTexIndex = (int)ao_ix;
-
-				++s_Data->PBR_QuadVBufferPtr;
-			}
-			else
-			{
-				SetBaseVertexData(s_Data->NonPBR_QuadVBufferPtr, quad_vertex, transform, material, tex_ix, norm_ix, entity_id);
-
-				s_Data->NonPBR_QuadVBufferPtr->Shininess = material->Smoothness * 256.0f;
-				s_Data->NonPBR_QuadVBufferPtr->Specularity = material->Specularity;
-				s_Data->NonPBR_QuadVBufferPtr->SpecTexIndex = (int)spec_ix;
-
-				++s_Data->NonPBR_QuadVBufferPtr;
-			}
+			SetBaseVertexData(s_Data->QuadVBufferPtr, sprite_component.QuadVertices[i], transform, material_index, entity_id);
+			++s_Data->QuadVBufferPtr;
 		}
 
 		// -- Update Stats (Quad = 2 Triangles = 6 Indices) --
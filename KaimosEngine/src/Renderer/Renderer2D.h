@@ -9,6 +9,7 @@
 namespace Kaimos {
 
 	class Material;
+	struct BatchVertex;
 
 	struct SpriteRendererComponent;
 	struct QuadVertex
@@ -18,37 +19,12 @@ namespace Kaimos {
 		glm::vec3 Normal	= glm::vec3(0.0f);
 		glm::vec3 Tangent	= glm::vec3(0.0f);
 		glm::vec2 TexCoord	= glm::vec2(0.0f);
-		glm::vec4 Color		= glm::vec4(1.0f);
-		float Bumpiness		= 0.5f;
-
-		int TexIndex		= 0.0f;
-		int NormTexIndex	= 0.0f;
 
+		// Material values aren't stored per vertex, the batched vertices index them in the renderer's materials table
 		// --- Editor Variables ---
 		int EntityID		= 0;
 	};
 
-	struct NonPBRQuadVertex : QuadVertex
-	{
-		float Shininess		= 0.5f;
-		float Specularity	= 0.5f;
-
-		int SpecTexIndex	= 0.0f;
-	};
-
-	struct PBRQuadVertex : QuadVertex
-	{
-		float Roughness		= 0.5f;
-		float Metallic		= 0.5f;
-		float AmbientOcc	= 0.5f;
-
-		int RoughTexIndex	= 0.0f;
-		int MetalTexIndex	= 0.0f;
-		int AOTexIndex		= 0.0f;
-	};
-
-
-
 	//A renderer is a high-level class, a full-on renderer: doesn't deals with commands such as ClearScene, deals with high-level constructs (scenes, meshes...)
 	//RenderCommands should NOT do multiple things, they are just commands (unless specifically supposed-to)
 	class Renderer2D // Won't deal with Storage (will have 0 storage), no static stuff, just render commands
@@ -74,7 +50,7 @@ namespace Kaimos {
 		static void StartBatch();
 		static void NextBatch();
 
-		static void SetBaseVertexData(QuadVertex* dynamic_vertex, const QuadVertex& quad_vertex, const glm::mat4& transform, const Ref<Material>& material, uint albedo_ix, uint norm_ix, uint ent_id);
+		static void SetBaseVertexData(BatchVertex* dynamic_vertex, const QuadVertex& quad_vertex, const glm::mat4& transform, uint material_index, int ent_id);
 
 		// --- Renderer Statistics ---
 		struct Statistics
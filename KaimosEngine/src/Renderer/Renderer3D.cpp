@@ -3,8 +3,10 @@
 
 #include "Foundations/RenderCommand.h"
 #include "Resources/Buffer.h"
+#include "Resources/BatchFormats.h"
 #include "Resources/Mesh.h"
 #include "Resources/Material.h"
+#include "Resources/Shader.h"
 
 #include "Core/Resources/ResourceManager.h"
 #include "Scene/ECS/Components.h"
@@ -15,28 +17,140 @@
 namespace Kaimos {
 
 	// ----------------------- Globals --------------------------------------------------------------------
+	static constexpr uint64_t s_SignatureSeed = 14695981039346656037ull;
+
+	// Flags the batch keys of single components, instanced ones and oversized static ones (the keys of mesh & material pairs and of
+	// material batches don't have it, as mesh & material IDs are positive ints)
+	static constexpr uint64_t s_ComponentBatchKey = 1ull << 63;
+
+	// Folds the bytes of a value into a (FNV-1a) signature
+	template<typename T>
+	static void HashValue(uint64_t& signature, const T& value)
+	{
+		const uint8_t* bytes = (const uint8_t*)&value;
+		for (size_t i = 0; i < sizeof(T); ++i)
+			signature = (signature ^ bytes[i]) * 1099511628211ull;
+	}
+
+	// Mesh vertex as stored in the persistent (per-mesh) buffers of the instanced path, in local space
+	struct InstancedVertex
+	{
+		glm::vec3 Pos		= glm::vec3(0.0f);
+		glm::vec3 Normal	= glm::vec3(0.0f);
+		glm::vec3 Tangent	= glm::vec3(0.0f);
+		glm::vec2 TexCoord	= glm::vec2(0.0f);
+	};
+
+	struct InstanceData
+	{
+		glm::mat4 Transform = glm::mat4(1.0f);
+		int EntityID = 0;
+	};
+
+	// Geometry of a mesh (already modified by its material graph) & the instances to draw with it in the current batch
+	struct InstancedMeshBatch
+	{
+		Ref<VertexArray> VArray				= nullptr;
+		Ref<VertexBuffer> VBuffer			= nullptr;
+		Ref<IndexBuffer> IBuffer			= nullptr;
+		uint MeshID = 0, VerticesCount = 0, IndicesCount = 0;		// Components batches can change their mesh
+		uint VerticesVersion = 0, LastSceneUsed = 0;
+
+		Ref<Material> BatchMaterial			= nullptr;
+		int TexIndex = 0, NormTexIndex = 1, SpecTexIndex = 0;
+		int RoughTexIndex = 0, MetalTexIndex = 0, AOTexIndex = 0;
+
+		uint BaseInstance = 0;
+		std::vector<InstanceData> Instances;
+	};
+
+	// Static mesh submitted in the current batch, its vertices are only written if its static batch has to be rebuilt
+	struct StaticMeshDraw
+	{
+		const std::vector<Vertex>* Vertices	= nullptr;
+		Ref<Mesh> DrawnMesh					= nullptr;
+		glm::mat4 Transform = glm::mat4(1.0f);
+		int EntityID = 0;
+	};
+
+	// Static meshes of a material submitted in the current batch & the signature of what they'd draw
+	struct StaticMaterialDraws
+	{
+		Ref<Material> DrawMaterial			= nullptr;
+		uint MaterialIndex = 0;				// In the renderer's materials table
+		std::vector<StaticMeshDraw> Draws;
+
+		uint64_t Signature = s_SignatureSeed;
+		uint VerticesCount = 0, IndicesCount = 0;
+		uint BatchesInScene = 0;
+	};
+
+	// Geometry of the static meshes of a material (in world space), drawn as it is while their signature doesn't change
+	struct StaticMeshBatch
+	{
+		Ref<VertexArray> VArray				= nullptr;
+		Ref<VertexBuffer> VBuffer			= nullptr;
+		Ref<IndexBuffer> IBuffer			= nullptr;
+		uint VerticesCapacity = 0, IndicesCapacity = 0;
+		uint IndicesCount = 0;
+
+		uint64_t Signature = 0;
+		uint LastSceneUsed = 0;
+	};
+
+	// Material uniforms of the instanced shaders, resolved once each time the scene shader changes
+	struct MaterialUniforms
+	{
+		const Shader* Owner = nullptr;
+		UniformHandle Color, NormalStrength, TexIndex, NormTexIndex;
+		UniformHandle Roughness, Metallic, AmbientOcclusion, RoughTexIndex, MetalTexIndex, AOTexIndex;	// PBR
+		UniformHandle Shininess, SpecularStrength, SpecTexIndex;										// Non-PBR
+	};
+
 	struct Renderer3DData
 	{
 		Renderer3D::Statistics RendererStats;
 
 		static const uint MaxFaces = 20000;
 		static const uint MaxIndices = MaxFaces * 6;
+		static const uint MaxVertices = MaxFaces * 4;
+		static const uint StreamedBatches = 3;		// Batches fitting in the vertex & index rings, so the GPU can draw some while others are written
 
-		uint IndicesDrawCount = 0;
+		// Batch vertices & indices are written straight into the (mapped) rings of the buffers in use
+		uint IndicesDrawCount = 0, VerticesDrawCount = 0;
 		uint IndicesCurrentOffset = 0;
-		std::vector<uint> Indices;
+		uint* IndicesPtr					= nullptr;
 		Ref<IndexBuffer> IBuffer			= nullptr;
 
-		NonPBRVertex* NonPBR_VBufferBase	= nullptr;
-		NonPBRVertex* NonPBR_VBufferPtr		= nullptr;
-
-		PBRVertex* PBR_VBufferBase			= nullptr;
-		PBRVertex* PBR_VBufferPtr			= nullptr;
+		// (both pipelines share the vertex format, the material values of each come from the materials table)
+		BatchVertex* VBufferBase			= nullptr;
+		BatchVertex* VBufferPtr				= nullptr;
 
 		Ref<VertexBuffer> VBuffer			= nullptr;
 		Ref<VertexArray> VArray				= nullptr;
-		Ref<VertexBuffer> PBRVBuffer		= nullptr;
-		Ref<VertexArray> PBRVArray			= nullptr;
+
+		// Retained Static Batches
+		bool RetainStaticBatches = false;
+		uint StaticDrawsCount = 0;
+		std::unordered_map<uint, StaticMaterialDraws> StaticDraws;		// Material ID & its static meshes in the current batch
+
+		// Meshes bigger than a whole batch, each one drawn from a static batch of its own (keyed by its entity)
+		std::vector<StaticMaterialDraws> OversizedDraws;
+		std::unordered_set<uint> OversizedMeshesWarned;
+		uint CurrentView = 0;		// Camera the scene is rendered from, each one retains its own batches (the editor view & a camera preview)
+		std::unordered_map<uint, std::unordered_map<uint64_t, StaticMeshBatch>> StaticBatches;	// View & (Material ID, Batch of the material in the scene) & batch
+
+		// Instanced Rendering
+		bool InstancedRendering = false;
+		static const uint MaxInstances = 10000;
+		static const uint MaxUnusedScenes = 600;	// Scenes a mesh batch can go without instances before its buffers are freed
+
+		uint InstancesDrawCount = 0;
+		uint ScenesCount = 0;
+		InstanceData* InstanceVBufferBase	= nullptr;
+		Ref<VertexBuffer> InstanceVBuffer	= nullptr;
+		std::unordered_map<uint64_t, InstancedMeshBatch> InstancedBatches; // (Mesh ID, Material ID) or (s_ComponentBatchKey, Entity ID) & batch
+		MaterialUniforms InstancedMaterialUniforms;
 	};
 
 	static Renderer3DData* s_3DData = nullptr;	// On shutdown, this is deleted, and ~VertexArray() called, freeing GPU Memory too
@@ -49,6 +163,12 @@ namespace Kaimos {
 		memset(&s_3DData->RendererStats, 0, sizeof(Statistics));
 	}
 
+	void Renderer3D::AddCullingStats(uint submitted_meshes, uint culled_meshes)
+	{
+		s_3DData->RendererStats.SubmittedMeshes += submitted_meshes;
+		s_3DData->RendererStats.CulledMeshes += culled_meshes;
+	}
+
 	const Renderer3D::Statistics Renderer3D::GetStats()
 	{
 		return s_3DData->RendererStats;
@@ -59,6 +179,20 @@ namespace Kaimos {
 		return s_3DData->MaxFaces;
 	}
 
+	const uint Renderer3D::GetMaxInstances()
+	{
+		return s_3DData->MaxInstances;
+	}
+
+	const uint Renderer3D::GetRetainedStaticBatchesCount()
+	{
+		uint count = 0;
+		for (const auto& [view_id, view_batches] : s_3DData->StaticBatches)
+			count += (uint)view_batches.size();
+
+		return count;
+	}
+
 
 
 	// ----------------------- Public Class Methods -------------------------------------------------------
@@ -69,70 +203,34 @@ namespace Kaimos {
 		s_3DData = new Renderer3DData();
 
 		// -- Vertex, Index Buffers & Array --
-		const uint max_vertices = s_3DData->MaxFaces * 4;
+		const uint max_vertices = s_3DData->MaxVertices;
+		const uint streamed_batches = s_3DData->StreamedBatches;
 
-		s_3DData->NonPBR_VBufferBase = new NonPBRVertex[max_vertices];
 		s_3DData->VArray = VertexArray::Create();
-		s_3DData->VBuffer = VertexBuffer::Create(max_vertices * sizeof(NonPBRVertex));
-
-		s_3DData->PBR_VBufferBase = new PBRVertex[max_vertices];
-		s_3DData->PBRVArray = VertexArray::Create();
-		s_3DData->PBRVBuffer = VertexBuffer::Create(max_vertices * sizeof(PBRVertex));
-
-		s_3DData->IBuffer = IndexBuffer::Create(s_3DData->MaxIndices);
-
-		// -- Vertex Layout & Index Buffer Creation --
-		BufferLayout non_pbr_layout = {
-			{ SHADER_DATATYPE::FLOAT3,	"a_Position" },
-			{ SHADER_DATATYPE::FLOAT3,	"a_Normal" },
-			{ SHADER_DATATYPE::FLOAT3,	"a_Tangent" },
-			{ SHADER_DATATYPE::FLOAT2,	"a_TexCoord" },
-			{ SHADER_DATATYPE::FLOAT4,	"a_Color" },
-			{ SHADER_DATATYPE::FLOAT ,	"a_NormalStrength" },
-			{ SHADER_DATATYPE::INT,		"a_TexIndex" },
-			{ SHADER_DATATYPE::INT,		"a_NormTexIndex" },
-			{ SHADER_DATATYPE::INT,		"a_EntityID" },
-
-			{ SHADER_DATATYPE::FLOAT,	"a_Shininess" },
-			{ SHADER_DATATYPE::FLOAT,	"a_SpecularStrength" },
-			{ SHADER_DATATYPE::INT,		"a_SpecTexIndex" }
-		};
-
-		BufferLayout pbr_layout = {
-			{ SHADER_DATATYPE::FLOAT3,	"a_Position" },
-			{ SHADER_DATATYPE::FLOAT3,	"a_Normal" },
-			{ SHADER_DATATYPE::FLOAT3,	"a_Tangent" },
-			{ SHADER_DATATYPE::FLOAT2,	"a_TexCoord" },
-			{ SHADER_DATATYPE::FLOAT4,	"a_Color" },
-			{ SHADER_DATATYPE::FLOAT ,	"a_NormalStrength" },
-			{ SHADER_DATATYPE::INT,		"a_TexIndex" },
-			{ SHADER_DATATYPE::INT,		"a_NormTexIndex" },
-			{ SHADER_DATATYPE::INT,		"a_EntityID" },
-
-			{ SHADER_DATATYPE::FLOAT,	"a_Roughness" },
-			{ SHADER_DATATYPE::FLOAT,	"a_Metallic" },
-			{ SHADER_DATATYPE::FLOAT,	"a_AmbientOcclusionValue" },
-			{ SHADER_DATATYPE::INT,		"a_RoughTexIndex" },
-			{ SHADER_DATATYPE::INT,		"a_MetalTexIndex" },
-			{ SHADER_DATATYPE::INT,		"a_AOTexIndex" }
-		};
+		s_3DData->VBuffer = VertexBuffer::CreateStreaming(streamed_batches * max_vertices * sizeof(BatchVertex));
+		s_3DData->IBuffer = IndexBuffer::CreateStreaming(streamed_batches * s_3DData->MaxIndices);
+
+		// -- Vertex Layout --
+		s_3DData->VBuffer->SetLayout(BatchVertex::GetLayout());
 
 		// -- Vertex Array Filling --
-		s_3DData->VBuffer->SetLayout(non_pbr_layout);
 		s_3DData->VArray->AddVertexBuffer(s_3DData->VBuffer);
 		s_3DData->VArray->SetIndexBuffer(s_3DData->IBuffer);
 
+		// -- Arrays Unbinding --
 		s_3DData->VArray->Unbind();
 		s_3DData->VBuffer->Unbind();
+		s_3DData->IBuffer->Unbind();
 
-		s_3DData->PBRVBuffer->SetLayout(pbr_layout);
-		s_3DData->PBRVArray->AddVertexBuffer(s_3DData->PBRVBuffer);
-		s_3DData->PBRVArray->SetIndexBuffer(s_3DData->IBuffer);
+		// -- Instances Buffer (attached to each mesh batch vertex array) --
+		s_3DData->InstanceVBufferBase = new InstanceData[s_3DData->MaxInstances];
+		s_3DData->InstanceVBuffer = VertexBuffer::Create(s_3DData->MaxInstances * sizeof(InstanceData));
+		s_3DData->InstanceVBuffer->SetLayout({
+			{ SHADER_DATATYPE::MAT4,	"a_Transform" },
+			{ SHADER_DATATYPE::INT,		"a_EntityID", false, true }
+		});
 
-		// -- Arrays Unbinding & Indices Deletion --
-		s_3DData->PBRVArray->Unbind();
-		s_3DData->PBRVBuffer->Unbind();
-		s_3DData->IBuffer->Unbind();
+		s_3DData->InstanceVBuffer->Unbind();
 	}
 
 	void Renderer3D::Shutdown()
@@ -141,18 +239,24 @@ namespace Kaimos {
 
 		// This is deleted here (manually), and not treated as smart pointer, waiting for the end of the program lifetime
 		// because there is still some code of the graphics (OpenGL) that it has to run to free VRAM (for ex. deleting VArrays, Shaders...)
-		delete[] s_3DData->NonPBR_VBufferBase;
-		delete[] s_3DData->PBR_VBufferBase;
+		delete[] s_3DData->InstanceVBufferBase;
 		delete s_3DData;
 	}
 
 
 
 	// ----------------------- Public Renderer Methods ----------------------------------------------------
-	void Renderer3D::BeginScene()
+	void Renderer3D::BeginScene(uint view_id)
 	{
 		KS_PROFILE_FUNCTION();
-		Renderer::IsSceneInPBRPipeline() ? s_3DData->PBRVArray->Bind() : s_3DData->VArray->Bind();
+		++s_3DData->ScenesCount;
+		s_3DData->CurrentView = view_id;
+		if (!s_3DData->InstancedRendering)
+			s_3DData->VArray->Bind();
+
+		for (auto& [material_id, draws] : s_3DData->StaticDraws)
+			draws.BatchesInScene = 0;
+
 		StartBatch();
 	}
 
@@ -160,6 +264,44 @@ namespace Kaimos {
 	{
 		KS_PROFILE_FUNCTION();
 		Flush();
+		RemoveUnusedBatches();
+	}
+
+
+
+	// ----------------------- Public Renderer Settings ---------------------------------------------------
+	bool Renderer3D::IsInstancedRendering()
+	{
+		return s_3DData->InstancedRendering;
+	}
+
+	void Renderer3D::SetInstancedRendering(bool instanced_rendering)
+	{
+		if (s_3DData->InstancedRendering == instanced_rendering)
+			return;
+
+		// Mesh batches are only kept while in use, no need to keep the GPU geometry in the batched path
+		s_3DData->InstancedRendering = instanced_rendering;
+		if (!instanced_rendering)
+			s_3DData->InstancedBatches.clear();
+	}
+
+	bool Renderer3D::IsRetainingStaticBatches()
+	{
+		return s_3DData->RetainStaticBatches;
+	}
+
+	void Renderer3D::SetRetainStaticBatches(bool retain_static_batches)
+	{
+		s_3DData->RetainStaticBatches = retain_static_batches;
+		if (!retain_static_batches)
+			s_3DData->StaticBatches.clear();
+	}
+
+	bool Renderer3D::IsRetainedStaticDraw(const MeshRendererComponent& mesh_component, uint transform_version)
+	{
+		bool timed_vertices = mesh_component.PositionTimed || mesh_component.NormalsTimed || mesh_component.TexCoordsTimed;
+		return !s_3DData->InstancedRendering && s_3DData->RetainStaticBatches && !timed_vertices && transform_version != 0;
 	}
 
 
@@ -168,47 +310,187 @@ namespace Kaimos {
 	void Renderer3D::Flush()
 	{
 		KS_PROFILE_FUNCTION();
+		if (s_3DData->InstancedRendering)
+		{
+			FlushInstances();
+			return;
+		}
 
 		// -- Check if something to draw --
-		if (s_3DData->IndicesDrawCount == 0)
+		if (s_3DData->IndicesDrawCount == 0 && s_3DData->StaticDrawsCount == 0)
 			return;
 
-		// -- Set Index Buffer Data --
-		s_3DData->IBuffer->SetData(s_3DData->Indices.data(), s_3DData->Indices.size());
+		// -- Bind Textures & Materials & Draw the Static Batches (with the texture slots & materials they were submitted with) --
+		Renderer::BindTextures();
+		Renderer::UploadMaterialsTable();
+		if (s_3DData->StaticDrawsCount > 0)
+			FlushStaticBatches();
+
+		if (s_3DData->IndicesDrawCount == 0)
+			return;
 
-		// -- Set Vertex Buffer Data --
+		// -- Commit Written Indices & Vertices --
 		// Data cast: uint8_t = 1 byte large, subtraction give elements in terms of bytes
-		Ref<VertexArray> v_array = nullptr;
-		if (Renderer::IsSceneInPBRPipeline())
+		uint first_index = s_3DData->IBuffer->Commit(s_3DData->IndicesDrawCount);
+		uint v_data_size = (uint)((uint8_t*)s_3DData->VBufferPtr - (uint8_t*)s_3DData->VBufferBase);
+		uint base_vertex = s_3DData->VBuffer->Commit(v_data_size) / sizeof(BatchVertex);
+
+		// -- Draw Vertex Array --
+		// Batch indices are relative to the batch, base vertex offsets them to the batch vertices in the ring
+		s_3DData->VArray->Bind();
+		RenderCommand::DrawIndexedBaseVertex(s_3DData->VArray, s_3DData->IndicesDrawCount, first_index, base_vertex);
+		s_3DData->VBuffer->Retire();
+		s_3DData->IBuffer->Retire();
+		++s_3DData->RendererStats.DrawCalls;
+	}
+
+	void Renderer3D::FlushInstances()
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- Check if something to draw --
+		Ref<Shader> shader = Renderer::GetSceneShader();
+		if (s_3DData->InstancesDrawCount == 0 || !shader)
+			return;
+
+		// -- Set Instance Buffer Data (each batch gets a contiguous range of instances) --
+		uint instances_count = 0;
+		for (auto& [key, batch] : s_3DData->InstancedBatches)
 		{
-			uint v_data_size = (uint)((uint8_t*)s_3DData->PBR_VBufferPtr - (uint8_t*)s_3DData->PBR_VBufferBase);
-			s_3DData->PBRVBuffer->SetData(s_3DData->PBR_VBufferBase, v_data_size);
-			v_array = s_3DData->PBRVArray;
+			if (batch.Instances.empty())
+				continue;
+
+			batch.BaseInstance = instances_count;
+			memcpy(s_3DData->InstanceVBufferBase + instances_count, batch.Instances.data(), batch.Instances.size() * sizeof(InstanceData));
+			instances_count += batch.Instances.size();
 		}
-		else
+
+		s_3DData->InstanceVBuffer->SetData(s_3DData->InstanceVBufferBase, instances_count * sizeof(InstanceData));
+
+		// -- Resolve Material Uniforms --
+		MaterialUniforms& uniforms = s_3DData->InstancedMaterialUniforms;
+		if (uniforms.Owner != shader.get())
 		{
-			uint v_data_size = (uint)((uint8_t*)s_3DData->NonPBR_VBufferPtr - (uint8_t*)s_3DData->NonPBR_VBufferBase);
-			s_3DData->VBuffer->SetData(s_3DData->NonPBR_VBufferBase, v_data_size);
-			v_array = s_3DData->VArray;
+			uniforms.Owner = shader.get();
+			uniforms.Color = shader->GetUniformHandle("u_Material.Color");
+			uniforms.NormalStrength = shader->GetUniformHandle("u_Material.NormalStrength");
+			uniforms.TexIndex = shader->GetUniformHandle("u_Material.TexIndex");
+			uniforms.NormTexIndex = shader->GetUniformHandle("u_Material.NormTexIndex");
+			uniforms.Roughness = shader->GetUniformHandle("u_Material.Roughness");
+			uniforms.Metallic = shader->GetUniformHandle("u_Material.Metallic");
+			uniforms.AmbientOcclusion = shader->GetUniformHandle("u_Material.AmbientOcclusion");
+			uniforms.RoughTexIndex = shader->GetUniformHandle("u_Material.RoughTexIndex");
+			uniforms.MetalTexIndex = shader->GetUniformHandle("u_Material.MetalTexIndex");
+			uniforms.AOTexIndex = shader->GetUniformHandle("u_Material.AOTexIndex");
+			uniforms.Shininess = shader->GetUniformHandle("u_Material.Shininess");
+			uniforms.SpecularStrength = shader->GetUniformHandle("u_Material.SpecularStrength");
+			uniforms.SpecTexIndex = shader->GetUniformHandle("u_Material.SpecTexIndex");
 		}
 
-		// -- Bind Textures & Draw Vertex Array --
+		// -- Bind Textures & Draw a Mesh Batch per Draw Call --
 		Renderer::BindTextures();
-		RenderCommand::DrawIndexed(v_array, s_3DData->IndicesDrawCount);
+		bool pbr = Renderer::IsSceneInPBRPipeline();
+
+		for (auto& [key, batch] : s_3DData->InstancedBatches)
+		{
+			if (batch.Instances.empty())
+				continue;
+
+			// Material Uniforms
+			const Ref<Material>& material = batch.BatchMaterial;
+			shader->SetUniformFloat4(uniforms.Color, material->Color);
+			shader->SetUniformFloat(uniforms.NormalStrength, material->Bumpiness);
+			shader->SetUniformInt(uniforms.TexIndex, batch.TexIndex);
+			shader->SetUniformInt(uniforms.NormTexIndex, batch.NormTexIndex);
+
+			if (pbr)
+			{
+				shader->SetUniformFloat(uniforms.Roughness, material->Roughness);
+				shader->SetUniformFloat(uniforms.Metallic, material->Metallic);
+				shader->SetUniformFloat(uniforms.AmbientOcclusion, material->AmbientOcclusion);
+				shader->SetUniformInt(uniforms.RoughTexIndex, batch.RoughTexIndex);
+				shader->SetUniformInt(uniforms.MetalTexIndex, batch.MetalTexIndex);
+				shader->SetUniformInt(uniforms.AOTexIndex, batch.AOTexIndex);
+			}
+			else
+			{
+				shader->SetUniformFloat(uniforms.Shininess, material->Smoothness * 256.0f);
+				shader->SetUniformFloat(uniforms.SpecularStrength, material->Specularity);
+				shader->SetUniformInt(uniforms.SpecTexIndex, batch.SpecTexIndex);
+			}
+
+			// Draw
+			batch.VArray->Bind();
+			RenderCommand::DrawIndexedInstanced(batch.VArray, batch.IndicesCount, batch.Instances.size(), batch.BaseInstance);
+			++s_3DData->RendererStats.DrawCalls;
+
+			batch.Instances.clear();
+		}
+
+		s_3DData->InstancesDrawCount = 0;
+	}
+
+	void Renderer3D::FlushStaticBatches()
+	{
+		KS_PROFILE_FUNCTION();
+		for (auto& [material_id, draws] : s_3DData->StaticDraws)
+		{
+			if (draws.Draws.empty())
+				continue;
+
+			uint64_t batch_key = ((uint64_t)material_id << 32) | (uint64_t)draws.BatchesInScene++;
+			DrawStaticBatch(batch_key, draws);
+
+			// -- Reset Material Draws --
+			draws.Draws.clear();
+			draws.DrawMaterial = nullptr;
+			draws.Signature = s_SignatureSeed;
+			draws.VerticesCount = draws.IndicesCount = 0;
+		}
+
+		for (StaticMaterialDraws& draws : s_3DData->OversizedDraws)
+			DrawStaticBatch(s_ComponentBatchKey | (uint64_t)(uint)draws.Draws.front().EntityID, draws);
+
+		s_3DData->OversizedDraws.clear();
+		s_3DData->StaticDrawsCount = 0;
+	}
+
+	void Renderer3D::DrawStaticBatch(uint64_t batch_key, const StaticMaterialDraws& draws)
+	{
+		// -- Rebuild the Batch only if its Signature (the meshes & transforms submitted) changed --
+		// Material values & texture slots are read from the materials table, so editing them doesn't rebuild it
+		StaticMeshBatch& batch = s_3DData->StaticBatches[s_3DData->CurrentView][batch_key];
+		if (!batch.VArray || batch.Signature != draws.Signature)
+		{
+			SetStaticBatchGeometry(batch, draws);
+			batch.Signature = draws.Signature;
+			++s_3DData->RendererStats.StaticBatchesRebuilt;
+		}
+
+		// -- Draw --
+		batch.LastSceneUsed = s_3DData->ScenesCount;
+		batch.VArray->Bind();
+		RenderCommand::DrawIndexed(batch.VArray, batch.IndicesCount);
+		++s_3DData->RendererStats.StaticBatchesDrawn;
 		++s_3DData->RendererStats.DrawCalls;
 	}
 
 	void Renderer3D::StartBatch()
 	{
 		KS_PROFILE_FUNCTION();
-		s_3DData->IndicesDrawCount = 0;
+		s_3DData->InstancesDrawCount = 0;
+		s_3DData->IndicesDrawCount = s_3DData->VerticesDrawCount = 0;
 		s_3DData->IndicesCurrentOffset = 0;
-		s_3DData->Indices.clear();
-		
-		if(Renderer::IsSceneInPBRPipeline())
-			s_3DData->PBR_VBufferPtr = s_3DData->PBR_VBufferBase;
-		else
-			s_3DData->NonPBR_VBufferPtr = s_3DData->NonPBR_VBufferBase;
+
+		if (s_3DData->InstancedRendering)
+			return;
+
+		// -- Reserve a whole Batch in the Vertex & Index Rings (waits if the GPU is still drawing it) --
+		const uint max_vertices = s_3DData->MaxVertices;
+		s_3DData->IndicesPtr = s_3DData->IBuffer->Reserve(s_3DData->MaxIndices);
+
+		void* batch_memory = s_3DData->VBuffer->Reserve(max_vertices * sizeof(BatchVertex), sizeof(BatchVertex));
+		s_3DData->VBufferBase = s_3DData->VBufferPtr = (BatchVertex*)batch_memory;
 	}
 
 	void Renderer3D::NextBatch()
@@ -218,103 +500,266 @@ namespace Kaimos {
 		StartBatch();
 	}
 
-	void Renderer3D::SetBaseVertexData(Vertex* dynamic_vertex, const Vertex& mesh_vertex, const glm::mat4& transform, const Ref<Material>& material, uint albedo_ix, uint norm_ix, uint ent_id)
-	{
-		dynamic_vertex->Pos = transform * glm::vec4(mesh_vertex.Pos, 1.0f);
-		dynamic_vertex->Normal = glm::normalize(glm::vec3(transform * glm::vec4(mesh_vertex.Normal, 0.0f)));
-		dynamic_vertex->Tangent = glm::normalize(glm::vec3(transform * glm::vec4(mesh_vertex.Tangent, 0.0f)));
-		dynamic_vertex->TexCoord = mesh_vertex.TexCoord;
-		
-		dynamic_vertex->Color = material->Color;
-		dynamic_vertex->Bumpiness = material->Bumpiness;
-		
-		dynamic_vertex->TexIndex = (int)albedo_ix;
-		dynamic_vertex->NormTexIndex = (int)(norm_ix);
-		dynamic_vertex->EntityID = (int)ent_id;
+	void Renderer3D::SetMeshVertices(BatchVertex* vertices, const std::vector<Vertex>& mesh_vertices, const glm::mat4& transform, uint material_index, int ent_id)
+	{
+		for (uint i = 0; i < mesh_vertices.size(); ++i)
+		{
+			const Vertex& mesh_vertex = mesh_vertices[i];
+			BatchVertex& vertex = vertices[i];
+
+			vertex.Pos = transform * glm::vec4(mesh_vertex.Pos, 1.0f);
+			vertex.Normal = PackOctahedral(glm::normalize(glm::vec3(transform * glm::vec4(mesh_vertex.Normal, 0.0f))));
+			vertex.Tangent = PackOctahedral(glm::normalize(glm::vec3(transform * glm::vec4(mesh_vertex.Tangent, 0.0f))));
+			vertex.TexCoord = PackHalf2(mesh_vertex.TexCoord);
+			vertex.MaterialIndex = material_index;
+			vertex.EntityID = ent_id;
+		}
+	}
+
+	void Renderer3D::SetInstancedBatchGeometry(InstancedMeshBatch& batch, const Ref<Mesh>& mesh, const MeshRendererComponent& mesh_component)
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- Create Batch Buffers if needed (or if the mesh changed) --
+		uint vertices_count = mesh_component.GetModifiedVertices().size();
+		if (!batch.VArray || batch.MeshID != mesh->GetID() || batch.VerticesCount != vertices_count || batch.IndicesCount != mesh->m_Indices.size())
+		{
+			batch.MeshID = mesh->GetID();
+			batch.VerticesCount = vertices_count;
+			batch.IndicesCount = mesh->m_Indices.size();
+
+			batch.VArray = VertexArray::Create();
+			batch.VBuffer = VertexBuffer::Create(vertices_count * sizeof(InstancedVertex));
+			batch.VBuffer->SetLayout({
+				{ SHADER_DATATYPE::FLOAT3,	"a_Position" },
+				{ SHADER_DATATYPE::FLOAT3,	"a_Normal" },
+				{ SHADER_DATATYPE::FLOAT3,	"a_Tangent" },
+				{ SHADER_DATATYPE::FLOAT2,	"a_TexCoord" }
+			});
+
+			batch.IBuffer = IndexBuffer::Create(mesh->m_Indices.data(), batch.IndicesCount);
+
+			batch.VArray->AddVertexBuffer(batch.VBuffer);
+			batch.VArray->AddVertexBuffer(s_3DData->InstanceVBuffer);
+			batch.VArray->SetIndexBuffer(batch.IBuffer);
+			batch.VArray->Unbind();
+		}
+
+		// -- Upload Mesh Vertices (in local space) --
+		std::vector<InstancedVertex> vertices(vertices_count);
+		for (uint i = 0; i < vertices_count; ++i)
+		{
+			const Vertex& mesh_vertex = mesh_component.GetModifiedVertices()[i];
+			vertices[i].Pos = mesh_vertex.Pos;
+			vertices[i].Normal = mesh_vertex.Normal;
+			vertices[i].Tangent = mesh_vertex.Tangent;
+			vertices[i].TexCoord = mesh_vertex.TexCoord;
+		}
+
+		batch.VBuffer->SetData(vertices.data(), vertices_count * sizeof(InstancedVertex));
+		batch.VerticesVersion = mesh_component.VerticesVersion;
+	}
+
+	void Renderer3D::SetStaticBatchGeometry(StaticMeshBatch& batch, const StaticMaterialDraws& draws)
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- Create Batch Buffers if needed (or if they are too small) --
+		if (!batch.VArray || batch.VerticesCapacity < draws.VerticesCount || batch.IndicesCapacity < draws.IndicesCount)
+		{
+			batch.VerticesCapacity = draws.VerticesCount;
+			batch.IndicesCapacity = draws.IndicesCount;
+
+			batch.VArray = VertexArray::Create();
+			batch.VBuffer = VertexBuffer::Create(batch.VerticesCapacity * sizeof(BatchVertex));
+			batch.VBuffer->SetLayout(BatchVertex::GetLayout());
+			batch.IBuffer = IndexBuffer::Create(batch.IndicesCapacity);
+
+			batch.VArray->AddVertexBuffer(batch.VBuffer);
+			batch.VArray->SetIndexBuffer(batch.IBuffer);
+			batch.VArray->Unbind();
+		}
+
+		// -- Set Meshes Vertices (in world space) & Indices --
+		std::vector<BatchVertex> vertices(draws.VerticesCount);
+		std::vector<uint> indices;
+		indices.reserve(draws.IndicesCount);
+
+		uint vertices_offset = 0, indices_offset = 0;
+		for (const StaticMeshDraw& draw : draws.Draws)
+		{
+			SetMeshVertices(vertices.data() + vertices_offset, *draw.Vertices, draw.Transform, draws.MaterialIndex, draw.EntityID);
+			vertices_offset += draw.Vertices->size();
+
+			for (uint index : draw.DrawnMesh->m_Indices)
+				indices.push_back(indices_offset + index);
+
+			indices_offset += draw.DrawnMesh->m_MaxIndex;
+		}
+
+		// -- Upload --
+		batch.VBuffer->SetData(vertices.data(), vertices.size() * sizeof(BatchVertex));
+		batch.IBuffer->SetData(indices.data(), indices.size());
+		batch.IndicesCount = indices.size();
+	}
+
+	void Renderer3D::RemoveUnusedBatches()
+	{
+		auto& instanced_batches = s_3DData->InstancedBatches;
+		for (auto it = instanced_batches.begin(); it != instanced_batches.end();)
+		{
+			if (s_3DData->ScenesCount - it->second.LastSceneUsed > s_3DData->MaxUnusedScenes)
+				it = instanced_batches.erase(it);
+			else
+				++it;
+		}
+
+		auto& views_batches = s_3DData->StaticBatches;
+		for (auto view_it = views_batches.begin(); view_it != views_batches.end();)
+		{
+			auto& static_batches = view_it->second;
+			for (auto it = static_batches.begin(); it != static_batches.end();)
+			{
+				if (s_3DData->ScenesCount - it->second.LastSceneUsed > s_3DData->MaxUnusedScenes)
+					it = static_batches.erase(it);
+				else
+					++it;
+			}
+
+			if (static_batches.empty())
+				view_it = views_batches.erase(view_it);
+			else
+				++view_it;
+		}
 	}
 
 
 	// ----------------------- Public Drawing Methods -----------------------------------------------------
-	void Renderer3D::DrawMesh(Timestep dt, const glm::mat4& transform, MeshRendererComponent& mesh_component, int entity_id)
+	void Renderer3D::DrawMesh(Timestep dt, const glm::mat4& transform, MeshRendererComponent& mesh_component, int entity_id, uint transform_version)
 	{
 		// -- New Batch if Needed --
-		if (s_3DData->IndicesDrawCount >= s_3DData->MaxIndices)
+		if (s_3DData->IndicesDrawCount >= s_3DData->MaxIndices || s_3DData->InstancesDrawCount >= s_3DData->MaxInstances)
 			NextBatch();
 
 		// -- Get Mesh --
 		Ref<Mesh> mesh = Resources::ResourceManager::GetMesh(mesh_component.MeshID);
-		if (mesh && mesh->GetVertices().size() == mesh_component.ModifiedVertices.size())
+		if (mesh && mesh->GetVertices().size() == mesh_component.GetModifiedVertices().size())
 		{
 			// -- Get Material & Check it fits in Batch --
 			Ref<Material> material = Renderer::GetMaterial(mesh_component.MaterialID);
 			if (!material)
 				KS_FATAL_ERROR("Tried to Render a Mesh with a null Material!");
 
-			// -- Update Mesh Timed Vertices --
-			static float accumulated_dt = 0.0f;
-			accumulated_dt += dt.GetMilliseconds();
-			if (accumulated_dt > 30.0f)
-			{
-				mesh_component.UpdateTimedVertices();
-				accumulated_dt = 0.0f;
-			}
-
 			// -- Get Texture indexes --
 			bool pbr = Renderer::IsSceneInPBRPipeline();
-			Renderer::CheckMaterialFitsInBatch(material, &NextBatch);
-
-			uint tex_ix, norm_ix, spec_ix, rough_ix, met_ix, ao_ix;
-			tex_ix = Renderer::GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::ALBEDO), false, &NextBatch);
-			norm_ix = Renderer::GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::NORMAL), true, &NextBatch);
+			MaterialTextureIndices tex_indices = Renderer::GetMaterialTextureIndices(material, &NextBatch);
 
-			if (pbr)
+			// -- Instanced Rendering: Append an Instance to the (Mesh, Material) Batch --
+			// Components with vertices of their own (timed ones, evaluated on their own clocks, or drawing randoms) can't share
+			// the geometry of the pair, so they get a batch of their own
+			if (s_3DData->InstancedRendering)
 			{
-				rough_ix = Renderer::GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::ROUGHNESS), false, &NextBatch);
-				met_ix = Renderer::GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::METALLIC), false, &NextBatch);
-				ao_ix = Renderer::GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::AMBIENT_OC), false, &NextBatch);
-			}
-			else
-				spec_ix = Renderer::GetTextureIndex(material->GetTexture(MATERIAL_TEXTURES::SPECULAR), false, &NextBatch);
+				bool timed_vertices = mesh_component.PositionTimed || mesh_component.NormalsTimed || mesh_component.TexCoordsTimed;
+				bool own_vertices = timed_vertices || material->GetVertexAttributesProgram().HasRandoms();
 
-			// -- Setup Vertex Array & Vertex Attributes --
-			for (uint i = 0; i < mesh->m_Vertices.size(); ++i)
-			{
-				// Set the vertex data
-				Vertex& mesh_vertex = mesh_component.ModifiedVertices[i];
-				if (pbr)
-				{
-					SetBaseVertexData(s_3DData->PBR_VBufferPtr, mesh_vertex, transform, material, tex_ix, norm_ix, entity_id);
+				uint64_t batch_key = ((uint64_t)mesh->GetID() << 32) | (uint64_t)material->GetID();
+				if (own_vertices)
+					batch_key = s_ComponentBatchKey | (uint64_t)(uint)entity_id;
 
-					s_3DData->PBR_VBufferPtr->Roughness = material->Roughness;
-					s_3DData->PBR_VBufferPtr->Metallic = material->Metallic;
-					s_3DData->PBR_VBufferPtr->AmbientOcc = material->AmbientOcclusion;
+				InstancedMeshBatch& batch = s_3DData->InstancedBatches[batch_key];
 
-					s_3DData->PBR_VBufferPtr->RoughTexIndex = (int)rough_ix;
-					s_3DData->PBR_VBufferPtr->MetalTexIndex = (int)met_ix;
-					s_3DData->PBR_VBufferPtr->AOTexIndex = (int)ao_ix;
+				// Re-upload the geometry only if there are newer modified vertices than the uploaded ones
+				if (!batch.VArray || mesh_component.VerticesVersion > batch.VerticesVersion)
+					SetInstancedBatchGeometry(batch, mesh, mesh_component);
 
-					++s_3DData->PBR_VBufferPtr;
+				// Texture indexes are the ones of the current batch, so they are overwritten on each draw
+				batch.BatchMaterial = material;
+				batch.TexIndex = (int)tex_indices.Albedo;
+				batch.NormTexIndex = (int)tex_indices.Normal;
+				if (pbr)
+				{
+					batch.RoughTexIndex = (int)tex_indices.Roughness;
+					batch.MetalTexIndex = (int)tex_indices.Metallic;
+					batch.AOTexIndex = (int)tex_indices.AmbientOcc;
 				}
 				else
-				{
-					SetBaseVertexData(s_3DData->NonPBR_VBufferPtr, mesh_vertex, transform, material, tex_ix, norm_ix, entity_id);
+					batch.SpecTexIndex = (int)tex_indices.Specular;
 
-					s_3DData->NonPBR_VBufferPtr->Shininess = material->Smoothness * 256.0f;
-					s_3DData->NonPBR_VBufferPtr->Specularity = material->Specularity;
-					s_3DData->NonPBR_VBufferPtr->SpecTexIndex = (int)spec_ix;
+				batch.LastSceneUsed = s_3DData->ScenesCount;
+				batch.Instances.push_back({ transform, entity_id });
+				++s_3DData->InstancesDrawCount;
 
-					++s_3DData->NonPBR_VBufferPtr;
-				}
+				// Update Stats
+				++s_3DData->RendererStats.InstancesCount;
+				s_3DData->RendererStats.IndicesCount += batch.IndicesCount;
+				s_3DData->RendererStats.VerticesCount += batch.VerticesCount;
+				return;
+			}
+
+			uint material_index = Renderer::GetMaterialTableIndex(material, tex_indices);
+			uint vertices_count = mesh->m_Vertices.size(), indices_count = mesh->m_Indices.size();
+			s_3DData->RendererStats.IndicesCount += indices_count;
+			s_3DData->RendererStats.VerticesCount += vertices_count;
+
+			// -- Retained Static Batches: Record the Mesh into its Material's Static Meshes --
+			// Its vertices are only written if the batch signature (meshes, vertices & transforms versions) changes
+			if (IsRetainedStaticDraw(mesh_component, transform_version))
+			{
+				StaticMaterialDraws& draws = s_3DData->StaticDraws[material->GetID()];
+				draws.DrawMaterial = material;
+				draws.MaterialIndex = material_index;
+				draws.Draws.push_back({ &mesh_component.GetModifiedVertices(), mesh, transform, entity_id });
+
+				HashValue(draws.Signature, mesh->GetID());
+				HashValue(draws.Signature, mesh_component.VerticesVersion);
+				HashValue(draws.Signature, transform_version);
+				HashValue(draws.Signature, entity_id);
+
+				draws.VerticesCount += vertices_count;
+				draws.IndicesCount += indices_count;
+				++s_3DData->StaticDrawsCount;
+				return;
+			}
+
+			// -- Meshes bigger than a whole Batch get a Static Batch of their own --
+			// It's only rebuilt if the mesh, its vertices or its transform change (the transform version might be unknown)
+			if (vertices_count > s_3DData->MaxVertices || indices_count > s_3DData->MaxIndices)
+			{
+				if (s_3DData->OversizedMeshesWarned.insert(mesh->GetID()).second)
+					KS_ENGINE_WARN("Renderer3D: Mesh too big to be batched ({0} vertices, {1} indices), it will be drawn on its own", vertices_count, indices_count);
+
+				StaticMaterialDraws& draws = s_3DData->OversizedDraws.emplace_back();
+				draws.DrawMaterial = material;
+				draws.MaterialIndex = material_index;
+				draws.Draws.push_back({ &mesh_component.GetModifiedVertices(), mesh, transform, entity_id });
+
+				HashValue(draws.Signature, mesh->GetID());
+				HashValue(draws.Signature, mesh_component.VerticesVersion);
+				HashValue(draws.Signature, material_index);
+				HashValue(draws.Signature, transform);
+
+				draws.VerticesCount = vertices_count;
+				draws.IndicesCount = indices_count;
+				++s_3DData->StaticDrawsCount;
+				return;
 			}
 
+			// -- New Batch if the Mesh doesn't fit in the current one (it's written straight into the reserved batch) --
+
+			if (s_3DData->VerticesDrawCount + vertices_count > s_3DData->MaxVertices || s_3DData->IndicesDrawCount + indices_count > s_3DData->MaxIndices)
+				NextBatch();
+
+			// -- Setup Vertex Array & Vertex Attributes --
+			SetMeshVertices(s_3DData->VBufferPtr, mesh_component.GetModifiedVertices(), transform, material_index, entity_id);
+			s_3DData->VBufferPtr += vertices_count;
+
 			// -- Setup Index Buffer --
-			std::vector<uint> indices = mesh->m_Indices;
-			for (uint i = 0; i < indices.size(); ++i)
-				s_3DData->Indices.push_back(s_3DData->IndicesCurrentOffset + indices[i]);
+			for (uint index : mesh->m_Indices)
+				*s_3DData->IndicesPtr++ = s_3DData->IndicesCurrentOffset + index;
 
-			// -- Update Stats --
-			s_3DData->RendererStats.IndicesCount = s_3DData->IndicesDrawCount += indices.size();
-			s_3DData->RendererStats.VerticesCount += mesh->m_Vertices.size();
+			// -- Update Batch Counts --
+			s_3DData->IndicesDrawCount += indices_count;
+			s_3DData->VerticesDrawCount += vertices_count;
 			s_3DData->IndicesCurrentOffset += mesh->m_MaxIndex;
 		}
 	}
@@ -8,9 +8,14 @@
 
 namespace Kaimos {
 
+	class Mesh;
 	class Material;
 
 	struct MeshRendererComponent;
+	struct InstancedMeshBatch;
+	struct StaticMeshBatch;
+	struct StaticMaterialDraws;
+	struct BatchVertex;
 	struct Vertex
 	{
 		// --- Vertex Variables ---
@@ -18,37 +23,12 @@ namespace Kaimos {
 		glm::vec3 Normal	= glm::vec3(0.0f);
 		glm::vec3 Tangent	= glm::vec3(0.0f);
 		glm::vec2 TexCoord	= glm::vec2(0.0f);
-		glm::vec4 Color		= glm::vec4(1.0f);
-		float Bumpiness		= 0.5f;
-
-		int TexIndex		= 0.0f;
-		int NormTexIndex	= 0.0f;
 
+		// Material values aren't stored per vertex, the batched vertices index them in the renderer's materials table
 		// --- Editor Variables ---
 		int EntityID		= 0;
 	};
 
-	struct NonPBRVertex : Vertex
-	{
-		float Shininess		= 0.5f;
-		float Specularity	= 0.5f;
-
-		int SpecTexIndex	= 0.0f;
-	};
-
-	struct PBRVertex : Vertex
-	{
-		float Roughness		= 0.5f;
-		float Metallic		= 0.5f;
-		float AmbientOcc	= 0.5f;
-
-		int MetalTexIndex	= 0.0f;
-		int RoughTexIndex	= 0.0f;
-		int AOTexIndex		= 0.0f;
-	};
-
-
-
 	class Renderer3D
 	{
 		friend struct Renderer3DData;
@@ -59,27 +39,49 @@ namespace Kaimos {
 		static void Shutdown();
 
 		// --- Public Renderer Methods ---
-		static void BeginScene();
+		// View is the camera rendering the scene (an ID the caller chooses), retained static batches are kept per view
+		static void BeginScene(uint view_id);
 		static void EndScene();
 
 		// --- Public Drawing Methods ---
-		static void DrawMesh(Timestep dt, const glm::mat4& transform, MeshRendererComponent& mesh_component, int entity_id);
+		// Transform version is the one of the entity's TransformComponent (0 if unknown, then the mesh can't be in a retained batch)
+		static void DrawMesh(Timestep dt, const glm::mat4& transform, MeshRendererComponent& mesh_component, int entity_id, uint transform_version = 0);
+
+		// --- Public Renderer Settings ---
+		static bool IsInstancedRendering();
+		static void SetInstancedRendering(bool instanced_rendering);
+
+		// Static (non-timed) meshes are kept in per-material GPU batches, only rebuilt when their meshes, transforms or material change
+		static bool IsRetainingStaticBatches();
+		static void SetRetainStaticBatches(bool retain_static_batches);
+
+		// If the mesh would be drawn from a retained static batch (its draw order then only changes the batch signature)
+		static bool IsRetainedStaticDraw(const MeshRendererComponent& mesh_component, uint transform_version);
 
 	private:
 
 		// --- Private Renderer Methods ---
 		static void Flush();
+		static void FlushInstances();
 		static void StartBatch();
 		static void NextBatch();
 
-		static void SetBaseVertexData(Vertex* dynamic_vertex, const Vertex& mesh_vertex, const glm::mat4& transform, const Ref<Material>& material, uint albedo_ix, uint norm_ix, uint ent_id);
+		static void SetMeshVertices(BatchVertex* vertices, const std::vector<Vertex>& mesh_vertices, const glm::mat4& transform, uint material_index, int ent_id);
+		static void SetInstancedBatchGeometry(InstancedMeshBatch& batch, const Ref<Mesh>& mesh, const MeshRendererComponent& mesh_component);
+
+		static void FlushStaticBatches();
+		static void DrawStaticBatch(uint64_t batch_key, const StaticMaterialDraws& draws);
+		static void SetStaticBatchGeometry(StaticMeshBatch& batch, const StaticMaterialDraws& draws);
+		static void RemoveUnusedBatches();
 
 	private:
 
 		// --- Renderer Statistics ---
 		struct Statistics
 		{
-			uint DrawCalls = 0, VerticesCount = 0, IndicesCount = 0;
+			uint DrawCalls = 0, VerticesCount = 0, IndicesCount = 0, InstancesCount = 0;
+			uint SubmittedMeshes = 0, CulledMeshes = 0;
+			uint StaticBatchesDrawn = 0, StaticBatchesRebuilt = 0;
 			uint GetTotalTrianglesCount()	const { return IndicesCount / 3; }
 		};
 
@@ -87,8 +89,11 @@ namespace Kaimos {
 
 		// --- Renderer Statistics Methods ---
 		static void ResetStats();
+		static void AddCullingStats(uint submitted_meshes, uint culled_meshes);
 		static const Statistics GetStats();
 		static const uint GetMaxFaces();
+		static const uint GetMaxInstances();
+		static const uint GetRetainedStaticBatchesCount();
 	};
 }
 
@@ -0,0 +1,92 @@
+#ifndef _BATCHFORMATS_H_
+#define _BATCHFORMATS_H_
+
+#include "Buffer.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/packing.hpp>
+
+namespace Kaimos {
+
+	// ---- Texture Slots of a Material in the current Batch ----
+	struct MaterialTextureIndices
+	{
+		uint Albedo = 0, Normal = 1, Specular = 0;
+		uint Roughness = 0, Metallic = 0, AmbientOcc = 0;
+	};
+
+
+
+	// ---- Entry of the Renderer's Materials Table (std430, must match the Materials buffer in the batch shaders) ----
+	// Holds the values of both pipelines (the shader of the scene takes the ones it uses) and the texture slots of the material in the current batch
+	// With bindless textures, the slots are the MATERIAL_TEXTURES indices and the textures are sampled from the handles instead
+	struct MaterialData
+	{
+		static constexpr uint TexturesCount = 6;
+
+		glm::vec4 Color = glm::vec4(1.0f);
+		float NormalStrength = 0.5f, Shininess = 0.5f, SpecularStrength = 0.5f, Roughness = 0.5f;
+		float Metallic = 0.5f, AmbientOcclusion = 0.5f;
+		int TexIndex = 0, NormTexIndex = 1;
+		int SpecTexIndex = 0, RoughTexIndex = 0, MetalTexIndex = 0, AOTexIndex = 0;
+		uint64_t TextureHandles[TexturesCount] = { 0 };		// In MATERIAL_TEXTURES order (0 if bindless textures aren't used)
+	};
+
+
+
+	// ---- Vertex of the Batched Renderers (32 bytes) ----
+	// World position, octahedral-encoded normal & tangent (2 snorm16 each), half-float UVs and the index of its material in the materials table
+	struct BatchVertex
+	{
+		glm::vec3 Pos		= glm::vec3(0.0f);
+		uint Normal			= 0;
+		uint Tangent		= 0;
+		uint TexCoord		= 0;
+		uint MaterialIndex	= 0;
+
+		// --- Editor Variables ---
+		int EntityID		= 0;
+
+		static BufferLayout GetLayout()
+		{
+			return {
+				{ SHADER_DATATYPE::FLOAT3,		"a_Position" },
+				{ SHADER_DATATYPE::SHORT2_NORM,	"a_Normal" },
+				{ SHADER_DATATYPE::SHORT2_NORM,	"a_Tangent" },
+				{ SHADER_DATATYPE::HALF2,		"a_TexCoord" },
+				{ SHADER_DATATYPE::UINT,		"a_MaterialIndex" },
+				{ SHADER_DATATYPE::INT,			"a_EntityID" }
+			};
+		}
+	};
+
+
+
+	// ---- Vertex Attributes Packing ----
+	// Octahedral encoding of a direction into 2 snorm16 (decoded by DecodeOctahedral() in the batch shaders)
+	inline uint PackOctahedral(const glm::vec3& direction)
+	{
+		float abs_sum = glm::abs(direction.x) + glm::abs(direction.y) + glm::abs(direction.z);
+		if (abs_sum == 0.0f)
+			return glm::packSnorm2x16(glm::vec2(0.0f));
+
+		glm::vec3 octahedron = direction / abs_sum;
+		glm::vec2 encoded = glm::vec2(octahedron);
+
+		// Lower hemisphere is folded over the diagonals
+		if (octahedron.z < 0.0f)
+		{
+			glm::vec2 signs = glm::vec2(encoded.x >= 0.0f ? 1.0f : -1.0f, encoded.y >= 0.0f ? 1.0f : -1.0f);
+			encoded = (1.0f - glm::abs(glm::vec2(encoded.y, encoded.x))) * signs;
+		}
+
+		return glm::packSnorm2x16(encoded);
+	}
+
+	inline uint PackHalf2(const glm::vec2& value)
+	{
+		return glm::packHalf2x16(value);
+	}
+}
+
+#endif //_BATCHFORMATS_H_
@@ -3,6 +3,7 @@
 #include "Renderer/Renderer.h"
 
 #include "Renderer/OpenGL/Resources/OGLBuffer.h"
+#include "Renderer/Null/Resources/NullBuffer.h"
 
 namespace Kaimos {
 
@@ -14,6 +15,7 @@ namespace Kaimos {
 		switch (Renderer::GetRendererAPI())
 		{
 			case RendererAPI::API::OPENGL:		return CreateRef<OGLVertexBuffer>(vertices, size);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullVertexBuffer>(vertices, size);
 			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
@@ -26,6 +28,20 @@ namespace Kaimos {
 		switch (Renderer::GetRendererAPI())
 		{
 			case RendererAPI::API::OPENGL:		return CreateRef<OGLVertexBuffer>(size);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullVertexBuffer>(size);
+			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
+		}
+
+		KS_FATAL_ERROR("RendererAPI is unknown, not selected or failed!");
+		return nullptr;
+	}
+
+	Ref<VertexBuffer> VertexBuffer::CreateStreaming(uint size)
+	{
+		switch (Renderer::GetRendererAPI())
+		{
+			case RendererAPI::API::OPENGL:		return CreateRef<OGLVertexBuffer>(size, true);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullVertexBuffer>(size, true);
 			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
@@ -41,6 +57,7 @@ namespace Kaimos {
 		switch (Renderer::GetRendererAPI())
 		{
 			case RendererAPI::API::OPENGL:		return CreateRef<OGLIndexBuffer>(vertices, count);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullIndexBuffer>(vertices, count);
 			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
@@ -53,6 +70,20 @@ namespace Kaimos {
 		switch (Renderer::GetRendererAPI())
 		{
 			case RendererAPI::API::OPENGL:		return CreateRef<OGLIndexBuffer>(count);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullIndexBuffer>(count);
+			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
+		}
+
+		KS_FATAL_ERROR("RendererAPI is unknown, not selected or failed!");
+		return nullptr;
+	}
+
+	Ref<IndexBuffer> IndexBuffer::CreateStreaming(uint count)
+	{
+		switch (Renderer::GetRendererAPI())
+		{
+			case RendererAPI::API::OPENGL:		return CreateRef<OGLIndexBuffer>(count, true);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullIndexBuffer>(count, true);
 			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
@@ -62,12 +93,45 @@ namespace Kaimos {
 
 
 	
+	// ----------------------- Uniform Buffer Creation ----------------------------------------------------
+	Ref<UniformBuffer> UniformBuffer::Create(uint size, uint binding)
+	{
+		switch (Renderer::GetRendererAPI())
+		{
+			case RendererAPI::API::OPENGL:		return CreateRef<OGLUniformBuffer>(size, binding);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullUniformBuffer>(size, binding);
+			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
+		}
+
+		KS_FATAL_ERROR("RendererAPI is unknown, not selected or failed!");
+		return nullptr;
+	}
+
+
+
+	// ----------------------- Storage Buffer Creation ----------------------------------------------------
+	Ref<StorageBuffer> StorageBuffer::Create(uint size, uint binding)
+	{
+		switch (Renderer::GetRendererAPI())
+		{
+			case RendererAPI::API::OPENGL:		return CreateRef<OGLStorageBuffer>(size, binding);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullStorageBuffer>(size, binding);
+			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
+		}
+
+		KS_FATAL_ERROR("RendererAPI is unknown, not selected or failed!");
+		return nullptr;
+	}
+
+
+
 	// ----------------------- Vertex Array Creation ------------------------------------------------------
 	Ref<VertexArray> VertexArray::Create()
 	{
 		switch (Renderer::GetRendererAPI())
 		{
 			case RendererAPI::API::OPENGL:		return CreateRef<OGLVertexArray>();
+			case RendererAPI::API::NULL_API:	return CreateRef<NullVertexArray>();
 			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
@@ -6,7 +6,8 @@
 namespace Kaimos {
 
 
-	enum class SHADER_DATATYPE { NONE = 0, FLOAT, FLOAT2, FLOAT3, FLOAT4, MAT3, MAT4, INT, INT2, INT3, INT4, BOOL };
+	// Packed types (vertex attributes only): HALF2 is 2 half floats & SHORT2_NORM 2 shorts normalized to [-1, 1], both read as vec2
+	enum class SHADER_DATATYPE { NONE = 0, FLOAT, FLOAT2, FLOAT3, FLOAT4, MAT3, MAT4, INT, INT2, INT3, INT4, UINT, BOOL, HALF2, SHORT2_NORM };
 
 
 	static uint ShaderDataTypeSize(SHADER_DATATYPE type)
@@ -23,7 +24,10 @@ namespace Kaimos {
 			case SHADER_DATATYPE::INT2:		return 4 * 2;
 			case SHADER_DATATYPE::INT3:		return 4 * 3;
 			case SHADER_DATATYPE::INT4:		return 4 * 4;
+			case SHADER_DATATYPE::UINT:		return 4;
 			case SHADER_DATATYPE::BOOL:		return 1;			// sizeof(bool)
+			case SHADER_DATATYPE::HALF2:	return 2 * 2;		// 2 bytes per half float
+			case SHADER_DATATYPE::SHORT2_NORM:	return 2 * 2;
 		}
 
 		KS_FATAL_ERROR("Unknown ShaderDataType passed!");
@@ -41,12 +45,13 @@ namespace Kaimos {
 		size_t Offset = 0;
 		uint Size = 0;
 		bool Normalized = false;
+		bool PerInstance = false;	// Advanced once per instance instead of once per vertex (matrices always are)
 
 		// --- Functions ---
 		BufferElement() = default;
 
-		BufferElement(SHADER_DATATYPE type, const std::string& name, bool normalized = false)
-			: Name(name), Type(type), Size(ShaderDataTypeSize(type)), Normalized(normalized)
+		BufferElement(SHADER_DATATYPE type, const std::string& name, bool normalized = false, bool per_instance = false)
+			: Name(name), Type(type), Size(ShaderDataTypeSize(type)), Normalized(normalized), PerInstance(per_instance)
 		{
 		}
 
@@ -64,7 +69,10 @@ namespace Kaimos {
 				case SHADER_DATATYPE::INT2:		return 2;
 				case SHADER_DATATYPE::INT3:		return 3;
 				case SHADER_DATATYPE::INT4:		return 4;
+				case SHADER_DATATYPE::UINT:		return 1;
 				case SHADER_DATATYPE::BOOL:		return 1;
+				case SHADER_DATATYPE::HALF2:	return 2;
+				case SHADER_DATATYPE::SHORT2_NORM:	return 2;
 			}
 
 			KS_FATAL_ERROR("The element has an unknown ShaderDataType!");
@@ -132,6 +140,17 @@ namespace Kaimos {
 
 		static Ref<VertexBuffer> Create(float* vertices, uint size); // This is the "Class Constructor", we take anything we want here (static because doesn't belong to this class)
 		static Ref<VertexBuffer> Create(uint size);
+		static Ref<VertexBuffer> CreateStreaming(uint size); // Persistently mapped ring of size bytes, written with Reserve() & Commit()
+
+		// --- Streaming Methods (only for streaming buffers) ---
+		// Mapped memory to write up to size bytes into (nullptr if they don't fit in the buffer), aligned to alignment bytes
+		virtual void* Reserve(uint size, uint alignment = 1) = 0;
+
+		// Commits the first size bytes written in the reserved memory and returns their offset in the buffer
+		virtual uint Commit(uint size) = 0;
+
+		// Fences the committed data, so it's not overwritten until the GPU has drawn it
+		virtual void Retire() = 0;
 
 		// --- Getters/Setters ---
 		virtual const BufferLayout& GetLayout() const = 0;
@@ -155,7 +174,14 @@ namespace Kaimos {
 
 		static Ref <IndexBuffer> Create(uint* vertices, uint count);
 		static Ref <IndexBuffer> Create(uint count);
-		
+		static Ref <IndexBuffer> CreateStreaming(uint count); // Persistently mapped ring of count indices, written with Reserve() & Commit()
+
+		// --- Streaming Methods (only for streaming buffers, same as in the Vertex Buffer but in indices) ---
+		virtual uint* Reserve(uint count) = 0;
+		virtual uint Commit(uint count) = 0;	// Returns the position of the first committed index in the buffer
+		virtual void Retire() = 0;
+
+
 		// -- Getters --
 		virtual uint GetCount() const = 0;
 		virtual void SetData(const void* data, uint count) = 0;
@@ -163,6 +189,44 @@ namespace Kaimos {
 
 
 
+	// ---- Class to define a Uniform Buffer (virtual interface) ----
+	// Block of uniforms shared by all shaders declaring it at the same binding point (std140 layout)
+	class UniformBuffer
+	{
+	public:
+
+		// --- Public Class Methods ---
+		virtual ~UniformBuffer() = default;
+		static Ref<UniformBuffer> Create(uint size, uint binding);
+
+		// --- Getters/Setters ---
+		virtual uint GetBinding() const = 0;
+		virtual void SetData(const void* data, uint size, uint offset = 0) = 0;
+	};
+
+
+
+	// ---- Class to define a Shader Storage Buffer (virtual interface) ----
+	// Like the Uniform Buffer but for big (or unsized) arrays, read by shaders as std430 buffer blocks
+	class StorageBuffer
+	{
+	public:
+
+		// --- Public Class Methods ---
+		virtual ~StorageBuffer() = default;
+		static Ref<StorageBuffer> Create(uint size, uint binding);
+
+		// --- Public Storage Buffer Methods ---
+		// Binds it to its binding point again (it's bound on creation), for buffers sharing a binding point
+		virtual void Bind() const = 0;
+
+		// --- Getters/Setters ---
+		virtual uint GetBinding() const = 0;
+		virtual void SetData(const void* data, uint size, uint offset = 0) = 0;
+	};
+
+
+
 	// ---- Class to define a Vertex Array (virtual interface) ----
 	class VertexArray
 	{
@@ -3,6 +3,7 @@
 
 #include "Renderer/Renderer.h"
 #include "Renderer/OpenGL/Resources/OGLFrameBuffer.h"
+#include "Renderer/Null/Resources/NullFramebuffer.h"
 
 namespace Kaimos {
 
@@ -11,6 +12,7 @@ namespace Kaimos {
 		switch (Renderer::GetRendererAPI())
 		{
 			case RendererAPI::API::OPENGL:		return CreateRef<OGLFramebuffer>(settings, generate_depth_renderbuffer);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullFramebuffer>(settings);
 			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
@@ -23,6 +25,7 @@ namespace Kaimos {
 		switch (Renderer::GetRendererAPI())
 		{
 		case RendererAPI::API::OPENGL:		return CreateRef<OGLFramebuffer>(width, height, generate_depth_renderbuffer);
+		case RendererAPI::API::NULL_API:	return CreateRef<NullFramebuffer>(FramebufferSettings{ width, height });
 		case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
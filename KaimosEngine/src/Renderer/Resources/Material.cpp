@@ -3,6 +3,8 @@
 
 #include "Core/Utils/Maths/RandomGenerator.h"
 #include "Renderer/Resources/Texture.h"
+#include "Renderer/Renderer3D.h"
+#include "Core/Resources/ResourceManager.h"
 
 
 namespace Kaimos {
@@ -64,30 +66,39 @@ namespace Kaimos {
 		return ret;
 	}
 
+	void Material::AssignTexture(MATERIAL_TEXTURES texture_type, const Ref<Texture2D>& new_texture, const std::string& filepath)
+	{
+		Ref<Texture2D>* texture = &GetMaterialTexture(texture_type);
+		std::string* texture_filepath = &GetMaterialTextureFilepath(texture_type);
+
+		RemoveTexture(texture_type);
+		*texture = new_texture;
+
+		size_t assets_pos = filepath.find("assets");
+		if (assets_pos != filepath.npos)
+			*texture_filepath = filepath.substr(assets_pos, filepath.size());
+		else
+			*texture_filepath = filepath;
+	}
+
 
 
 	// ----------------------- Public Texture Methods -----------------------------------------------------
 	void Material::SetTexture(MATERIAL_TEXTURES texture_type, const std::string& filepath)
 	{
-		Ref<Texture2D> new_texture = Texture2D::Create(filepath);
+		Ref<Texture2D> new_texture = Resources::ResourceManager::GetTexture(filepath);
 		if (new_texture)
-		{
-			Ref<Texture2D>* texture = &GetMaterialTexture(texture_type);
-			std::string* texture_filepath = &GetMaterialTextureFilepath(texture_type);
-
-			RemoveTexture(texture_type);
-			*texture = new_texture;
-
-			size_t assets_pos = filepath.find("assets");
-			if (assets_pos != filepath.npos)
-				*texture_filepath = filepath.substr(assets_pos, filepath.size());
-			else
-				*texture_filepath = filepath;
-		}
+			AssignTexture(texture_type, new_texture, filepath);
 		else
 			KS_EDITOR_WARN("Couldn't load Texture from '{0}'", filepath);
 	}
 
+	void Material::SetTexture(MATERIAL_TEXTURES texture_type, const Ref<Texture2D>& texture)
+	{
+		if (texture)
+			AssignTexture(texture_type, texture, texture->GetFilepath());
+	}
+
 	void Material::RemoveTexture(MATERIAL_TEXTURES texture_type)
 	{
 		Ref<Texture2D>* texture = &GetMaterialTexture(texture_type);
@@ -153,11 +164,31 @@ namespace Kaimos {
 		m_AttachedGraph->SyncVertexParameterNodes(vtxpm_node_type, value);
 	}
 
+	void Material::EvaluateVertexAttributes(std::vector<Vertex>& vertices, bool position, bool normal, bool tex_coords) const
+	{
+		m_AttachedGraph->GetVertexAttributesProgram().EvaluateVertices(vertices, position, normal, tex_coords);
+	}
+
+	const MaterialEditor::MaterialGraphProgram& Material::GetVertexAttributesProgram() const
+	{
+		return m_AttachedGraph->GetVertexAttributesProgram();
+	}
+
 	void Material::SyncGraphValuesWithMaterial()
 	{
 		m_AttachedGraph->SyncMainNodeValuesWithMaterial();
 	}
 
+	uint Material::GetGraphVersion() const
+	{
+		return m_AttachedGraph->GetVersion();
+	}
+
+	void Material::UpdateGraphVersion() const
+	{
+		m_AttachedGraph->UpdateVersion();
+	}
+
 	void Material::RemoveGraph()
 	{
 		if (m_AttachedGraph)
@@ -31,11 +31,13 @@ namespace Kaimos {
 		// --- Private Texture Methods ---
 		Ref<Texture2D>& GetMaterialTexture(MATERIAL_TEXTURES texture_type);
 		std::string& GetMaterialTextureFilepath(MATERIAL_TEXTURES texture_type);
+		void AssignTexture(MATERIAL_TEXTURES texture_type, const Ref<Texture2D>& texture, const std::string& filepath);
 
 	public:
 
 		// --- Public Texture Methods ---
 		void SetTexture(MATERIAL_TEXTURES texture_type, const std::string& filepath);
+		void SetTexture(MATERIAL_TEXTURES texture_type, const Ref<Texture2D>& texture);
 		void RemoveTexture(MATERIAL_TEXTURES texture_type);
 
 		// --- Texture Getters ---
@@ -59,7 +61,13 @@ namespace Kaimos {
 		// --- Public Graph Methods ---
 		bool IsVertexAttributeTimed(MaterialEditor::VertexParameterNodeType vtxpm_node_type) const;
 		void UpdateVertexParameter(MaterialEditor::VertexParameterNodeType vtxpm_node_type, const glm::vec4& value) const;
+		void EvaluateVertexAttributes(std::vector<Vertex>& vertices, bool position = true, bool normal = true, bool tex_coords = true) const;
+		const MaterialEditor::MaterialGraphProgram& GetVertexAttributesProgram() const;
 		void SyncGraphValuesWithMaterial();
+
+		// Vertices evaluated with another graph version are outdated (see MaterialGraph::GetVersion())
+		uint GetGraphVersion() const;
+		void UpdateGraphVersion() const;
 		void RemoveGraph();
 
 		// This will set the material graph to the passed one and delete the passed one
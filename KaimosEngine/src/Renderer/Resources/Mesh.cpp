@@ -62,6 +62,21 @@ namespace Kaimos {
 		}
 	}
 
+	void Mesh::CalculateBoundingVolumes()
+	{
+		m_AABB = {};
+		for (const Vertex& vertex : m_Vertices)
+			m_AABB.Enclose(vertex.Pos);
+
+		m_BoundingSphere = {};
+		if (!m_AABB.IsValid())
+			return;
+
+		m_BoundingSphere = { m_AABB.GetCenter(), 0.0f };
+		for (const Vertex& vertex : m_Vertices)
+			m_BoundingSphere.Enclose(vertex.Pos);
+	}
+
 	void Mesh::SetParentModel(Resources::ResourceModel* model)
 	{
 		if (model)
@@ -3,6 +3,7 @@
 
 #include "Core/Core.h"
 #include "Core/Utils/Maths/RandomGenerator.h"
+#include "Core/Utils/Maths/BoundingVolumes.h"
 #include "Renderer/Renderer3D.h"
 #include "Buffer.h"
 
@@ -39,6 +40,11 @@ namespace Kaimos {
 		const std::string GetParentModelName()			const;
 		const std::vector<Ref<Mesh>>& GetSubmeshes()	const { return m_Submeshes; }
 		const std::vector<Vertex>& GetVertices()		const { return m_Vertices; }
+		const std::vector<uint>& GetIndices()			const { return m_Indices; }
+
+		// Bounding volumes in mesh (local) space
+		const Maths::AABB& GetAABB()						const { return m_AABB; }
+		const Maths::BoundingSphere& GetBoundingSphere()	const { return m_BoundingSphere; }
 
 		// --- Public Mesh Methods ---
 		void AddSubmesh(const Ref<Mesh>& mesh);
@@ -49,9 +55,11 @@ namespace Kaimos {
 		// --- Private Mesh Methods ---
 		void DeleteSubmesh(Mesh* submesh_to_delete);
 		void SetParentModel(Resources::ResourceModel* model);
-		void SetMeshVertices(const std::vector<Vertex>& mesh_vertices) { m_Vertices = mesh_vertices; }
-		void SetMeshIndices(const std::vector<uint>& mesh_indices) { m_Indices = mesh_indices; }
+		void SetMeshVertices(std::vector<Vertex> mesh_vertices) { m_Vertices = std::move(mesh_vertices); }
+		void SetMeshIndices(std::vector<uint> mesh_indices) { m_Indices = std::move(mesh_indices); }
 		void SetMaxIndex(uint max_index) { m_MaxIndex = max_index; }
+		void SetBoundingVolumes(const Maths::AABB& aabb, const Maths::BoundingSphere& sphere) { m_AABB = aabb; m_BoundingSphere = sphere; }
+		void CalculateBoundingVolumes();
 
 	private:
 
@@ -63,6 +71,9 @@ namespace Kaimos {
 		std::vector<uint> m_Indices;
 		uint m_MaxIndex = 0;
 
+		Maths::AABB m_AABB = {};
+		Maths::BoundingSphere m_BoundingSphere = {};
+
 		Mesh* m_ParentMesh = nullptr;
 		std::vector<Ref<Mesh>> m_Submeshes;		
 		Resources::ResourceModel* m_ParentModel = nullptr;
@@ -0,0 +1,109 @@
+#include "kspch.h"
+#include "RingAllocator.h"
+
+namespace Kaimos {
+
+	// ----------------------- Public Class Methods -------------------------------------------------------
+	RingAllocator::RingAllocator(uint capacity, ScopePtr<RingFences> fences)
+		: m_Fences(std::move(fences)), m_Capacity(capacity)
+	{
+		KS_ENGINE_ASSERT(m_Fences, "Ring Allocator created without a fences backend!");
+	}
+
+	RingAllocator::~RingAllocator()
+	{
+		for (const Range& range : m_InFlightRanges)
+			if (range.Fenced)
+				m_Fences->Release(range.Fence);
+	}
+
+
+
+	// ----------------------- Public Ring Methods --------------------------------------------------------
+	uint RingAllocator::Reserve(uint size, uint alignment)
+	{
+		KS_PROFILE_FUNCTION();
+		m_ReservedOffset = UINT_MAX;
+		m_ReservedSize = 0;
+
+		if (size > m_Capacity || alignment == 0)
+		{
+			KS_ENGINE_WARN("RingAllocator: Can't reserve {0} bytes in a ring of {1} bytes", size, m_Capacity);
+			return UINT_MAX;
+		}
+
+		// -- Release the Ranges the GPU already finished --
+		while (!m_InFlightRanges.empty() && m_InFlightRanges.front().Fenced && m_Fences->IsSignaled(m_InFlightRanges.front().Fence))
+			ReleaseOldestRange();
+
+		// -- Range Placement (wraps to the ring's beginning if it doesn't fit before its end) --
+		uint offset = ((m_Head + alignment - 1) / alignment) * alignment;
+		if (offset + size > m_Capacity)
+			offset = 0;
+
+		// -- Wait for the GPU to finish the ranges overlapping it --
+		bool waited = false;
+		while (IsRangeInFlight(offset, offset + size))
+		{
+			if (!m_InFlightRanges.front().Fenced)
+				Retire();
+
+			waited |= m_Fences->Wait(m_InFlightRanges.front().Fence);
+			ReleaseOldestRange();
+		}
+
+		if (waited)
+			++m_WaitsCount;
+
+		m_ReservedOffset = offset;
+		m_ReservedSize = size;
+		return offset;
+	}
+
+	uint RingAllocator::Commit(uint size)
+	{
+		KS_ENGINE_ASSERT(m_ReservedOffset != UINT_MAX, "RingAllocator: Committing without a reservation!");
+		KS_ENGINE_ASSERT(size <= m_ReservedSize, "RingAllocator: Committing more than reserved!");
+
+		uint offset = m_ReservedOffset;
+		if (size > 0)
+		{
+			m_InFlightRanges.push_back({ offset, offset + size });
+			m_Head = offset + size;
+		}
+
+		m_ReservedOffset = UINT_MAX;
+		m_ReservedSize = 0;
+		return offset;
+	}
+
+	void RingAllocator::Retire()
+	{
+		for (Range& range : m_InFlightRanges)
+		{
+			if (!range.Fenced)
+			{
+				range.Fence = m_Fences->Insert();
+				range.Fenced = true;
+			}
+		}
+	}
+
+
+
+	// ----------------------- Private Ring Methods -------------------------------------------------------
+	bool RingAllocator::IsRangeInFlight(uint begin, uint end) const
+	{
+		for (const Range& range : m_InFlightRanges)
+			if (begin < range.End && range.Begin < end)
+				return true;
+
+		return false;
+	}
+
+	void RingAllocator::ReleaseOldestRange()
+	{
+		m_Fences->Release(m_InFlightRanges.front().Fence);
+		m_InFlightRanges.pop_front();
+	}
+}
@@ -0,0 +1,77 @@
+#ifndef _RINGALLOCATOR_H_
+#define _RINGALLOCATOR_H_
+
+#include <deque>
+
+namespace Kaimos {
+
+	// ---- Fences Backend of a Ring Allocator (virtual interface) ----
+	// GPU sync objects of the rendering API (the null backend ones are always signaled)
+	class RingFences
+	{
+	public:
+
+		virtual ~RingFences() = default;
+
+		virtual uint64_t Insert() = 0;					// Fence signaled once the commands submitted until now are done
+		virtual bool IsSignaled(uint64_t fence) = 0;	// Non-blocking check
+		virtual bool Wait(uint64_t fence) = 0;			// Blocks until the fence is signaled, returns true if it had to block
+		virtual void Release(uint64_t fence) = 0;		// Called once per inserted fence
+	};
+
+
+
+	// ---- Ring Allocator ----
+	// Sub-allocates ranges of a (persistently mapped) buffer in a circular way: each range is fenced once its draws are submitted,
+	// and it's only handed out again when the GPU has signaled that fence, so the CPU never writes what the GPU is still reading
+	// Usage: Reserve() the max size to write, Commit() the size actually written, draw it and Retire() the committed ranges
+	class RingAllocator
+	{
+	public:
+
+		// --- Public Class Methods ---
+		RingAllocator(uint capacity, ScopePtr<RingFences> fences);
+		~RingAllocator();
+
+		// --- Public Ring Methods ---
+		// Offset of a free range of size bytes, waiting for the GPU if needed (UINT_MAX if size is bigger than the ring)
+		// Only one reservation is held at a time, reserving again drops the previous (uncommitted) one
+		uint Reserve(uint size, uint alignment = 1);
+
+		// Commits the first size bytes of the reservation and returns its offset
+		uint Commit(uint size);
+
+		// Fences the committed ranges, call it after submitting the draws reading them
+		void Retire();
+
+		// --- Getters ---
+		uint GetCapacity()				const { return m_Capacity; }
+		uint GetWaitsCount()			const { return m_WaitsCount; }
+		uint GetInFlightRangesCount()	const { return (uint)m_InFlightRanges.size(); }
+		const RingFences* GetFences()	const { return m_Fences.get(); }
+
+	private:
+
+		// --- Private Ring Methods ---
+		bool IsRangeInFlight(uint begin, uint end) const;
+		void ReleaseOldestRange();
+
+	private:
+
+		struct Range
+		{
+			uint Begin = 0, End = 0;
+			uint64_t Fence = 0;
+			bool Fenced = false;
+		};
+
+		ScopePtr<RingFences> m_Fences = nullptr;
+		std::deque<Range> m_InFlightRanges;		// In allocation order, so the front one is the first the GPU finishes
+
+		uint m_Capacity = 0, m_Head = 0;
+		uint m_ReservedOffset = UINT_MAX, m_ReservedSize = 0;
+		uint m_WaitsCount = 0;					// Reservations that had to block on the GPU (the ring is too small if it keeps growing)
+	};
+}
+
+#endif //_RINGALLOCATOR_H_
@@ -3,17 +3,19 @@
 
 #include "Renderer/Renderer.h"
 #include "Renderer/OpenGL/Resources/OGLShader.h"
+#include "Renderer/Null/Resources/NullShader.h"
 
 namespace Kaimos {
 
 
 	// ----------------------- Public Shader Methods ------------------------------------------------------
 	// Here we decide which rendering API we are using, thus which kind of class type we instantiate/return
-	Ref<Shader> Shader::Create(const std::string& filepath)
+	Ref<Shader> Shader::Create(const std::string& filepath, const std::vector<std::string>& defines)
 	{
 		switch (Renderer::GetRendererAPI())
 		{
-			case RendererAPI::API::OPENGL:		return CreateRef<OGLShader>(filepath);
+			case RendererAPI::API::OPENGL:		return CreateRef<OGLShader>(filepath, defines);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullShader>(std::filesystem::path(filepath).stem().string());
 			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
@@ -27,6 +29,7 @@ namespace Kaimos {
 		switch (Renderer::GetRendererAPI())
 		{
 			case RendererAPI::API::OPENGL:		return CreateRef<OGLShader>(name, vertex_src, fragment_src);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullShader>(name);
 			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
@@ -66,10 +69,10 @@ namespace Kaimos {
 		return shader;
 	}
 
-	Ref<Shader> ShaderLibrary::Load(const std::string& name, const std::string& filepath)
+	Ref<Shader> ShaderLibrary::Load(const std::string& name, const std::string& filepath, const std::vector<std::string>& defines)
 	{
 		KS_PROFILE_FUNCTION();
-		Ref<Shader>shader = Shader::Create(filepath);
+		Ref<Shader>shader = Shader::Create(filepath, defines);
 		Add(name, shader);
 		return shader;
 	}
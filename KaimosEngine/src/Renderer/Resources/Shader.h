@@ -5,6 +5,16 @@
 
 namespace Kaimos {
 
+	// Uniform resolved once with Shader::GetUniformHandle(), so it can be set without name lookups
+	// It's only valid for the shader which resolved it, and setting an invalid (not found) one does nothing
+	struct UniformHandle
+	{
+		int Index = -1;
+		bool IsValid() const { return Index >= 0; }
+	};
+
+
+
 	class Shader
 	{
 	public:
@@ -16,7 +26,7 @@ namespace Kaimos {
 		virtual void Bind() const = 0;
 		virtual void Unbind() const = 0;
 
-		static Ref<Shader> Create(const std::string& filepath);
+		static Ref<Shader> Create(const std::string& filepath, const std::vector<std::string>& defines = {});
 		static Ref<Shader> Create(const std::string& name, const std::string& vertex_src, const std::string& fragment_src);
 
 		// --- Getters ---
@@ -25,13 +35,24 @@ namespace Kaimos {
 	public:
 
 		// --- Uniforms ---
-		virtual void SetUniformFloat(const std::string& name, float value) = 0;
-		virtual void SetUniformFloat2(const std::string& name, const glm::vec2& value) = 0;
-		virtual void SetUniformFloat3(const std::string& name, const glm::vec3& value) = 0;
-		virtual void SetUniformFloat4(const std::string& name, const glm::vec4& value) = 0;
-		virtual void SetUniformMat4(const std::string& name,  const glm::mat4& value) = 0;
-		virtual void SetUniformInt(const std::string& name, int value) = 0;
-		virtual void SetUniformIntArray(const std::string& name, int* values_array, uint size) = 0;
+		virtual UniformHandle GetUniformHandle(const std::string& name) = 0;
+
+		virtual void SetUniformFloat(UniformHandle uniform, float value) = 0;
+		virtual void SetUniformFloat2(UniformHandle uniform, const glm::vec2& value) = 0;
+		virtual void SetUniformFloat3(UniformHandle uniform, const glm::vec3& value) = 0;
+		virtual void SetUniformFloat4(UniformHandle uniform, const glm::vec4& value) = 0;
+		virtual void SetUniformMat4(UniformHandle uniform, const glm::mat4& value) = 0;
+		virtual void SetUniformInt(UniformHandle uniform, int value) = 0;
+		virtual void SetUniformIntArray(UniformHandle uniform, int* values_array, uint size) = 0;
+
+		// By name (resolving the handle on each call, better not to use them in hot paths)
+		void SetUniformFloat(const std::string& name, float value)							{ SetUniformFloat(GetUniformHandle(name), value); }
+		void SetUniformFloat2(const std::string& name, const glm::vec2& value)				{ SetUniformFloat2(GetUniformHandle(name), value); }
+		void SetUniformFloat3(const std::string& name, const glm::vec3& value)				{ SetUniformFloat3(GetUniformHandle(name), value); }
+		void SetUniformFloat4(const std::string& name, const glm::vec4& value)				{ SetUniformFloat4(GetUniformHandle(name), value); }
+		void SetUniformMat4(const std::string& name, const glm::mat4& value)				{ SetUniformMat4(GetUniformHandle(name), value); }
+		void SetUniformInt(const std::string& name, int value)								{ SetUniformInt(GetUniformHandle(name), value); }
+		void SetUniformIntArray(const std::string& name, int* values_array, uint size)		{ SetUniformIntArray(GetUniformHandle(name), values_array, size); }
 	};
 
 
@@ -47,7 +68,7 @@ namespace Kaimos {
 		void Add(const std::string name, const Ref<Shader>& shader);
 		
 		Ref<Shader> Load(const std::string& filepath);
-		Ref<Shader> Load(const std::string& name, const std::string& filepath);
+		Ref<Shader> Load(const std::string& name, const std::string& filepath, const std::vector<std::string>& defines = {});
 
 		// --- Getters ---
 		Ref<Shader> Get(const std::string& name);
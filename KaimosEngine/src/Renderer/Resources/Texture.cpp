@@ -3,14 +3,67 @@
 
 #include "Renderer/Renderer.h"
 #include "Renderer/OpenGL/Resources/OGLTexture.h"
+#include "Renderer/Null/Resources/NullTexture.h"
+
+#include <stb_image.h>
 
 namespace Kaimos {
 
+	// ----------------------- TEXTURE DATA ---------------------------------------------------------------
+	Ref<TextureData> TextureData::Load(const std::string& filepath)
+	{
+		// -- Check Paths --
+		// In this case we check "assets" for textures and "internal" for icons
+		if (filepath.find("assets") == std::string::npos && filepath.find("internal") == std::string::npos)
+		{
+			KS_ERROR("Cannot load an out-of-project texture! Try moving it inside 'assets/' folder.\nCurrent Filepath: {0}", filepath);
+			return nullptr;
+		}
+
+		std::filesystem::path path = filepath;
+		if (!std::filesystem::exists(path))
+		{
+			KS_ERROR("Unexisting Path Loading Texture: {0}", filepath);
+			return nullptr;
+		}
+
+		// -- Decode Image (the flip flag is set per thread, so it can be loaded from any of them) --
+		KS_PROFILE_FUNCTION();
+		int w, h, channels;
+		stbi_set_flip_vertically_on_load_thread(1);
+		stbi_uc* pixels = stbi_load(filepath.c_str(), &w, &h, &channels, 0);
+
+		if (!pixels)
+		{
+			KS_ERROR("Failed to load texture data from path: {0}", filepath);
+			return nullptr;
+		}
+
+		Ref<TextureData> data = Ref<TextureData>(new TextureData());
+		data->m_Filepath = filepath;
+		data->m_Pixels = pixels;
+		data->m_Width = (uint)w;
+		data->m_Height = (uint)h;
+		data->m_Channels = (uint)channels;
+		return data;
+	}
+
+	TextureData::~TextureData()
+	{
+		if (m_Pixels)
+			stbi_image_free(m_Pixels);
+	}
+
+
+
+	// ----------------------- TEXTURES -------------------------------------------------------------------
+
 	Ref<Texture2D> Texture2D::Create(uint width, uint height)
 	{
 		switch (Renderer::GetRendererAPI())
 		{
 			case RendererAPI::API::OPENGL:		return CreateRef<OGLTexture2D>(width, height);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullTexture2D>(width, height);
 			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
@@ -23,6 +76,22 @@ namespace Kaimos {
 		switch (Renderer::GetRendererAPI())
 		{
 			case RendererAPI::API::OPENGL:		return CreateRef<OGLTexture2D>(filepath);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullTexture2D>(filepath);
+			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
+		}
+
+		KS_FATAL_ERROR("RendererAPI is unknown, not selected or failed!");
+		return nullptr;
+	}
+
+
+
+	Ref<Texture2D> Texture2D::Create(const TextureData& data)
+	{
+		switch (Renderer::GetRendererAPI())
+		{
+			case RendererAPI::API::OPENGL:		return CreateRef<OGLTexture2D>(data);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullTexture2D>(data);
 			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
@@ -37,6 +106,7 @@ namespace Kaimos {
 		switch (Renderer::GetRendererAPI())
 		{
 			case RendererAPI::API::OPENGL:		return CreateRef<OGL_HDRTexture2D>(filepath);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullHDRTexture2D>(filepath);
 			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
@@ -51,6 +121,7 @@ namespace Kaimos {
 		switch (Renderer::GetRendererAPI())
 		{
 			case RendererAPI::API::OPENGL:		return CreateRef<OGL_LUTTexture>(size);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullLUTTexture>(size);
 			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
@@ -65,6 +136,7 @@ namespace Kaimos {
 		switch (Renderer::GetRendererAPI())
 		{
 			case RendererAPI::API::OPENGL:		return CreateRef<OGL_CubemapTexture>(width, height, linear_mipmap_filtering);
+			case RendererAPI::API::NULL_API:	return CreateRef<NullCubemapTexture>(width, height);
 			case RendererAPI::API::NONE:		KS_FATAL_ERROR("RendererAPI is set to NONE (unsupported)!"); return nullptr;
 		}
 
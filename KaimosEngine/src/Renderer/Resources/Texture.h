@@ -30,14 +30,47 @@ namespace Kaimos {
 
 
 
+	// Image decoded in memory, it can be loaded in any thread and then created as a Texture2D in the main one
+	class TextureData
+	{
+	public:
+
+		// --- Public Class Methods ---
+		static Ref<TextureData> Load(const std::string& filepath);	// nullptr if the file couldn't be decoded
+		~TextureData();
+
+		TextureData(const TextureData&) = delete;
+		TextureData& operator=(const TextureData&) = delete;
+
+		// --- Getters ---
+		const std::string& GetFilepath()	const { return m_Filepath; }
+		const unsigned char* GetPixels()	const { return m_Pixels; }
+		uint GetWidth()						const { return m_Width; }
+		uint GetHeight()					const { return m_Height; }
+		uint GetChannels()					const { return m_Channels; }
+
+	private:
+
+		TextureData() = default;
+
+		std::string m_Filepath = "";
+		unsigned char* m_Pixels = nullptr;
+		uint m_Width = 0, m_Height = 0, m_Channels = 0;
+	};
+
+
+
 	class Texture2D : public Texture
 	{
 	public:
 		static Ref<Texture2D> Create(const std::string& filepath);	//TODO/OJU: We might want to create textures from other things (colors, gradients...)
+		static Ref<Texture2D> Create(const TextureData& data);
 		static Ref<Texture2D> Create(uint width, uint height);
 
 		virtual void SetData(void* data, uint size) = 0;
 		virtual const std::string GetFilepath() const = 0;
+		virtual uint64_t GetMemorySize() const = 0;	// Bytes taken in VRAM, by all its mip levels
+		virtual uint64_t GetBindlessHandle() = 0;	// Resident handle to sample it without binding it (0 if bindless textures aren't supported)
 	};
 
 
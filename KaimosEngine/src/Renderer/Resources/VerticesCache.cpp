@@ -0,0 +1,106 @@
+#include "kspch.h"
+#include "VerticesCache.h"
+
+#include "Mesh.h"
+#include "Material.h"
+
+#include <map>
+#include <tuple>
+
+namespace Kaimos {
+
+	// ----------------------- Globals --------------------------------------------------------------------
+	// Mesh ID, Material ID & Graph Version
+	using VerticesKey = std::tuple<uint, uint, uint>;
+	static std::map<VerticesKey, std::weak_ptr<std::vector<Vertex>>> s_CachedVertices;
+	static size_t s_SweepEntriesCount = 64;		// Expired entries are removed when the cache grows past this (then doubled)
+
+	static VerticesKey GetVerticesKey(uint mesh_id, const Material& material)
+	{
+		return { mesh_id, material.GetID(), material.GetGraphVersion() };
+	}
+
+	static bool IsCacheable(const Material& material)
+	{
+		return !material.GetVertexAttributesProgram().HasRandoms();
+	}
+
+
+
+	// ----------------------- Public Cache Methods -------------------------------------------------------
+	Ref<std::vector<Vertex>> VerticesCache::GetVertices(const Ref<Mesh>& mesh, const Ref<Material>& material)
+	{
+		KS_PROFILE_FUNCTION();
+		if (!mesh || !material)
+			return nullptr;
+
+		Ref<std::vector<Vertex>> vertices = FindVertices(mesh->GetID(), *material);
+		if (vertices)
+			return vertices;
+
+		vertices = CreateRef<std::vector<Vertex>>(mesh->GetVertices());
+		material->EvaluateVertexAttributes(*vertices);
+		AddVertices(mesh->GetID(), *material, vertices);
+		return vertices;
+	}
+
+	Ref<std::vector<Vertex>> VerticesCache::FindVertices(uint mesh_id, const Material& material)
+	{
+		if (!IsCacheable(material))
+			return nullptr;
+
+		auto it = s_CachedVertices.find(GetVerticesKey(mesh_id, material));
+		return it != s_CachedVertices.end() ? it->second.lock() : nullptr;
+	}
+
+	void VerticesCache::AddVertices(uint mesh_id, const Material& material, const Ref<std::vector<Vertex>>& vertices)
+	{
+		if (!IsCacheable(material))
+			return;
+
+		s_CachedVertices[GetVerticesKey(mesh_id, material)] = vertices;
+		if (s_CachedVertices.size() > s_SweepEntriesCount)
+			RemoveExpiredVertices();
+	}
+
+
+
+	// ----------------------- Getters --------------------------------------------------------------------
+	uint VerticesCache::GetCachedVerticesCount()
+	{
+		uint count = 0;
+		for (const auto& entry : s_CachedVertices)
+			if (!entry.second.expired())
+				++count;
+
+		return count;
+	}
+
+	size_t VerticesCache::GetCachedMemory()
+	{
+		size_t memory = 0;
+		for (const auto& entry : s_CachedVertices)
+			if (Ref<std::vector<Vertex>> vertices = entry.second.lock())
+				memory += vertices->capacity() * sizeof(Vertex);
+
+		return memory;
+	}
+
+
+
+	// ----------------------- Private Cache Methods ------------------------------------------------------
+	void VerticesCache::RemoveExpiredVertices()
+	{
+		KS_PROFILE_FUNCTION();
+		for (auto it = s_CachedVertices.begin(); it != s_CachedVertices.end();)
+		{
+			if (it->second.expired())
+				it = s_CachedVertices.erase(it);
+			else
+				++it;
+		}
+
+		// -- Sweep again when the alive entries double --
+		s_SweepEntriesCount = std::max(s_CachedVertices.size() * 2, (size_t)64);
+	}
+}
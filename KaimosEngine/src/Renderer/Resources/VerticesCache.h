@@ -0,0 +1,40 @@
+#ifndef _VERTICESCACHE_H_
+#define _VERTICESCACHE_H_
+
+#include "Renderer/Renderer3D.h"
+
+namespace Kaimos {
+
+	class Mesh;
+	class Material;
+
+	// ---- Evaluated Vertices Cache ----
+	// Vertices of meshes evaluated by material graphs, shared (reference-counted) by all the mesh components with the same mesh
+	// & material, keyed by mesh, material & graph version (so an outdated version is never handed out)
+	// The cache only holds weak references: vertices are freed when no component uses them anymore
+	// Shared vertices must not be written, components wanting to modify theirs (like timed ones) copy them first
+	// Vertices of graphs drawing randoms aren't cached, as each component has to get its own random values
+	class VerticesCache
+	{
+	public:
+
+		// --- Public Cache Methods ---
+		// Vertices of the mesh evaluated by the material, evaluating them only if they aren't cached yet
+		static Ref<std::vector<Vertex>> GetVertices(const Ref<Mesh>& mesh, const Ref<Material>& material);
+
+		// Cached vertices of the mesh & material (null if there aren't), to evaluate them elsewhere (like in parallel) if needed
+		static Ref<std::vector<Vertex>> FindVertices(uint mesh_id, const Material& material);
+		static void AddVertices(uint mesh_id, const Material& material, const Ref<std::vector<Vertex>>& vertices);
+
+		// --- Getters ---
+		static uint GetCachedVerticesCount();	// Alive cached vertices arrays
+		static size_t GetCachedMemory();		// Bytes of those arrays
+
+	private:
+
+		// --- Private Cache Methods ---
+		static void RemoveExpiredVertices();
+	};
+}
+
+#endif //_VERTICESCACHE_H_
@@ -9,6 +9,7 @@
 #include "Renderer/Resources/Mesh.h"
 #include "Renderer/Resources/Material.h"
 #include "Renderer/Resources/Light.h"
+#include "Renderer/Resources/VerticesCache.h"
 #include "ScriptableEntity.h"
 
 #include <glm/glm.hpp>
@@ -18,6 +19,8 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp>
 
+#include <atomic>
+
 
 namespace Kaimos {
 
@@ -55,15 +58,54 @@ namespace Kaimos {
 		TransformComponent(const glm::vec3& pos, const glm::vec3& rot, const glm::vec3& scale)	: Translation(pos), Rotation(rot), Scale(scale)	{}
 
 		// --- Getters ---
-		const glm::mat4 GetTransform() const
+		// Cached, as of the last UpdateTransform() (Scene::UpdateTransforms() at the start of each scene update), they never
+		// write the component, so they can be called from any thread, but changes to Translation, Rotation or Scale done after
+		// that are only seen on the next update
+		const glm::mat4& GetTransform()				const { return m_CachedTransform; }
+		const glm::vec3& GetUpVector()				const { return m_CachedUp; }
+		const glm::vec3& GetRightVector()			const { return m_CachedRight; }
+		const glm::vec3& GetForwardVector()			const { return m_CachedForward; }
+		uint GetVersion()							const { return m_Version; }	// Changes each time the transform does
+
+		// --- Transform Cache ---
+		// Activating or deactivating the entity counts as a change too, so the scene BVH finds it among the changed transforms
+		bool IsDirty() const
 		{
-			glm::mat4 rotation = glm::toMat4(glm::quat(Rotation));
-			return glm::translate(glm::mat4(1.0f), Translation) * rotation * glm::scale(glm::mat4(1.0f), Scale);
+			return !m_CacheValid || EntityActive != m_CachedActive || Translation != m_CachedTranslation || Rotation != m_CachedRotation || Scale != m_CachedScale;
 		}
 
-		const glm::vec3 GetUpVector()				const { return glm::rotate(glm::quat(Rotation), glm::vec3(0.0f, 1.0f, 0.0f)); }
-		const glm::vec3 GetRightVector()			const { return glm::rotate(glm::quat(Rotation), glm::vec3(1.0f, 0.0f, 0.0f)); }
-		const glm::vec3 GetForwardVector()			const { return glm::rotate(glm::quat(Rotation), glm::vec3(0.0f, 0.0f, -1.0f)); }
+		// Returns true if it had to be recalculated (the scene transforms pass calls it in parallel for all the components, nothing
+		// else may read or write the component meanwhile)
+		bool UpdateTransform()
+		{
+			if (!IsDirty())
+				return false;
+
+			glm::quat orientation = glm::quat(Rotation);
+			m_CachedTransform = glm::translate(glm::mat4(1.0f), Translation) * glm::toMat4(orientation) * glm::scale(glm::mat4(1.0f), Scale);
+			m_CachedUp = glm::rotate(orientation, glm::vec3(0.0f, 1.0f, 0.0f));
+			m_CachedRight = glm::rotate(orientation, glm::vec3(1.0f, 0.0f, 0.0f));
+			m_CachedForward = glm::rotate(orientation, glm::vec3(0.0f, 0.0f, -1.0f));
+
+			m_CachedTranslation = Translation;
+			m_CachedRotation = Rotation;
+			m_CachedScale = Scale;
+			m_CachedActive = EntityActive;
+			m_CacheValid = true;
+			m_Version = ++s_VersionCounter;
+			return true;
+		}
+
+	private:
+
+		// Cache variables (the ones of the default transform until the first update)
+		glm::mat4 m_CachedTransform = glm::mat4(1.0f);
+		glm::vec3 m_CachedUp = glm::vec3(0.0f, 1.0f, 0.0f), m_CachedRight = glm::vec3(1.0f, 0.0f, 0.0f), m_CachedForward = glm::vec3(0.0f, 0.0f, -1.0f);
+		glm::vec3 m_CachedTranslation = glm::vec3(0.0f), m_CachedRotation = glm::vec3(0.0f), m_CachedScale = glm::vec3(1.0f);
+		bool m_CacheValid = false, m_CachedActive = true;
+		uint m_Version = 0;
+
+		inline static std::atomic<uint> s_VersionCounter = { 0 };
 	};
 
 
@@ -165,6 +207,16 @@ namespace Kaimos {
 
 
 
+	// ---- VERTICES EVALUATIONS -----------------------------------
+	// Counts the times the vertices of any sprite or mesh are evaluated by their material (not the timed ones) or removed, so the
+	// scene BVH knows when their bounds might have changed without checking all the components each frame (main thread only)
+	struct VerticesEvaluations
+	{
+		inline static uint Count = 0;
+	};
+
+
+
 	// ---- SPRITE COMPONENT ---------------------------------------
 	struct SpriteRendererComponent
 	{
@@ -173,6 +225,10 @@ namespace Kaimos {
 		QuadVertex QuadVertices[4];
 		bool PositionTimed = false, NormalsTimed = false, TexCoordsTimed = false;
 
+		QuadVertex TimedQuadVertices[4];
+		float TimedVerticesClock = 0.0f;
+		static constexpr float s_TimedVerticesInterval = 200.0f;	// In ms
+
 
 		// --- Constructors ---
 		SpriteRendererComponent() = default;
@@ -193,20 +249,21 @@ namespace Kaimos {
 		{
 			SpriteMaterialID = Renderer::GetDefaultMaterialID();
 			SetupVertices();
+			++VerticesEvaluations::Count;
 		}
 
 
 		// --- Vertices Functions ---
-		void CalculateTangents()
+		static void CalculateTangents(QuadVertex* vertices)
 		{
 			// For this function, the same than mesh, not gonna use it to
 			// "reconstruct" the tangents in case anything changes with time nodes
 			// but I'll leave it in case I have problems in the future with time & normals
 			// In any case, I need it to construct Tangents on the meshes setup
-			glm::vec3 edge1 = QuadVertices[1].Pos - QuadVertices[0].Pos;
-			glm::vec3 edge2 = QuadVertices[2].Pos - QuadVertices[0].Pos;
-			glm::vec2 deltaUV1 = QuadVertices[1].TexCoord - QuadVertices[0].TexCoord;
-			glm::vec2 deltaUV2 = QuadVertices[2].TexCoord - QuadVertices[0].TexCoord;
+			glm::vec3 edge1 = vertices[1].Pos - vertices[0].Pos;
+			glm::vec3 edge2 = vertices[2].Pos - vertices[0].Pos;
+			glm::vec2 deltaUV1 = vertices[1].TexCoord - vertices[0].TexCoord;
+			glm::vec2 deltaUV2 = vertices[2].TexCoord - vertices[0].TexCoord;
 
 			glm::vec3 tangent1, tangent2;
 			float f = 1.0f / (deltaUV1.x * deltaUV2.y - deltaUV2.x * deltaUV1.y);
@@ -214,36 +271,38 @@ namespace Kaimos {
 			tangent1.y = f * (deltaUV2.y * edge1.y - deltaUV1.y * edge2.y);
 			tangent1.z = f * (deltaUV2.y * edge1.z - deltaUV1.y * edge2.z);
 
-			edge1 = QuadVertices[2].Pos - QuadVertices[0].Pos;
-			edge2 = QuadVertices[3].Pos - QuadVertices[0].Pos;
-			deltaUV1 = QuadVertices[2].TexCoord - QuadVertices[0].TexCoord;
-			deltaUV2 = QuadVertices[3].TexCoord - QuadVertices[0].TexCoord;
+			edge1 = vertices[2].Pos - vertices[0].Pos;
+			edge2 = vertices[3].Pos - vertices[0].Pos;
+			deltaUV1 = vertices[2].TexCoord - vertices[0].TexCoord;
+			deltaUV2 = vertices[3].TexCoord - vertices[0].TexCoord;
 
 			f = 1.0f / (deltaUV1.x * deltaUV2.y - deltaUV2.x * deltaUV1.y);
 			tangent2.x = f * (deltaUV2.y * edge1.x - deltaUV1.y * edge2.x);
 			tangent2.y = f * (deltaUV2.y * edge1.y - deltaUV1.y * edge2.y);
 			tangent2.z = f * (deltaUV2.y * edge1.z - deltaUV1.y * edge2.z);
 
-			QuadVertices[0].Tangent = QuadVertices[3].Tangent = tangent1;
-			QuadVertices[1].Tangent = QuadVertices[2].Tangent = tangent2;
+			vertices[0].Tangent = vertices[3].Tangent = tangent1;
+			vertices[1].Tangent = vertices[2].Tangent = tangent2;
 		}
 
-		void SetupVertices()
+		static void SetupVertices(QuadVertex* vertices)
 		{
-			QuadVertices[0].Pos =	{ -0.5f, -0.5f, 0.0f };
-			QuadVertices[1].Pos =	{ 0.5f, -0.5f, 0.0f };
-			QuadVertices[2].Pos =	{ 0.5f,  0.5f, 0.0f };
-			QuadVertices[3].Pos =	{ -0.5f,  0.5f, 0.0f };
-
-			QuadVertices[0].TexCoord =	{ 0.0f, 0.0f };
-			QuadVertices[1].TexCoord =	{ 1.0f, 0.0f };
-			QuadVertices[2].TexCoord =	{ 1.0f, 1.0f };
-			QuadVertices[3].TexCoord =	{ 0.0f, 1.0f };
-
-			QuadVertices[0].Normal = QuadVertices[1].Normal = QuadVertices[2].Normal = QuadVertices[3].Normal = { 0.0f,  0.0f, 1.0f };
-			CalculateTangents();
+			vertices[0].Pos =	{ -0.5f, -0.5f, 0.0f };
+			vertices[1].Pos =	{ 0.5f, -0.5f, 0.0f };
+			vertices[2].Pos =	{ 0.5f,  0.5f, 0.0f };
+			vertices[3].Pos =	{ -0.5f,  0.5f, 0.0f };
+
+			vertices[0].TexCoord =	{ 0.0f, 0.0f };
+			vertices[1].TexCoord =	{ 1.0f, 0.0f };
+			vertices[2].TexCoord =	{ 1.0f, 1.0f };
+			vertices[3].TexCoord =	{ 0.0f, 1.0f };
+
+			vertices[0].Normal = vertices[1].Normal = vertices[2].Normal = vertices[3].Normal = { 0.0f,  0.0f, 1.0f };
+			CalculateTangents(vertices);
 		}
 
+		void SetupVertices() { SetupVertices(QuadVertices); }
+
 		void UpdateVertices()
 		{
 			// Get Mat
@@ -252,61 +311,57 @@ namespace Kaimos {
 				return;
 
 			SetupVertices();
-			for (QuadVertex& vertex : QuadVertices)
-			{
-				material->UpdateVertexParameter(MaterialEditor::VertexParameterNodeType::POSITION, glm::vec4(vertex.Pos, 0.0f));
-				material->UpdateVertexParameter(MaterialEditor::VertexParameterNodeType::NORMAL, glm::vec4(vertex.Normal, 0.0f));
-				material->UpdateVertexParameter(MaterialEditor::VertexParameterNodeType::TEX_COORDS, glm::vec4(vertex.TexCoord, 0.0f, 0.0f));
-
-				vertex.Pos = material->GetVertexAttributeResult<glm::vec3>(MaterialEditor::VertexParameterNodeType::POSITION);
-				vertex.Normal = material->GetVertexAttributeResult<glm::vec3>(MaterialEditor::VertexParameterNodeType::NORMAL);
-				vertex.TexCoord = material->GetVertexAttributeResult<glm::vec2>(MaterialEditor::VertexParameterNodeType::TEX_COORDS);
+			const MaterialEditor::MaterialGraphProgram& program = material->GetVertexAttributesProgram();
+			program.EvaluateVertices(program.EvaluateUniforms(), QuadVertices, 4, true, true, true);
+			OnVerticesEvaluated(*material);
+			//CalculateTangents();
+		}
 
-				PositionTimed = material->IsVertexAttributeTimed(MaterialEditor::VertexParameterNodeType::POSITION);
-				NormalsTimed = material->IsVertexAttributeTimed(MaterialEditor::VertexParameterNodeType::NORMAL);
-				TexCoordsTimed = material->IsVertexAttributeTimed(MaterialEditor::VertexParameterNodeType::TEX_COORDS);
-			}
+		// Sets vertices already evaluated by the material, like the ones shared by all the sprites with it
+		void SetEvaluatedVertices(const QuadVertex* evaluated_vertices, const Material& material)
+		{
+			std::copy(evaluated_vertices, evaluated_vertices + 4, QuadVertices);
+			OnVerticesEvaluated(material);
+		}
 
-			//CalculateTangents();
+		void OnVerticesEvaluated(const Material& material)
+		{
+			PositionTimed = material.IsVertexAttributeTimed(MaterialEditor::VertexParameterNodeType::POSITION);
+			NormalsTimed = material.IsVertexAttributeTimed(MaterialEditor::VertexParameterNodeType::NORMAL);
+			TexCoordsTimed = material.IsVertexAttributeTimed(MaterialEditor::VertexParameterNodeType::TEX_COORDS);
+			TimedVerticesClock = 0.0f;
+			++VerticesEvaluations::Count;
 		}
 
-		void UpdateTimedVertices()
+
+		// --- Timed Vertices Functions ---
+		// Timed vertices are evaluated by the Job System into TimedQuadVertices (the back buffer) while the
+		// QuadVertices are rendered, and swapped after the jobs are done
+		bool TickTimedVertices(float dt_ms)
 		{
 			if (!PositionTimed && !NormalsTimed && !TexCoordsTimed)
-				return;
+				return false;
 
-			// Get Mesh & Mat
-			Ref<Material> material = Renderer::GetMaterial(SpriteMaterialID);
-			if (!material)
-				return;
+			TimedVerticesClock += dt_ms;
+			if (TimedVerticesClock <= s_TimedVerticesInterval)
+				return false;
 
-			SetupVertices();
-			for (QuadVertex& vertex : QuadVertices)
-			{
-				if (PositionTimed)
-				{
-					material->UpdateVertexParameter(MaterialEditor::VertexParameterNodeType::POSITION, glm::vec4(vertex.Pos, 0.0f));
-					vertex.Pos = material->GetVertexAttributeResult<glm::vec3>(MaterialEditor::VertexParameterNodeType::POSITION);
-				}
-
-				if (NormalsTimed)
-				{
-					material->UpdateVertexParameter(MaterialEditor::VertexParameterNodeType::NORMAL, glm::vec4(vertex.Normal, 0.0f));
-					vertex.Normal = material->GetVertexAttributeResult<glm::vec3>(MaterialEditor::VertexParameterNodeType::NORMAL);
-				}
-
-				if (TexCoordsTimed)
-				{
-					material->UpdateVertexParameter(MaterialEditor::VertexParameterNodeType::TEX_COORDS, glm::vec4(vertex.TexCoord, 0.0f, 0.0f));
-					vertex.TexCoord = material->GetVertexAttributeResult<glm::vec2>(MaterialEditor::VertexParameterNodeType::TEX_COORDS);
-				}
-			}
+			TimedVerticesClock = 0.0f;
+			return true;
+		}
 
-			//if (PositionTimed || TexCoordsTimed)
-			//	CalculateTangents();
+		// Thread-safe as long as nothing else touches this component back buffer (the program and uniforms are only read)
+		void EvaluateTimedVertices(const MaterialEditor::MaterialGraphProgram& program, const std::vector<glm::vec4>& uniforms)
+		{
+			SetupVertices(TimedQuadVertices);
+			program.EvaluateVertices(uniforms, TimedQuadVertices, 4, true, true, true);
 		}
-	};
 
+		void SwapTimedVertices()
+		{
+			std::swap(QuadVertices, TimedQuadVertices);
+		}
+	};
 
 
 	// ---- MESH COMPONENT -----------------------------------------
@@ -314,13 +369,36 @@ namespace Kaimos {
 	{
 		// --- Variables ---
 		uint MaterialID = 0, MeshID = 0;
-		std::vector<Vertex> ModifiedVertices;
 		bool PositionTimed = false, NormalsTimed = false, TexCoordsTimed = false;
+		bool PositionModified = false;		// Mesh bounding volumes aren't valid for culling if the material moves the vertices
+
+		// Shared with the components with the same mesh & material (from the VerticesCache), unless the component owns
+		// them, which happens when they diverge from the shared ones (timed vertices), copy-on-write
+		Ref<std::vector<Vertex>> ModifiedVertices = nullptr;
+		bool OwnsVertices = false;
+
+		std::vector<Vertex> TimedVerticesBuffer;
+		float TimedVerticesClock = 0.0f;
+		static constexpr float s_TimedVerticesInterval = 30.0f;		// In ms
+
+		// Changes each time ModifiedVertices do (from a global counter, so newer vertices have higher versions)
+		uint VerticesVersion = 0;
+		inline static uint s_VerticesVersionCounter = 0;
 
 
 		// --- Constructors ---
 		MeshRendererComponent() = default;
-		MeshRendererComponent(const MeshRendererComponent&) = default;
+		MeshRendererComponent(MeshRendererComponent&&) = default;
+		MeshRendererComponent& operator=(const MeshRendererComponent&) = default;
+		MeshRendererComponent& operator=(MeshRendererComponent&&) = default;
+
+		// Copies share the vertices and don't copy the timed vertices back buffer (it's sized again when needed)
+		MeshRendererComponent(const MeshRendererComponent& other)
+			: MaterialID(other.MaterialID), MeshID(other.MeshID), PositionTimed(other.PositionTimed), NormalsTimed(other.NormalsTimed),
+			TexCoordsTimed(other.TexCoordsTimed), PositionModified(other.PositionModified), ModifiedVertices(other.ModifiedVertices),
+			OwnsVertices(other.OwnsVertices), TimedVerticesClock(other.TimedVerticesClock), VerticesVersion(other.VerticesVersion)
+		{
+		}
 
 
 		// --- Material Functions ---
@@ -353,12 +431,17 @@ namespace Kaimos {
 		void RemoveMesh()
 		{
 			MeshID = 0;
-			ModifiedVertices.clear();
-			PositionTimed = NormalsTimed = TexCoordsTimed = false;
+			ModifiedVertices = nullptr;
+			OwnsVertices = false;
+			TimedVerticesBuffer.clear();
+			PositionTimed = NormalsTimed = TexCoordsTimed = PositionModified = false;
+			++VerticesEvaluations::Count;
 		}
 		
 
 		// --- Vertices Functions ---
+		const std::vector<Vertex>& GetModifiedVertices() const { return ModifiedVertices ? *ModifiedVertices : s_NoVertices; }
+
 		void UpdateModifiedVertices()
 		{
 			// Get Mesh & Mat
@@ -367,69 +450,77 @@ namespace Kaimos {
 
 			if (!material || !mesh)
 			{
-				ModifiedVertices.clear();
+				ModifiedVertices = nullptr;
+				OwnsVertices = false;
+				++VerticesEvaluations::Count;
 				return;
 			}
 
-			ModifiedVertices = mesh->GetVertices();
-			for (Vertex& vertex : ModifiedVertices)
-			{
-				material->UpdateVertexParameter(MaterialEditor::VertexParameterNodeType::POSITION, glm::vec4(vertex.Pos, 0.0f));
-				material->UpdateVertexParameter(MaterialEditor::VertexParameterNodeType::NORMAL, glm::vec4(vertex.Normal, 0.0f));
-				material->UpdateVertexParameter(MaterialEditor::VertexParameterNodeType::TEX_COORDS, glm::vec4(vertex.TexCoord, 0.0f, 0.0f));
-
-				vertex.Pos = material->GetVertexAttributeResult<glm::vec3>(MaterialEditor::VertexParameterNodeType::POSITION);
-				vertex.Normal = material->GetVertexAttributeResult<glm::vec3>(MaterialEditor::VertexParameterNodeType::NORMAL);
-				vertex.TexCoord = material->GetVertexAttributeResult<glm::vec2>(MaterialEditor::VertexParameterNodeType::TEX_COORDS);
+			SetEvaluatedVertices(VerticesCache::GetVertices(mesh, material), *material);
+			//CalculateTangents(mesh);
+		}
 
-				PositionTimed = material->IsVertexAttributeTimed(MaterialEditor::VertexParameterNodeType::POSITION);
-				NormalsTimed = material->IsVertexAttributeTimed(MaterialEditor::VertexParameterNodeType::NORMAL);
-				TexCoordsTimed = material->IsVertexAttributeTimed(MaterialEditor::VertexParameterNodeType::TEX_COORDS);
-			}
+		// Sets (shared) mesh vertices already evaluated by the material
+		void SetEvaluatedVertices(const Ref<std::vector<Vertex>>& evaluated_vertices, const Material& material)
+		{
+			ModifiedVertices = evaluated_vertices;
+			OwnsVertices = false;
+			OnVerticesEvaluated(material);
+		}
 
-			//CalculateTangents(mesh);
+		// Not thread-safe, as it reads the material graph and takes a new vertices version
+		void OnVerticesEvaluated(const Material& material)
+		{
+			PositionTimed = material.IsVertexAttributeTimed(MaterialEditor::VertexParameterNodeType::POSITION);
+			NormalsTimed = material.IsVertexAttributeTimed(MaterialEditor::VertexParameterNodeType::NORMAL);
+			TexCoordsTimed = material.IsVertexAttributeTimed(MaterialEditor::VertexParameterNodeType::TEX_COORDS);
+			PositionModified = material.GetVertexAttributesProgram().ModifiesPositions();
+
+			TimedVerticesClock = 0.0f;
+			VerticesVersion = ++s_VerticesVersionCounter;
+			++VerticesEvaluations::Count;
 		}
 
-		void UpdateTimedVertices()
+
+		// --- Timed Vertices Functions ---
+		// Timed vertices are evaluated by the Job System into TimedVerticesBuffer (the back buffer), in vertex
+		// ranges, while the ModifiedVertices are rendered, and swapped after all the jobs are done
+		bool TickTimedVertices(float dt_ms)
 		{
 			if (!PositionTimed && !NormalsTimed && !TexCoordsTimed)
-				return;
+				return false;
 
-			// Get Mesh & Mat
-			Ref<Material> material = Renderer::GetMaterial(MaterialID);
-			Ref<Mesh> mesh = Resources::ResourceManager::GetMesh(MeshID);
+			TimedVerticesClock += dt_ms;
+			if (TimedVerticesClock <= s_TimedVerticesInterval)
+				return false;
 
-			if (!material || !mesh)
-			{
-				ModifiedVertices.clear();
-				return;
-			}
+			TimedVerticesClock = 0.0f;
+			return true;
+		}
+
+		// Thread-safe for non-overlapping ranges, the back buffer must be already sized as the mesh vertices
+		void EvaluateTimedVertices(const std::vector<Vertex>& mesh_vertices, const MaterialEditor::MaterialGraphProgram& program, const std::vector<glm::vec4>& uniforms, size_t first, size_t count)
+		{
+			std::copy(mesh_vertices.begin() + first, mesh_vertices.begin() + first + count, TimedVerticesBuffer.begin() + first);
+			program.EvaluateVertices(uniforms, TimedVerticesBuffer.data() + first, count, true, true, true);
+		}
 
-			ModifiedVertices = mesh->GetVertices();
-			for (Vertex& vertex : ModifiedVertices)
+		// Timed vertices diverge from the shared ones, so the component gets its own vertices before swapping them
+		void SwapTimedVertices()
+		{
+			if (!OwnsVertices || ModifiedVertices.use_count() > 1)
 			{
-				if (PositionTimed)
-				{
-					material->UpdateVertexParameter(MaterialEditor::VertexParameterNodeType::POSITION, glm::vec4(vertex.Pos, 0.0f));
-					vertex.Pos = material->GetVertexAttributeResult<glm::vec3>(MaterialEditor::VertexParameterNodeType::POSITION);
-				}
-
-				if (NormalsTimed)
-				{
-					material->UpdateVertexParameter(MaterialEditor::VertexParameterNodeType::NORMAL, glm::vec4(vertex.Normal, 0.0f));
-					vertex.Normal = material->GetVertexAttributeResult<glm::vec3>(MaterialEditor::VertexParameterNodeType::NORMAL);
-				}
-
-				if (TexCoordsTimed)
-				{
-					material->UpdateVertexParameter(MaterialEditor::VertexParameterNodeType::TEX_COORDS, glm::vec4(vertex.TexCoord, 0.0f, 0.0f));
-					vertex.TexCoord = material->GetVertexAttributeResult<glm::vec2>(MaterialEditor::VertexParameterNodeType::TEX_COORDS);
-				}
+				ModifiedVertices = CreateRef<std::vector<Vertex>>();
+				OwnsVertices = true;
 			}
 
-			//if (PositionTimed || TexCoordsTimed)
-			//	CalculateTangents(mesh);
+			ModifiedVertices->swap(TimedVerticesBuffer);
+			VerticesVersion = ++s_VerticesVersionCounter;
 		}
+
+	private:
+
+		inline static const std::vector<Vertex> s_NoVertices = {};
 	};
 }
 
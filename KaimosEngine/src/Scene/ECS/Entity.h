@@ -20,6 +20,7 @@ namespace Kaimos {
 
 		// --- Getters/Setters ---
 		inline uint GetID()								const	{ return (uint)m_EntityID; }
+		inline bool IsValid()							const	{ return m_Scene && m_Scene->m_Registry.valid(m_EntityID); }	// Not destroyed (operator bool only checks it's not null)
 
 
 	// -- (Exception) vars here for readability, many templated long functions below --
@@ -1,6 +1,8 @@
 #include "kspch.h"
 #include "KaimosYAMLExtension.h"
 
+#include <yaml-cpp/eventhandler.h>
+
 
 // ---------------------------------------------------------------------------------------------------
 // ----------------------- YAML Additions Static Methods ---------------------------------------------
@@ -101,4 +103,134 @@ namespace Kaimos {
 		output << YAML::BeginSeq << vec.x << vec.y << vec.z << vec.w << YAML::EndSeq;
 		return output;
 	}
+
+
+
+	// ----------------------- YAML Streaming Methods ----------------------------------------------------
+	// Builds the nodes from the parser events, except for the items of the streamed sequence, which are passed to the
+	// callback when they end instead of being added to it
+	class StreamedYAMLBuilder : public YAML::EventHandler
+	{
+	public:
+
+		StreamedYAMLBuilder(const std::string& sequence_key, const std::function<void(const YAML::Node&, const YAML::Node&)>& on_item)
+			: m_SequenceKey(sequence_key), m_OnItem(on_item) {}
+
+		const YAML::Node& GetRoot() const { return m_Root; }
+
+		// --- Parser Events ---
+		virtual void OnDocumentStart(const YAML::Mark& mark) override {}
+		virtual void OnDocumentEnd() override {}
+
+		virtual void OnNull(const YAML::Mark& mark, YAML::anchor_t anchor) override									{ AddNode(YAML::Node(YAML::NodeType::Null)); }
+		virtual void OnAlias(const YAML::Mark& mark, YAML::anchor_t anchor) override								{ AddNode(YAML::Node(YAML::NodeType::Null)); }	// Kaimos files have no aliases
+		virtual void OnScalar(const YAML::Mark& mark, const std::string& tag, YAML::anchor_t anchor, const std::string& value) override	{ AddNode(YAML::Node(value)); }
+
+		virtual void OnSequenceStart(const YAML::Mark& mark, const std::string& tag, YAML::anchor_t anchor, YAML::EmitterStyle::value style) override
+		{
+			m_Stack.push_back({ YAML::Node(YAML::NodeType::Sequence) });
+		}
+
+		virtual void OnMapStart(const YAML::Mark& mark, const std::string& tag, YAML::anchor_t anchor, YAML::EmitterStyle::value style) override
+		{
+			m_Stack.push_back({ YAML::Node(YAML::NodeType::Map) });
+		}
+
+		virtual void OnSequenceEnd() override	{ EndNode(); }
+		virtual void OnMapEnd() override		{ EndNode(); }
+
+	private:
+
+		struct NodeFrame
+		{
+			YAML::Node Node;
+			std::string Key = "";
+			bool HasKey = false;
+		};
+
+		void EndNode()
+		{
+			YAML::Node node = m_Stack.back().Node;
+			m_Stack.pop_back();
+			AddNode(node);
+		}
+
+		void AddNode(const YAML::Node& node)
+		{
+			if (m_Stack.empty())
+			{
+				m_Root = node;
+				return;
+			}
+
+			NodeFrame& parent = m_Stack.back();
+			if (parent.Node.IsSequence())
+			{
+				// Items of the streamed sequence (the root map's one with the given key)
+				if (m_Stack.size() == 2 && m_Stack[0].HasKey && m_Stack[0].Key == m_SequenceKey)
+					m_OnItem(node, m_Stack[0].Node);
+				else
+					parent.Node.push_back(node);
+			}
+			else if (!parent.HasKey)
+			{
+				parent.Key = node.Scalar();
+				parent.HasKey = true;
+			}
+			else
+			{
+				parent.Node[parent.Key] = node;
+				parent.HasKey = false;
+			}
+		}
+
+	private:
+
+		const std::string& m_SequenceKey;
+		const std::function<void(const YAML::Node&, const YAML::Node&)>& m_OnItem;
+
+		std::vector<NodeFrame> m_Stack;
+		YAML::Node m_Root = YAML::Node(YAML::NodeType::Null);
+	};
+
+
+	YAML::Node LoadYAMLFileStreamed(const std::string& filepath, const std::string& sequence_key, const std::function<void(const YAML::Node& item, const YAML::Node& root)>& on_item)
+	{
+		KS_PROFILE_FUNCTION();
+		std::ifstream file(filepath);
+		if (!file.good())
+			return YAML::Node(YAML::NodeType::Null);
+
+		// The parser reads the file as it goes, so the first items are handled before it's fully read
+		YAML::Parser parser(file);
+		StreamedYAMLBuilder builder(sequence_key, on_item);
+		parser.HandleNextDocument(builder);
+		return builder.GetRoot();
+	}
+
+
+	std::string GetYAMLTempFilepath(const std::string& filepath)
+	{
+		return filepath + ".tmp";
+	}
+
+
+	bool CommitYAMLFile(std::ofstream& temp_file, const std::string& filepath, bool written)
+	{
+		written = written && temp_file.good();
+		temp_file.close();
+
+		std::error_code error;
+		const std::string temp_filepath = GetYAMLTempFilepath(filepath);
+		if (written)
+			std::filesystem::rename(temp_filepath, filepath, error);
+
+		if (!written || error)
+		{
+			std::filesystem::remove(temp_filepath, error);
+			return false;
+		}
+
+		return true;
+	}
 }
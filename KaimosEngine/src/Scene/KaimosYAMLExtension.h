@@ -2,6 +2,8 @@
 #define _KAIMOSYAMLEXT_
 
 #include <yaml-cpp/yaml.h>
+#include <functional>
+#include <fstream>
 
 // ---------------------------------------------------------------------------------------------------
 // ----------------------- YAML Additions Static Methods ---------------------------------------------
@@ -38,6 +40,19 @@ namespace Kaimos {
 	YAML::Emitter& operator<<(YAML::Emitter& output, const glm::vec2& vec);
 	YAML::Emitter& operator<<(YAML::Emitter& output, const glm::vec3& vec);
 	YAML::Emitter& operator<<(YAML::Emitter& output, const glm::vec4& vec);
+
+
+	// ----------------------- YAML Streaming Methods ----------------------------------------------------
+	// Loads a YAML file parsing it as a stream of events instead of as a whole document: each item of the "sequence_key"
+	// sequence (of the root map) is passed to on_item as soon as it's parsed, with the root map parsed until then, and dropped,
+	// so the whole document is never built (whatever on_item keeps of the items is up to the caller). Returns the root map without those items (null if the file couldn't be
+	// opened) and throws like YAML::LoadFile()
+	YAML::Node LoadYAMLFileStreamed(const std::string& filepath, const std::string& sequence_key, const std::function<void(const YAML::Node& item, const YAML::Node& root)>& on_item);
+
+	// Emitters stream into "filepath.tmp" (GetYAMLTempFilepath()), which then replaces the file only if everything was written,
+	// so a failed save never truncates the previous file. Closes the file and returns false (removing the temporary) on failure
+	std::string GetYAMLTempFilepath(const std::string& filepath);
+	bool CommitYAMLFile(std::ofstream& temp_file, const std::string& filepath, bool written);
 }
 
 #endif _KAIMOSYAMLEXT_
@@ -6,6 +6,7 @@
 #include "Renderer/Renderer.h"
 #include "Renderer/Renderer2D.h"
 #include "Renderer/Renderer3D.h"
+#include "Renderer/RenderQueue.h"
 #include "Renderer/Resources/Mesh.h"
 #include "Renderer/Resources/Light.h"
 
@@ -13,6 +14,8 @@
 #include "Core/Resources/Resource.h"
 #include "Core/Resources/ResourceModel.h"
 #include "Core/Utils/Maths/RandomGenerator.h"
+#include "Core/Utils/Maths/BoundingVolumes.h"
+#include "Core/Utils/Jobs/JobSystem.h"
 
 #include <glm/glm.hpp>
 
@@ -39,16 +42,59 @@ namespace Kaimos {
 	static CameraController s_EditorCamera;
 	static Ref<Scene> s_CurrentScene = nullptr;
 	static bool s_RenderingEditor = true;
+	static const uint s_EditorViewID = (uint)entt::null;		// View of the editor camera (not an entity), for its lights clusters & retained batches
+
+	// Timed vertices being evaluated by the Job System during the frame
+	struct TimedVerticesTask
+	{
+		MeshRendererComponent* MeshComponent = nullptr;
+		SpriteRendererComponent* SpriteComponent = nullptr;
+		Ref<Mesh> TaskMesh = nullptr;
+		Ref<Material> TaskMaterial = nullptr;
+		const MaterialEditor::MaterialGraphProgram* Program = nullptr;
+		std::vector<glm::vec4> Uniforms;
+	};
+
+	static std::vector<TimedVerticesTask> s_TimedMeshesTasks;
+	static std::vector<TimedVerticesTask> s_TimedSpritesTasks;
+	static constexpr uint s_TimedVerticesPerJob = 4096, s_TimedSpritesPerJob = 64;
+	static constexpr uint s_TransformsPerJob = 1024;
+
+	// Entities whose transform changed in the last transforms update (and a flag per transform for the parallel update)
+	static std::vector<entt::entity> s_MovedEntities;
+	static std::vector<uint8_t> s_TransformsMoved;
+
+	// Draws of the frame, pushed to the render queues as (sort key, draw index) packets and drawn in the order of the sorted queues
+	struct MeshDraw
+	{
+		entt::entity Entity = entt::null;
+		MeshRendererComponent* MeshComponent = nullptr;
+		const SceneBVH::EntityProxy* Proxy = nullptr;
+	};
+
+	struct SpriteDraw
+	{
+		entt::entity Entity = entt::null;
+		SpriteRendererComponent* SpriteComponent = nullptr;
+		const glm::mat4* Transform = nullptr;
+	};
+
+	static std::vector<MeshDraw> s_MeshDraws;
+	static std::vector<SpriteDraw> s_SpriteDraws;
+	static RenderQueue s_MeshesQueue, s_SpritesQueue;
+
 
 	// ----------------------- Public Class Methods -------------------------------------------------------
 	Scene::Scene()
 	{
+		m_BVH.Connect(m_Registry);
 		s_PrimaryCamera = {};
 		Renderer::SetSceneColor(glm::vec3(1.0f));
 	}
 
 	Scene::Scene(const std::string& name, bool pbr_pipeline) : m_Name(name)
 	{
+		m_BVH.Connect(m_Registry);
 		s_PrimaryCamera = {};
 		Renderer::SetSceneColor(glm::vec3(1.0f));
 		Renderer::SetPBRPipeline(pbr_pipeline);
@@ -94,59 +140,226 @@ namespace Kaimos {
 		return point_lights;
 	}
 
+	void Scene::ClusterLights(uint view_id, const glm::mat4& view, const glm::mat4& projection)
+	{
+		KS_PROFILE_FUNCTION();
+		Renderer::ClusterLights(view_id, view, projection, GetScenePointLights());
+	}
+
 
 	// ----------------------- Private Scene Rendering Methods --------------------------------------------
 	bool Scene::BeginScene(const Camera& camera, const glm::vec3& camera_pos, bool scene3D)
 	{
 		std::vector<std::pair<Ref<Light>, glm::vec3>> dir_lights = GetSceneDirLights();
-		std::vector<std::pair<Ref<PointLight>, glm::vec3>> plights = GetScenePointLights();
 
-		if (Renderer::BeginScene(camera.GetViewProjection(), camera_pos, dir_lights, plights))
+		if (Renderer::BeginScene(camera.GetView(), camera.GetProjection(), camera_pos, dir_lights, scene3D && Renderer3D::IsInstancedRendering()))
 		{
-			scene3D ? Renderer3D::BeginScene() : Renderer2D::BeginScene();
+			scene3D ? Renderer3D::BeginScene(s_EditorViewID) : Renderer2D::BeginScene();
 			return true;
 		}
 
 		return false;
 	}
 
-	bool Scene::BeginScene(const CameraComponent& camera_component, const TransformComponent& transform_component, bool scene3D)
+	bool Scene::BeginScene(uint camera_id, const CameraComponent& camera_component, const TransformComponent& transform_component, bool scene3D)
 	{
 		std::vector<std::pair<Ref<Light>, glm::vec3>> dir_lights = GetSceneDirLights();
-		std::vector<std::pair<Ref<PointLight>, glm::vec3>> plights = GetScenePointLights();
 
-		glm::mat4 view_proj = camera_component.Camera.GetProjection() * glm::inverse(transform_component.GetTransform());
-		if (Renderer::BeginScene(view_proj, transform_component.Translation, dir_lights, plights))
+		glm::mat4 view = glm::inverse(transform_component.GetTransform());
+		if (Renderer::BeginScene(view, camera_component.Camera.GetProjection(), transform_component.Translation, dir_lights, scene3D && Renderer3D::IsInstancedRendering()))
 		{
-			scene3D ? Renderer3D::BeginScene() : Renderer2D::BeginScene();
+			scene3D ? Renderer3D::BeginScene(camera_id) : Renderer2D::BeginScene();
 			return true;
 		}
 
 		return false;
 	}
 
-	void Scene::RenderSprites(Timestep dt)
+	void Scene::BuildRenderQueues(const glm::mat4& view_projection, const glm::vec3& camera_pos)
 	{
 		KS_PROFILE_FUNCTION();
+
+		// -- Gather the Meshes in the Frustum (BVH query + tight test of their local AABB) --
+		s_MeshDraws.clear();
+		m_BVH.QueryMeshes(Maths::Frustum(view_projection), [&](entt::entity ent, const SceneBVH::EntityProxy& proxy)
+			{
+				s_MeshDraws.push_back({ ent, &m_Registry.get<MeshRendererComponent>(ent), &proxy });
+			});
+
+		// -- Gather the Active Sprites --
+		s_SpriteDraws.clear();
 		auto sprite_group = m_Registry.group<SpriteRendererComponent>(entt::get<TransformComponent>);
 		for (auto ent : sprite_group)
 		{
 			auto& [sprite, transform] = sprite_group.get<SpriteRendererComponent, TransformComponent>(ent);
 			if (transform.EntityActive)
-				Renderer2D::DrawSprite(dt, transform.GetTransform(), sprite, (int)ent);
+				s_SpriteDraws.push_back({ ent, &sprite, &transform.GetTransform() });
+		}
+
+		// -- Build the Queues (the keys only read the draws, so big queues are built in the Job System) --
+		// Meshes go front to back to save overdraw, but the retained static ones don't take depth: their order only has to be stable to keep their batches
+		s_MeshesQueue.Build((uint)s_MeshDraws.size(), [&camera_pos](uint index)
+			{
+				const MeshDraw& draw = s_MeshDraws[index];
+				uint64_t material_key = Renderer::GetMaterialSortKey(draw.MeshComponent->MaterialID);
+				if (Renderer3D::IsRetainedStaticDraw(*draw.MeshComponent, draw.Proxy->TransformVersion))
+					return RenderQueue::GetSortKey(0, material_key, 0.0f, true);
+
+				glm::vec3 camera_offset = glm::vec3(draw.Proxy->Transform[3]) - camera_pos;
+				return RenderQueue::GetSortKey(1, material_key, glm::dot(camera_offset, camera_offset), true);
+			});
+
+		// Sprites are alpha blended, so they go back to front
+		s_SpritesQueue.Build((uint)s_SpriteDraws.size(), [&camera_pos](uint index)
+			{
+				const SpriteDraw& draw = s_SpriteDraws[index];
+				glm::vec3 camera_offset = glm::vec3((*draw.Transform)[3]) - camera_pos;
+				return RenderQueue::GetSortKey(0, Renderer::GetMaterialSortKey(draw.SpriteComponent->SpriteMaterialID), glm::dot(camera_offset, camera_offset), false);
+			});
+
+		// -- Sort --
+		s_MeshesQueue.Sort();
+		s_SpritesQueue.Sort();
+	}
+
+	void Scene::RenderSprites(Timestep dt)
+	{
+		KS_PROFILE_FUNCTION();
+		for (const DrawPacket& packet : s_SpritesQueue.GetPackets())
+		{
+			const SpriteDraw& draw = s_SpriteDraws[packet.Index];
+			Renderer2D::DrawSprite(dt, *draw.Transform, *draw.SpriteComponent, (int)draw.Entity);
 		}
 	}
 
 	void Scene::RenderMeshes(Timestep dt)
 	{
 		KS_PROFILE_FUNCTION();
-		auto mesh_group = m_Registry.group<TransformComponent>(entt::get<MeshRendererComponent>);
-		for (auto ent : mesh_group)
+		for (const DrawPacket& packet : s_MeshesQueue.GetPackets())
 		{
-			auto& [transform, mesh] = mesh_group.get<TransformComponent, MeshRendererComponent>(ent);
-			if (transform.EntityActive)
-				Renderer3D::DrawMesh(dt, transform.GetTransform(), mesh, (int)ent);
+			const MeshDraw& draw = s_MeshDraws[packet.Index];
+			Renderer3D::DrawMesh(dt, draw.Proxy->Transform, *draw.MeshComponent, (int)draw.Entity, draw.Proxy->TransformVersion);
 		}
+
+		uint submitted_meshes = s_MeshesQueue.GetPacketsCount();
+		Renderer3D::AddCullingStats(submitted_meshes, m_BVH.GetMeshesCount() - submitted_meshes);
+	}
+
+
+
+	// ----------------------- Private Scene Transforms Methods -------------------------------------------
+	void Scene::UpdateTransforms()
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- Components are contiguous in their pool, so they are updated straight from it --
+		auto transforms_view = m_Registry.view<TransformComponent>();
+		TransformComponent* transforms = transforms_view.raw();
+		const entt::entity* entities = transforms_view.data();
+		uint transforms_count = (uint)transforms_view.size();
+		s_MovedEntities.clear();
+
+		if (transforms_count <= s_TransformsPerJob || JobSystem::GetWorkersCount() == 0)
+		{
+			for (uint i = 0; i < transforms_count; ++i)
+				if (transforms[i].UpdateTransform())
+					s_MovedEntities.push_back(entities[i]);
+
+			return;
+		}
+
+		// -- Big Scenes: Update in Parallel, then Gather the Moved Ones --
+		s_TransformsMoved.resize(transforms_count);
+		uint8_t* moved = s_TransformsMoved.data();
+		JobSystem::Dispatch(transforms_count, s_TransformsPerJob, [transforms, moved](uint index) { moved[index] = transforms[index].UpdateTransform(); });
+		JobSystem::Wait();
+
+		for (uint i = 0; i < transforms_count; ++i)
+			if (moved[i])
+				s_MovedEntities.push_back(entities[i]);
+	}
+
+
+
+	// ----------------------- Private Scene Timed Vertices Methods ---------------------------------------
+	void Scene::BeginTimedVerticesUpdate(Timestep dt)
+	{
+		KS_PROFILE_FUNCTION();
+		float dt_ms = dt.GetMilliseconds();
+
+		// -- Gather Timed Meshes (programs are compiled & uniforms evaluated here, as they touch the graphs) --
+		auto mesh_view = m_Registry.view<TransformComponent, MeshRendererComponent>();
+		for (auto ent : mesh_view)
+		{
+			auto& [transform, mesh_comp] = mesh_view.get<TransformComponent, MeshRendererComponent>(ent);
+			if (!transform.EntityActive || !mesh_comp.TickTimedVertices(dt_ms))
+				continue;
+
+			Ref<Material> material = Renderer::GetMaterial(mesh_comp.MaterialID);
+			Ref<Mesh> mesh = Resources::ResourceManager::GetMesh(mesh_comp.MeshID);
+			if (!material || !mesh || mesh->GetVertices().empty())
+				continue;
+
+			TimedVerticesTask task = { &mesh_comp, nullptr, mesh, material, &material->GetVertexAttributesProgram() };
+			task.Uniforms = task.Program->EvaluateUniforms();
+			mesh_comp.TimedVerticesBuffer.resize(mesh->GetVertices().size());
+			s_TimedMeshesTasks.push_back(std::move(task));
+		}
+
+		// -- Gather Timed Sprites --
+		auto sprite_view = m_Registry.view<TransformComponent, SpriteRendererComponent>();
+		for (auto ent : sprite_view)
+		{
+			auto& [transform, sprite_comp] = sprite_view.get<TransformComponent, SpriteRendererComponent>(ent);
+			if (!transform.EntityActive || !sprite_comp.TickTimedVertices(dt_ms))
+				continue;
+
+			Ref<Material> material = Renderer::GetMaterial(sprite_comp.SpriteMaterialID);
+			if (!material)
+				continue;
+
+			TimedVerticesTask task = { nullptr, &sprite_comp, nullptr, material, &material->GetVertexAttributesProgram() };
+			task.Uniforms = task.Program->EvaluateUniforms();
+			s_TimedSpritesTasks.push_back(std::move(task));
+		}
+
+		// -- Dispatch Meshes in Vertex Ranges & Sprites in Groups --
+		for (const TimedVerticesTask& task : s_TimedMeshesTasks)
+		{
+			size_t vertices_count = task.TaskMesh->GetVertices().size();
+			for (size_t first = 0; first < vertices_count; first += s_TimedVerticesPerJob)
+			{
+				size_t count = std::min(vertices_count - first, (size_t)s_TimedVerticesPerJob);
+				JobSystem::Execute([&task, first, count]()
+					{
+						task.MeshComponent->EvaluateTimedVertices(task.TaskMesh->GetVertices(), *task.Program, task.Uniforms, first, count);
+					});
+			}
+		}
+
+		JobSystem::Dispatch((uint)s_TimedSpritesTasks.size(), s_TimedSpritesPerJob, [](uint index)
+			{
+				const TimedVerticesTask& task = s_TimedSpritesTasks[index];
+				task.SpriteComponent->EvaluateTimedVertices(*task.Program, task.Uniforms);
+			});
+	}
+
+	void Scene::EndTimedVerticesUpdate()
+	{
+		KS_PROFILE_FUNCTION();
+		if (s_TimedMeshesTasks.empty() && s_TimedSpritesTasks.empty())
+			return;
+
+		JobSystem::Wait();
+
+		for (TimedVerticesTask& task : s_TimedMeshesTasks)
+			task.MeshComponent->SwapTimedVertices();
+
+		for (TimedVerticesTask& task : s_TimedSpritesTasks)
+			task.SpriteComponent->SwapTimedVertices();
+
+		s_TimedMeshesTasks.clear();
+		s_TimedSpritesTasks.clear();
 	}
 
 
@@ -156,15 +369,23 @@ namespace Kaimos {
 	{
 		KS_PROFILE_FUNCTION();
 		s_RenderingEditor = true;
+		UpdateTransforms();
+		m_BVH.Update(m_Registry, s_MovedEntities);
+
+		// -- Sort the Draws, Cluster the Lights & Evaluate Timed Vertices while Rendering --
+		// Lights clustering waits for its jobs, so it goes before dispatching the timed vertices ones
+		BuildRenderQueues(s_EditorCamera.GetCamera().GetViewProjection(), s_EditorCamera.GetPosition());
+		ClusterLights(s_EditorViewID, s_EditorCamera.GetCamera().GetView(), s_EditorCamera.GetCamera().GetProjection());
+		BeginTimedVerticesUpdate(dt);
 
 		// -- Render Meshes --
 		m_RenderingTime.Start();
 		if (!BeginScene(s_EditorCamera.GetCamera(), s_EditorCamera.GetPosition(), true))
 		{
+			EndTimedVerticesUpdate();
 			m_RenderingTime.Stop();
 			return;
 		}
-		
 
 		RenderMeshes(dt);
 		Renderer3D::EndScene();
@@ -175,6 +396,7 @@ namespace Kaimos {
 		Renderer2D::EndScene();
 
 		Renderer::EndScene(s_EditorCamera.GetCamera().GetView(), s_EditorCamera.GetCamera().GetProjection());
+		EndTimedVerticesUpdate();
 		m_RenderingTime.Stop();
 	}
 
@@ -204,18 +426,27 @@ namespace Kaimos {
 			CameraComponent& camera_comp = s_PrimaryCamera.GetComponent<CameraComponent>();
 			TransformComponent& trans_comp = s_PrimaryCamera.GetComponent<TransformComponent>();
 
-			if (!BeginScene(camera_comp, trans_comp, true))
+			UpdateTransforms();
+			m_BVH.Update(m_Registry, s_MovedEntities);
+			BuildRenderQueues(camera_comp.Camera.GetProjection() * glm::inverse(trans_comp.GetTransform()), trans_comp.Translation);
+			ClusterLights(s_PrimaryCamera.GetID(), glm::inverse(trans_comp.GetTransform()), camera_comp.Camera.GetProjection());
+			BeginTimedVerticesUpdate(dt);
+			if (!BeginScene(s_PrimaryCamera.GetID(), camera_comp, trans_comp, true))
+			{
+				EndTimedVerticesUpdate();
 				return;
+			}
 
 			RenderMeshes(dt);
 			Renderer3D::EndScene();
 
-			BeginScene(camera_comp, trans_comp, false);
+			BeginScene(s_PrimaryCamera.GetID(), camera_comp, trans_comp, false);
 			RenderSprites(dt);
 			Renderer2D::EndScene();
 			primary_camera_warn = false;
 
 			Renderer::EndScene(glm::inverse(trans_comp.GetTransform()), camera_comp.Camera.GetProjection());
+			EndTimedVerticesUpdate();
 		}
 		else if(!primary_camera_warn)
 		{
@@ -236,13 +467,15 @@ namespace Kaimos {
 			CameraComponent& camera_comp = s_PrimaryCamera.GetComponent<CameraComponent>();
 			TransformComponent& trans_comp = s_PrimaryCamera.GetComponent<TransformComponent>();
 			
-			if (!BeginScene(camera_comp, trans_comp, true))
+			BuildRenderQueues(camera_comp.Camera.GetProjection() * glm::inverse(trans_comp.GetTransform()), trans_comp.Translation);
+			ClusterLights(s_PrimaryCamera.GetID(), glm::inverse(trans_comp.GetTransform()), camera_comp.Camera.GetProjection());
+			if (!BeginScene(s_PrimaryCamera.GetID(), camera_comp, trans_comp, true))
 				return;
 
 			RenderMeshes(dt);
 			Renderer3D::EndScene();
 
-			BeginScene(camera_comp, trans_comp, false);
+			BeginScene(s_PrimaryCamera.GetID(), camera_comp, trans_comp, false);
 			RenderSprites(dt);
 			Renderer2D::EndScene();
 
@@ -359,6 +592,10 @@ namespace Kaimos {
 	{
 		KS_PROFILE_FUNCTION();
 
+		// New graph version, so meshes get vertices evaluated with the current graph values instead of the cached ones
+		if (Ref<Material> material = Renderer::GetMaterial(material_id))
+			material->UpdateGraphVersion();
+
 		auto mesh_group = m_Registry.group<TransformComponent>(entt::get<MeshRendererComponent>);
 		for (auto ent : mesh_group)
 		{
@@ -378,6 +615,14 @@ namespace Kaimos {
 
 
 
+	Entity Scene::RaycastEntity(const Maths::Ray& ray)
+	{
+		entt::entity hit_entity = m_BVH.RayCast(ray, m_Registry);
+		return hit_entity == entt::null ? Entity() : Entity(hit_entity, this);
+	}
+
+
+
 	// ----------------------- Getters/Setters -----------------------------------------------------------
 	Entity Scene::GetPrimaryCamera()
 	{
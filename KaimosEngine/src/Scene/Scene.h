@@ -5,6 +5,7 @@
 #include "Core/Utils/Time/Timer.h"
 #include "Renderer/Cameras/Camera.h"
 #include "Renderer/Cameras/CameraController.h"
+#include "SceneBVH.h"
 
 #include <entt.hpp>
 
@@ -45,6 +46,9 @@ namespace Kaimos {
 		void DestroyEntity(Entity entity);
 		void UpdateMeshAndSpriteComponentsVertices(uint material_id);
 
+		// Closest entity with a mesh or sprite hit by the ray, from the scene BVH of the last update
+		Entity RaycastEntity(const Maths::Ray& ray);
+
 	public:
 
 		// --- Getters/Setters ---
@@ -85,13 +89,28 @@ namespace Kaimos {
 		std::vector<std::pair<Ref<Light>, glm::vec3>> GetSceneDirLights();
 		std::vector<std::pair<Ref<PointLight>, glm::vec3>> GetScenePointLights();
 
+		// Clusters the point lights for the view (camera entity ID), each view keeps its clusters to not rebuild them when switching views
+		void ClusterLights(uint view_id, const glm::mat4& view, const glm::mat4& projection);
+
 		// --- Private Scene Rendering Methods ---
+		// The editor camera and each camera entity (by its ID) are different views for the renderer
 		bool BeginScene(const Camera& camera, const glm::vec3& camera_pos, bool scene3D);
-		bool BeginScene(const CameraComponent& camera_component, const TransformComponent& transform_component, bool scene3D);
+		bool BeginScene(uint camera_id, const CameraComponent& camera_component, const TransformComponent& transform_component, bool scene3D);
 
+		// Gathers the meshes in the view_projection frustum & the active sprites, and sorts them into the render queues by material & depth
+		void BuildRenderQueues(const glm::mat4& view_projection, const glm::vec3& camera_pos);
 		void RenderSprites(Timestep dt);
 		void RenderMeshes(Timestep dt);
 
+		// --- Private Scene Transforms Methods ---
+		// Recalculates the cached transforms of the entities that changed, in parallel for big scenes, and keeps which ones moved for the BVH
+		void UpdateTransforms();
+
+		// --- Private Scene Timed Vertices Methods ---
+		// Timed vertices are evaluated by the Job System while rendering, and swapped in when it ends
+		void BeginTimedVerticesUpdate(Timestep dt);
+		void EndTimedVerticesUpdate();
+
 		// --- Private Scene Methods ---
 		void ConvertMeshIntoEntities(const Ref<Mesh>& mesh);
 
@@ -104,6 +123,7 @@ namespace Kaimos {
 		std::string m_Name = "KaimosUnnamedScene";
 		std::string m_Path = "";
 		entt::registry m_Registry = {};
+		SceneBVH m_BVH = {};
 		uint m_ViewportWidth = 0, m_ViewportHeight = 0;
 
 		Timer m_RenderingTime = {};
@@ -0,0 +1,244 @@
+#include "kspch.h"
+#include "SceneBVH.h"
+
+#include "ECS/Components.h"
+#include "Core/Resources/ResourceManager.h"
+#include "Renderer/Resources/Mesh.h"
+
+
+namespace Kaimos {
+
+	// ----------------------- Helpers --------------------------------------------------------------------
+	static Maths::AABB GetMeshLocalAABB(const MeshRendererComponent& mesh_component)
+	{
+		// Material graphs moving the vertices make the imported mesh bounds useless
+		if (mesh_component.PositionModified)
+		{
+			Maths::AABB aabb = {};
+			for (const Vertex& vertex : mesh_component.GetModifiedVertices())
+				aabb.Enclose(vertex.Pos);
+
+			return aabb;
+		}
+
+		Ref<Mesh> mesh = Resources::ResourceManager::GetMesh(mesh_component.MeshID);
+		return mesh && !mesh_component.GetModifiedVertices().empty() ? mesh->GetAABB() : Maths::AABB();
+	}
+
+	static Maths::AABB GetSpriteLocalAABB(const SpriteRendererComponent& sprite_component)
+	{
+		Maths::AABB aabb = {};
+		for (const QuadVertex& vertex : sprite_component.QuadVertices)
+			aabb.Enclose(vertex.Pos);
+
+		return aabb;
+	}
+
+
+
+	// ----------------------- Public BVH Methods ---------------------------------------------------------
+	void SceneBVH::Connect(entt::registry& registry)
+	{
+		registry.on_construct<MeshRendererComponent>().connect<&SceneBVH::OnEntityChanged>(*this);
+		registry.on_destroy<MeshRendererComponent>().connect<&SceneBVH::OnEntityChanged>(*this);
+		registry.on_construct<SpriteRendererComponent>().connect<&SceneBVH::OnEntityChanged>(*this);
+		registry.on_destroy<SpriteRendererComponent>().connect<&SceneBVH::OnEntityChanged>(*this);
+		registry.on_destroy<TransformComponent>().connect<&SceneBVH::OnEntityChanged>(*this);
+	}
+
+
+	void SceneBVH::Update(entt::registry& registry, const std::vector<entt::entity>& moved_entities)
+	{
+		KS_PROFILE_FUNCTION();
+		++m_UpdateStamp;
+
+		// -- Vertices Evaluated: Sync All the Entities (their bounds might have changed) --
+		if (m_VerticesEvaluations != VerticesEvaluations::Count)
+		{
+			m_VerticesEvaluations = VerticesEvaluations::Count;
+			for (auto ent : registry.view<MeshRendererComponent>())
+				SyncEntity(registry, ent, true);
+			for (auto ent : registry.view<SpriteRendererComponent>())
+				SyncEntity(registry, ent, true);
+		}
+
+		// -- Sync the Changed Entities only --
+		for (entt::entity ent : m_ChangedEntities)
+			SyncEntity(registry, ent, false);
+		for (entt::entity ent : moved_entities)
+			SyncEntity(registry, ent, false);
+
+		// Timed positions move the vertices without anything else changing (copied, as syncing them can leave the set)
+		std::vector<uint> timed_entities(m_TimedEntities.begin(), m_TimedEntities.end());
+		for (uint entity_id : timed_entities)
+			SyncEntity(registry, (entt::entity)entity_id, false);
+
+		m_ChangedEntities.clear();
+	}
+
+
+	void SceneBVH::Clear()
+	{
+		m_Proxies.clear();
+		m_Tree.Clear();
+		m_ChangedEntities.clear();
+		m_TimedEntities.clear();
+		m_UnboundedMeshes.clear();
+		m_MeshesCount = m_VerticesEvaluations = 0;
+	}
+
+
+
+	// ----------------------- Private BVH Methods --------------------------------------------------------
+	void SceneBVH::SyncEntity(entt::registry& registry, entt::entity entity, bool vertices_evaluated)
+	{
+		std::unordered_map<uint, EntityProxy>::iterator it = m_Proxies.find((uint)entity);
+		if (it != m_Proxies.end() && it->second.UpdateStamp == m_UpdateStamp)
+			return;
+
+		// -- Remove the Proxy of an Entity Gone (destroyed, deactivated or without mesh nor sprite) --
+		bool valid = registry.valid(entity);
+		const TransformComponent* transform = valid ? registry.try_get<TransformComponent>(entity) : nullptr;
+		const MeshRendererComponent* mesh_component = valid ? registry.try_get<MeshRendererComponent>(entity) : nullptr;
+		const SpriteRendererComponent* sprite_component = valid ? registry.try_get<SpriteRendererComponent>(entity) : nullptr;
+
+		if (!transform || !transform->EntityActive || (!mesh_component && !sprite_component))
+		{
+			if (it != m_Proxies.end())
+				RemoveProxy(it);
+
+			return;
+		}
+
+		bool new_proxy = it == m_Proxies.end();
+		EntityProxy& proxy = new_proxy ? m_Proxies[(uint)entity] : it->second;
+		proxy.UpdateStamp = m_UpdateStamp;
+
+		// -- Bounds (mesh ones only change with its vertices, sprite ones are just 4 vertices) --
+		bool bounds_changed = new_proxy || vertices_evaluated || sprite_component || (mesh_component && mesh_component->VerticesVersion != proxy.VerticesVersion);
+		if (bounds_changed)
+		{
+			Maths::AABB local_aabb = {};
+			if (mesh_component)
+				local_aabb = GetMeshLocalAABB(*mesh_component);
+			if (sprite_component)
+				local_aabb.Enclose(GetSpriteLocalAABB(*sprite_component));
+
+			proxy.LocalAABB = local_aabb;
+			proxy.VerticesVersion = mesh_component ? mesh_component->VerticesVersion : 0;
+		}
+
+		bool moved = new_proxy || transform->GetVersion() != proxy.TransformVersion;
+		if (moved)
+		{
+			proxy.Transform = transform->GetTransform();
+			proxy.TransformVersion = transform->GetVersion();
+		}
+
+		// -- Meshes Count & Timed Entities --
+		if (!new_proxy && proxy.HasMesh)
+			--m_MeshesCount;
+
+		proxy.HasMesh = mesh_component != nullptr;
+		if (proxy.HasMesh)
+			++m_MeshesCount;
+
+		proxy.TimedPosition = (mesh_component && mesh_component->PositionTimed) || (sprite_component && sprite_component->PositionTimed);
+		if (proxy.TimedPosition)
+			m_TimedEntities.insert((uint)entity);
+		else
+			m_TimedEntities.erase((uint)entity);
+
+		// -- Create, Move or Destroy its Tree Proxy (meshes without valid bounds are always visible instead) --
+		if (!proxy.LocalAABB.IsValid())
+		{
+			if (proxy.ProxyID != -1)
+				m_Tree.DestroyProxy(proxy.ProxyID);
+
+			proxy.ProxyID = -1;
+			if (proxy.HasMesh)
+				m_UnboundedMeshes.insert((uint)entity);
+			else
+				m_UnboundedMeshes.erase((uint)entity);
+
+			return;
+		}
+
+		m_UnboundedMeshes.erase((uint)entity);
+		if (proxy.ProxyID == -1)
+			proxy.ProxyID = m_Tree.CreateProxy(proxy.LocalAABB.Transform(proxy.Transform), (uint)entity);
+		else if (moved || bounds_changed)
+			m_Tree.MoveProxy(proxy.ProxyID, proxy.LocalAABB.Transform(proxy.Transform));
+	}
+
+
+	void SceneBVH::RemoveProxy(std::unordered_map<uint, EntityProxy>::iterator proxy_it)
+	{
+		const EntityProxy& proxy = proxy_it->second;
+		if (proxy.ProxyID != -1)
+			m_Tree.DestroyProxy(proxy.ProxyID);
+		if (proxy.HasMesh)
+			--m_MeshesCount;
+
+		m_TimedEntities.erase(proxy_it->first);
+		m_UnboundedMeshes.erase(proxy_it->first);
+		m_Proxies.erase(proxy_it);
+	}
+
+
+
+	// ----------------------- Queries --------------------------------------------------------------------
+	entt::entity SceneBVH::RayCast(const Maths::Ray& ray, const entt::registry& registry) const
+	{
+		KS_PROFILE_FUNCTION();
+		entt::entity hit_entity = entt::null;
+
+		m_Tree.RayCast(ray, FLT_MAX, [&](uint entity_id, float max_distance)
+			{
+				const EntityProxy& proxy = m_Proxies.at(entity_id);
+				entt::entity ent = (entt::entity)entity_id;
+
+				// -- Ray to Local Space (not normalizing the direction keeps the distances in world units) --
+				glm::mat4 inv_transform = glm::inverse(proxy.Transform);
+				Maths::Ray local_ray = { glm::vec3(inv_transform * glm::vec4(ray.Origin, 1.0f)), glm::vec3(inv_transform * glm::vec4(ray.Direction, 0.0f)) };
+
+				float distance = 0.0f;
+				if (!local_ray.IntersectsAABB(proxy.LocalAABB, distance) || distance > max_distance)
+					return max_distance;
+
+				// -- Test the Triangles --
+				float closest = max_distance;
+				if (const MeshRendererComponent* mesh_component = registry.try_get<MeshRendererComponent>(ent))
+				{
+					Ref<Mesh> mesh = Resources::ResourceManager::GetMesh(mesh_component->MeshID);
+					const std::vector<Vertex>& vertices = mesh_component->GetModifiedVertices();
+
+					if (mesh && mesh->GetVertices().size() == vertices.size())
+					{
+						const std::vector<uint>& indices = mesh->GetIndices();
+						for (size_t i = 0; i + 2 < indices.size(); i += 3)
+						{
+							if (local_ray.IntersectsTriangle(vertices[indices[i]].Pos, vertices[indices[i + 1]].Pos, vertices[indices[i + 2]].Pos, distance) && distance < closest)
+								closest = distance;
+						}
+					}
+				}
+
+				if (const SpriteRendererComponent* sprite_component = registry.try_get<SpriteRendererComponent>(ent))
+				{
+					const QuadVertex* quad = sprite_component->QuadVertices;
+					if (local_ray.IntersectsTriangle(quad[0].Pos, quad[1].Pos, quad[2].Pos, distance) && distance < closest)
+						closest = distance;
+					if (local_ray.IntersectsTriangle(quad[2].Pos, quad[3].Pos, quad[0].Pos, distance) && distance < closest)
+						closest = distance;
+				}
+
+				if (closest < max_distance)
+					hit_entity = ent;
+
+				return closest;
+			});
+
+		return hit_entity;
+	}
+}
@@ -0,0 +1,81 @@
+#ifndef _SCENEBVH_H_
+#define _SCENEBVH_H_
+
+#include "Core/Utils/Maths/DynamicAABBTree.h"
+
+#include <entt.hpp>
+
+namespace Kaimos {
+
+	// Bounding Volume Hierarchy over the active entities with a mesh and/or a sprite, in world space
+	// It's synced with the registry on Update(), which only visits the entities that changed: the ones with a changed transform,
+	// the ones whose mesh or sprite was added or removed (registry signals) and the ones with timed positions. All of them are
+	// visited again only when some vertices are evaluated (VerticesEvaluations), like when a material or a mesh changes
+	class SceneBVH
+	{
+	public:
+
+		// --- Entity Proxy ---
+		struct EntityProxy
+		{
+			int ProxyID = -1;
+			glm::mat4 Transform = glm::mat4(1.0f);
+			Maths::AABB LocalAABB = {};
+			uint VerticesVersion = 0, TransformVersion = 0, UpdateStamp = 0;
+			bool HasMesh = false, TimedPosition = false;
+		};
+
+		// --- Public BVH Methods ---
+		// Listens to the registry for the entities to sync (the registry must outlive the BVH or be cleared before it)
+		void Connect(entt::registry& registry);
+
+		// Moved entities are the ones whose transform changed (or was activated/deactivated) since the last update
+		void Update(entt::registry& registry, const std::vector<entt::entity>& moved_entities);
+		void Clear();
+
+		// --- Queries ---
+		// Calls callback(entity, proxy) for each entity with a mesh inside the frustum
+		template<typename T>
+		void QueryMeshes(const Maths::Frustum& frustum, T callback) const
+		{
+			m_Tree.Query(frustum, [&](uint entity_id)
+				{
+					const EntityProxy& proxy = m_Proxies.at(entity_id);
+					if (proxy.HasMesh && frustum.IsAABBVisible(proxy.LocalAABB, proxy.Transform))
+						callback((entt::entity)entity_id, proxy);
+				});
+
+			// Meshes without valid bounds can't be culled, so they are always visible
+			for (uint entity_id : m_UnboundedMeshes)
+				callback((entt::entity)entity_id, m_Proxies.at(entity_id));
+		}
+
+		// Returns the closest entity whose mesh or sprite triangles are hit by the ray (entt::null if none)
+		entt::entity RayCast(const Maths::Ray& ray, const entt::registry& registry) const;
+
+		// --- Getters ---
+		uint GetMeshesCount()		const { return m_MeshesCount; }
+		uint GetEntitiesCount()		const { return m_Tree.GetProxiesCount(); }
+
+	private:
+
+		// --- Private BVH Methods ---
+		void OnEntityChanged(entt::registry& registry, entt::entity entity) { m_ChangedEntities.push_back(entity); }
+
+		// Creates, updates or removes the proxy of the entity, once per update
+		void SyncEntity(entt::registry& registry, entt::entity entity, bool vertices_evaluated);
+		void RemoveProxy(std::unordered_map<uint, EntityProxy>::iterator proxy_it);
+
+	private:
+
+		std::unordered_map<uint, EntityProxy> m_Proxies;
+		Maths::DynamicAABBTree m_Tree = {};
+		uint m_UpdateStamp = 0, m_MeshesCount = 0, m_VerticesEvaluations = 0;
+
+		std::vector<entt::entity> m_ChangedEntities;		// Since the last update, from the registry signals
+		std::unordered_set<uint> m_TimedEntities;			// Proxies whose vertices positions change with time
+		std::unordered_set<uint> m_UnboundedMeshes;			// Mesh proxies without valid bounds (not in the tree)
+	};
+}
+
+#endif //_SCENEBVH_H_
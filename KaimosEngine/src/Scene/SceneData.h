@@ -0,0 +1,150 @@
+#ifndef _SCENE_DATA_H_
+#define _SCENE_DATA_H_
+
+#include <glm/glm.hpp>
+#include <optional>
+
+namespace Kaimos {
+
+	// --- Scene Records ---
+	// Plain copies of the serialized values of each component. They are written as they are into the binary
+	// scene files, so bump the binary scene version when changing any of them
+	// "Entity" is the index of the record's entity in SceneData::Entities
+	struct TagRecord
+	{
+		uint Entity = 0;
+		uint NameOffset = 0, NameLength = 0;		// In SceneData::Strings
+		uint DuplicationCount = 1;
+	};
+
+	struct TransformRecord
+	{
+		uint Entity = 0, EntityActive = 1;
+		glm::vec3 Translation = glm::vec3(0.0f), Rotation = glm::vec3(0.0f), Scale = glm::vec3(1.0f);
+	};
+
+	struct CameraRecord
+	{
+		uint Entity = 0;
+		int ProjectionType = 0;
+		glm::ivec2 ViewSize = glm::ivec2(0);
+		float FOV = 0.0f, NearClip = 0.0f, FarClip = 0.0f, OrthoSize = 0.0f;
+		uint Primary = 0, FixedAR = 0;
+	};
+
+	struct DirectionalLightRecord
+	{
+		uint Entity = 0, Visible = 1;
+		glm::vec4 Radiance = glm::vec4(1.0f);
+		float Intensity = 0.0f, SpecularStrength = 0.0f;
+		float StoredMinRadius = 0.0f, StoredMaxRadius = 0.0f, StoredFalloff = 0.0f;
+	};
+
+	struct PointLightRecord
+	{
+		uint Entity = 0, Visible = 1;
+		glm::vec4 Radiance = glm::vec4(1.0f);
+		float Intensity = 0.0f, SpecularStrength = 0.0f;
+		float FalloffMultiplier = 0.0f, MinRadius = 0.0f, MaxRadius = 0.0f;
+	};
+
+	struct SpriteRecord
+	{
+		uint Entity = 0, MaterialID = 0;
+	};
+
+	struct MeshRecord
+	{
+		uint Entity = 0, MaterialID = 0, MeshID = 0;
+	};
+
+	struct EditorCameraRecord
+	{
+		glm::vec3 Position = glm::vec3(0.0f);
+		glm::vec2 Rotation = glm::vec2(0.0f);
+		float MoveSpeed = 0.0f, SpeedMultiplier = 0.0f, MaxSpeedMultiplier = 0.0f, RotationSpeed = 0.0f;
+		uint RotationLocked = 0;
+		float PanSpeed = 0.0f, AdvanceSpeed = 0.0f, Zoom = 0.0f, MaxZoomSpeed = 0.0f;
+		float FOV = 0.0f, NearPlane = 0.0f, FarPlane = 0.0f;
+	};
+
+
+
+	// ---- SCENE DATA ---------------------------------------------
+	// Everything a scene file stores, with a contiguous array of records per component type sorted by entity
+	// The scene formats only read and write this, so converting between them is lossless
+	struct SceneData
+	{
+		// --- Scene Settings ---
+		std::string Name = "";
+		std::optional<glm::vec3> SceneColor = {};
+		std::optional<uint> CameraUIDisplay = {};
+		bool PBRPipeline = false;
+
+		std::optional<std::string> EnvironmentMap = {};		// The renderer's one is removed if not set
+		uint EnviroMapResolution = 1024, EnviroPrefilterResolution = 128, EnviroIrradianceResolution = 32;
+		std::optional<EditorCameraRecord> EditorCamera = {};
+
+		// --- Entities & Components ---
+		std::vector<uint> Entities;		// IDs
+		std::string Strings = "";		// Tags names
+
+		std::vector<TagRecord> Tags;
+		std::vector<TransformRecord> Transforms;
+		std::vector<CameraRecord> Cameras;
+		std::vector<DirectionalLightRecord> DirectionalLights;
+		std::vector<PointLightRecord> PointLights;
+		std::vector<SpriteRecord> Sprites;
+		std::vector<MeshRecord> Meshes;
+
+		// --- Tags Names ---
+		void AddTag(uint entity, const std::string& name, uint duplication_count)
+		{
+			Tags.push_back({ entity, (uint)Strings.size(), (uint)name.size(), duplication_count });
+			Strings += name;
+		}
+
+		std::string GetTagName(const TagRecord& tag) const { return Strings.substr(tag.NameOffset, tag.NameLength); }
+
+		// --- Entities ---
+		// Keeps the settings (and the arrays capacity), to reuse it for another batch of entities
+		void ClearEntities()
+		{
+			Entities.clear(); Strings.clear(); Tags.clear(); Transforms.clear(); Cameras.clear();
+			DirectionalLights.clear(); PointLights.clear(); Sprites.clear(); Meshes.clear();
+		}
+
+		// Adds the entities (and records) of another data after the ones here, like the chunks of a scene parsed in parallel
+		void AppendEntities(const SceneData& other)
+		{
+			uint entities_offset = (uint)Entities.size(), strings_offset = (uint)Strings.size();
+			Entities.insert(Entities.end(), other.Entities.begin(), other.Entities.end());
+			Strings += other.Strings;
+
+			size_t first_tag = Tags.size();
+			AppendRecords(Tags, other.Tags, entities_offset);
+			for (size_t i = first_tag; i < Tags.size(); ++i)
+				Tags[i].NameOffset += strings_offset;
+
+			AppendRecords(Transforms, other.Transforms, entities_offset);
+			AppendRecords(Cameras, other.Cameras, entities_offset);
+			AppendRecords(DirectionalLights, other.DirectionalLights, entities_offset);
+			AppendRecords(PointLights, other.PointLights, entities_offset);
+			AppendRecords(Sprites, other.Sprites, entities_offset);
+			AppendRecords(Meshes, other.Meshes, entities_offset);
+		}
+
+	private:
+
+		template<typename Record>
+		static void AppendRecords(std::vector<Record>& records, const std::vector<Record>& other_records, uint entities_offset)
+		{
+			size_t first = records.size();
+			records.insert(records.end(), other_records.begin(), other_records.end());
+			for (size_t i = first; i < records.size(); ++i)
+				records[i].Entity += entities_offset;
+		}
+	};
+}
+
+#endif //_SCENE_DATA_H_
@@ -0,0 +1,103 @@
+#include "kspch.h"
+#include "SceneHistory.h"
+#include "SceneSerializer.h"
+
+#include <unordered_set>
+
+namespace Kaimos {
+
+	// ----------------------- Globals --------------------------------------------------------------------
+	static const size_t s_MaxHistoryStates = 64;		// The oldest state is dropped past this
+
+
+
+	// ----------------------- Public History Methods -----------------------------------------------------
+	bool SceneHistory::Record()
+	{
+		KS_PROFILE_FUNCTION();
+		if (!m_Scene)
+			return false;
+
+		const SceneSnapshot* current_state = m_States.empty() ? nullptr : m_States[m_CurrentState].get();
+		Ref<SceneSnapshot> snapshot = SceneSerializer(m_Scene).TakeSnapshot(current_state);
+		if (!snapshot->HasChanges())
+			return false;
+
+		// -- Drop the Undone States & Push the New One --
+		if (!m_States.empty())
+			m_States.erase(m_States.begin() + m_CurrentState + 1, m_States.end());
+
+		m_States.push_back(snapshot);
+		if (m_States.size() > s_MaxHistoryStates)
+			m_States.pop_front();
+
+		m_CurrentState = m_States.size() - 1;
+		UpdateMemory();
+		return true;
+	}
+
+
+	bool SceneHistory::Undo()
+	{
+		Record();
+		if (m_States.empty() || m_CurrentState == 0)
+			return false;
+
+		RestoreState(m_CurrentState - 1);
+		return true;
+	}
+
+
+	bool SceneHistory::Redo()
+	{
+		Record();
+		if (m_CurrentState + 1 >= m_States.size())
+			return false;
+
+		RestoreState(m_CurrentState + 1);
+		return true;
+	}
+
+
+	void SceneHistory::Revert()
+	{
+		if (!m_States.empty())
+			RestoreState(m_CurrentState);
+	}
+
+
+
+	// ----------------------- Private History Methods ----------------------------------------------------
+	void SceneHistory::RestoreState(size_t state)
+	{
+		KS_PROFILE_FUNCTION();
+		SceneSerializer serializer(m_Scene);
+		serializer.RestoreSnapshot(*m_States[state]);
+		m_CurrentState = state;
+
+		// Some components don't restore their values bit by bit (like lights derived ones), so the state is taken again from the
+		// restored scene, otherwise the next record would see a change (dropping the states to redo)
+		Ref<SceneSnapshot> restored_state = serializer.TakeSnapshot(m_States[state].get());
+		if (restored_state->HasChanges())
+		{
+			m_States[state] = restored_state;
+			UpdateMemory();
+		}
+	}
+
+
+	void SceneHistory::UpdateMemory()
+	{
+		KS_PROFILE_FUNCTION();
+		m_Memory = m_UnsharedMemory = 0;
+
+		std::unordered_set<const SceneSnapshot::Page*> counted_slots;
+		for (const Ref<SceneSnapshot>& state : m_States)
+		{
+			m_UnsharedMemory += state->GetMemory();
+			for (const SceneSnapshot::EntitySlot& slot : state->m_Entities)
+				if (counted_slots.insert(slot.Records.get()).second)
+					m_Memory += slot.Records->size();
+		}
+	}
+}
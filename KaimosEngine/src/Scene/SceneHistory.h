@@ -0,0 +1,54 @@
+#ifndef _SCENE_HISTORY_H_
+#define _SCENE_HISTORY_H_
+
+#include "SceneSnapshot.h"
+#include <deque>
+
+namespace Kaimos {
+
+	class Scene;
+
+	// ---- SCENE HISTORY ------------------------------------------
+	// Undo/redo states of a scene, as snapshots sharing their unchanged entity slots with the state before them
+	class SceneHistory
+	{
+	public:
+
+		// --- Public Class Methods ---
+		SceneHistory() = default;
+		SceneHistory(const Ref<Scene>& scene) : m_Scene(scene) {}
+
+		// --- Public History Methods ---
+		// Takes a snapshot of the scene as its current state, dropping the states that could be redone
+		// Nothing is recorded (and false returned) if the scene didn't change since the current state
+		bool Record();
+
+		// Changes not recorded yet are recorded before undoing/redoing
+		bool Undo();
+		bool Redo();
+
+		// Restores the current state, discarding the changes not recorded (like the ones done while playing the scene)
+		void Revert();
+
+		// --- Getters ---
+		inline uint GetStatesCount()		const { return (uint)m_States.size(); }
+		inline size_t GetMemory()			const { return m_Memory; }			// Bytes of the distinct slots of all the states (what they take)
+		inline size_t GetUnsharedMemory()	const { return m_UnsharedMemory; }	// Bytes they would take without sharing slots
+
+	private:
+
+		// --- Private History Methods ---
+		void RestoreState(size_t state);
+		void UpdateMemory();
+
+	private:
+
+		Ref<Scene> m_Scene = nullptr;
+		std::deque<Ref<SceneSnapshot>> m_States;
+		size_t m_CurrentState = 0;
+
+		size_t m_Memory = 0, m_UnsharedMemory = 0;
+	};
+}
+
+#endif //_SCENE_HISTORY_H_
@@ -1,7 +1,11 @@
 #include "kspch.h"
 #include "SceneSerializer.h"
+#include "SceneData.h"
+#include "SceneSnapshot.h"
 
 #include "Core/Resources/ResourceManager.h"
+#include "Core/Utils/Maths/RandomGenerator.h"
+#include "Core/Utils/Jobs/JobSystem.h"
 #include "Renderer/Renderer.h"
 #include "Renderer/Cameras/CameraController.h"
 
@@ -11,206 +15,554 @@
 #include <yaml-cpp/yaml.h>
 #include "KaimosYAMLExtension.h"
 
+#include <limits>
+#include <deque>
+
 
 namespace Kaimos {
 
 	// ----------------------- Global Static Serialization Method ----------------------------------------
-	static void SerializeEntity(YAML::Emitter& output, Entity entity)
+	static const std::string s_BinarySceneExtension = ".kaimosb";
+
+	static void SerializeEntity(YAML::Emitter& output, const SceneData& data, uint entity_index, std::array<size_t, 7>& cursors)
 	{
 		KS_PROFILE_FUNCTION();
 
+		// Records are sorted by entity, so each component array is walked with its own cursor
+		auto get_record = [entity_index](const auto& records, size_t& cursor) -> decltype(records.data())
+		{
+			if (cursor < records.size() && records[cursor].Entity == entity_index)
+				return &records[cursor++];
+			return nullptr;
+		};
+
 		// -- Begin Entity Map --
 		output << YAML::BeginMap;
-		output << YAML::Key << "Entity" << YAML::Value << entity.GetID();
+		output << YAML::Key << "Entity" << YAML::Value << data.Entities[entity_index];
 
-		if (entity.HasComponent<TagComponent>())
+		if (const TagRecord* tag = get_record(data.Tags, cursors[0]))
 		{
 			output << YAML::Key << "TagComponent";
 			output << YAML::BeginMap;
-
-			TagComponent& tag = entity.GetComponent<TagComponent>();
-			output << YAML::Key << "Tag" << YAML::Value << tag.Tag;
-			output << YAML::Key << "DuplicationCount" << YAML::Value << tag.DuplicationCount;
+			output << YAML::Key << "Tag" << YAML::Value << data.GetTagName(*tag);
+			output << YAML::Key << "DuplicationCount" << YAML::Value << tag->DuplicationCount;
 			output << YAML::EndMap;
 		}
 
-		if (entity.HasComponent<TransformComponent>())
+		if (const TransformRecord* transform = get_record(data.Transforms, cursors[1]))
 		{
 			output << YAML::Key << "TransformComponent";
 			output << YAML::BeginMap;
 
-			TransformComponent& transform = entity.GetComponent<TransformComponent>();
-
-			output << YAML::Key << "EntityActive" << YAML::Value << transform.EntityActive;
-			output << YAML::Key << "Translation" << YAML::Value << transform.Translation;
-			output << YAML::Key << "Rotation" << YAML::Value << transform.Rotation;
-			output << YAML::Key << "Scale" << YAML::Value << transform.Scale;
+			output << YAML::Key << "EntityActive" << YAML::Value << (bool)transform->EntityActive;
+			output << YAML::Key << "Translation" << YAML::Value << transform->Translation;
+			output << YAML::Key << "Rotation" << YAML::Value << transform->Rotation;
+			output << YAML::Key << "Scale" << YAML::Value << transform->Scale;
 
 			output << YAML::EndMap;
 		}
 
-		if (entity.HasComponent<CameraComponent>())
+		if (const CameraRecord* camera = get_record(data.Cameras, cursors[2]))
 		{
 			output << YAML::Key << "CameraComponent";
 			output << YAML::BeginMap;
-			
-			CameraComponent& cam_comp = entity.GetComponent<CameraComponent>();
-			Camera& camera = cam_comp.Camera;
 
 			// -- Begin Cam Map --
 			output << YAML::Key << "Camera" << YAML::Value;
 			output << YAML::BeginMap;
-			output << YAML::Key << "ProjectionType" << YAML::Value << (int)camera.GetProjectionType();
+			output << YAML::Key << "ProjectionType" << YAML::Value << camera->ProjectionType;
 
-			output << YAML::Key << "ViewSize" << YAML::Value << camera.GetViewportSize();
-			output << YAML::Key << "FOV" << YAML::Value << (int)camera.GetFOV();
-			output << YAML::Key << "FarClip" << YAML::Value << camera.GetFarPlane();
-			output << YAML::Key << "NearClip" << YAML::Value <<camera.GetNearPlane();
-			output << YAML::Key << "OrthoSize" << YAML::Value << camera.GetSize();
+			output << YAML::Key << "ViewSize" << YAML::Value << glm::vec2(camera->ViewSize);
+			output << YAML::Key << "FOV" << YAML::Value << camera->FOV;
+			output << YAML::Key << "FarClip" << YAML::Value << camera->FarClip;
+			output << YAML::Key << "NearClip" << YAML::Value << camera->NearClip;
+			output << YAML::Key << "OrthoSize" << YAML::Value << camera->OrthoSize;
 			output << YAML::EndMap;
 			// -- End Cam Map --
 
-			output << YAML::Key << "PrimaryCamera" << YAML::Value << cam_comp.Primary;
-			output << YAML::Key << "FixedAR" << YAML::Value << cam_comp.FixedAspectRatio;
+			output << YAML::Key << "PrimaryCamera" << YAML::Value << (bool)camera->Primary;
+			output << YAML::Key << "FixedAR" << YAML::Value << (bool)camera->FixedAR;
 			output << YAML::EndMap;
 		}
 
-		if (entity.HasComponent<DirectionalLightComponent>())
+		if (const DirectionalLightRecord* light = get_record(data.DirectionalLights, cursors[3]))
 		{
-			DirectionalLightComponent& light_comp = entity.GetComponent<DirectionalLightComponent>();
-
 			output << YAML::Key << "DirectionalLightComponent";
 			output << YAML::BeginMap;
-			output << YAML::Key << "Visible" << YAML::Value << light_comp.Visible;
-			output << YAML::Key << "StoredLightMinRadius" << YAML::Value << light_comp.StoredLightMinRadius;
-			output << YAML::Key << "StoredLightMaxRadius" << YAML::Value << light_comp.StoredLightMaxRadius;
-			output << YAML::Key << "StoredLightFalloff" << YAML::Value << light_comp.StoredLightFalloff;
+			output << YAML::Key << "Visible" << YAML::Value << (bool)light->Visible;
+			output << YAML::Key << "StoredLightMinRadius" << YAML::Value << light->StoredMinRadius;
+			output << YAML::Key << "StoredLightMaxRadius" << YAML::Value << light->StoredMaxRadius;
+			output << YAML::Key << "StoredLightFalloff" << YAML::Value << light->StoredFalloff;
 
 			// -- Begin Light Map --
 			output << YAML::Key << "Light" << YAML::Value;
 			output << YAML::BeginMap;
-			output << YAML::Key << "Radiance" << YAML::Value << light_comp.Light->Radiance;
-			output << YAML::Key << "Intensity" << YAML::Value << light_comp.Light->Intensity;
-			output << YAML::Key << "SpecularStrength" << YAML::Value << light_comp.Light->SpecularStrength;
+			output << YAML::Key << "Radiance" << YAML::Value << light->Radiance;
+			output << YAML::Key << "Intensity" << YAML::Value << light->Intensity;
+			output << YAML::Key << "SpecularStrength" << YAML::Value << light->SpecularStrength;
 			output << YAML::EndMap;
 			// -- End Light Map --
 
 			output << YAML::EndMap;
 		}
 
-		if (entity.HasComponent<PointLightComponent>())
+		if (const PointLightRecord* light = get_record(data.PointLights, cursors[4]))
 		{
-			PointLightComponent& light_comp = entity.GetComponent<PointLightComponent>();
-
 			output << YAML::Key << "PointLightComponent";
 			output << YAML::BeginMap;
-			output << YAML::Key << "Visible" << YAML::Value << light_comp.Visible;
+			output << YAML::Key << "Visible" << YAML::Value << (bool)light->Visible;
 
 			// -- Begin Light Map --
 			output << YAML::Key << "Light" << YAML::Value;
 			output << YAML::BeginMap;
-			output << YAML::Key << "Radiance" << YAML::Value << light_comp.Light->Radiance;
-			output << YAML::Key << "Intensity" << YAML::Value << light_comp.Light->Intensity;
-			output << YAML::Key << "SpecularStrength" << YAML::Value << light_comp.Light->SpecularStrength;
+			output << YAML::Key << "Radiance" << YAML::Value << light->Radiance;
+			output << YAML::Key << "Intensity" << YAML::Value << light->Intensity;
+			output << YAML::Key << "SpecularStrength" << YAML::Value << light->SpecularStrength;
 
-			output << YAML::Key << "FalloffMultiplier" << YAML::Value << light_comp.Light->FalloffMultiplier;
-			output << YAML::Key << "MinRadius" << YAML::Value << light_comp.Light->GetMinRadius();
-			output << YAML::Key << "MaxRadius" << YAML::Value << light_comp.Light->GetMaxRadius();
+			output << YAML::Key << "FalloffMultiplier" << YAML::Value << light->FalloffMultiplier;
+			output << YAML::Key << "MinRadius" << YAML::Value << light->MinRadius;
+			output << YAML::Key << "MaxRadius" << YAML::Value << light->MaxRadius;
 			output << YAML::EndMap;
 			// -- End Light Map --
 
 			output << YAML::EndMap;
 		}
 
-		if (entity.HasComponent<SpriteRendererComponent>())
+		if (const SpriteRecord* sprite = get_record(data.Sprites, cursors[5]))
 		{
-			SpriteRendererComponent& sprite_comp = entity.GetComponent<SpriteRendererComponent>();
 			output << YAML::Key << "SpriteRendererComponent";
 			output << YAML::BeginMap;
-			output << YAML::Key << "Material" << YAML::Value << sprite_comp.SpriteMaterialID;
+			output << YAML::Key << "Material" << YAML::Value << sprite->MaterialID;
 			output << YAML::EndMap;
 		}
 
-		if (entity.HasComponent<MeshRendererComponent>())
+		if (const MeshRecord* mesh = get_record(data.Meshes, cursors[6]))
 		{
-			MeshRendererComponent& mesh_comp = entity.GetComponent<MeshRendererComponent>();
 			output << YAML::Key << "MeshRendererComponent";
 			output << YAML::BeginMap;
-			output << YAML::Key << "Material" << YAML::Value << mesh_comp.MaterialID;
-			output << YAML::Key << "Mesh" << YAML::Value << mesh_comp.MeshID;
+			output << YAML::Key << "Material" << YAML::Value << mesh->MaterialID;
+			output << YAML::Key << "Mesh" << YAML::Value << mesh->MeshID;
 			output << YAML::EndMap;
 		}
-		
-		
+
+
 		// -- End Entity Map --
 		output << YAML::EndMap;
 	}
 
 
-
-	// ----------------------- Public Serialization Methods ----------------------------------------------
-	void SceneSerializer::Serialize(const std::string& filepath) const
+	static void BeginYAMLScene(YAML::Emitter& output, const SceneData& data)
 	{
-		KS_PROFILE_FUNCTION();
-		KS_INFO("\n\n--- SERIALIZING KAIMOS SCENE ---");
-		
-		const CameraController& camera_control = m_Scene->GetEditorCamera();
-		const Camera& camera = m_Scene->GetEditorCamera().GetCamera();
+		output.SetFloatPrecision(std::numeric_limits<float>::max_digits10);	// Floats can be converted back & forth with the binary format without losses
 
-		YAML::Emitter output;
 		output << YAML::BeginMap;
-		output << YAML::Key << "KaimosScene" << YAML::Value << m_Scene->GetName().c_str();							// Save Scene as Key + SceneName as value
-		output << YAML::Key << "SceneColor" << YAML::Value << Renderer::GetSceneColor();							// Save Scene Color
-		output << YAML::Key << "CamUIDisplay" << YAML::Value << Renderer::GetCameraUIDisplayOption();				// Save Camera UI Display Option
-		output << YAML::Key << "PBRPipeline" << YAML::Value << Renderer::IsSceneInPBRPipeline();					// Save if scene is PBR or not
-		output << YAML::Key << "EnvironmentMapTexture" << YAML::Value << Renderer::GetEnvironmentMapFilepath();		// Save Enviro Texture
-		output << YAML::Key << "EnviroMapRes" << YAML::Value << Renderer::GetEnvironmentMapResolution();			// Save Enviro Texture Res
-		output << YAML::Key << "EnviroMapPrefRes" << YAML::Value << Renderer::GetEnviroPrefilterMapResolution();	// Save Enviro Prefiltered Texture Res
-		output << YAML::Key << "EnviroMapIrrRes" << YAML::Value << Renderer::GetEnviroIrradianceMapResolution();	// Save Enviro Irradiance Texture Res
+		output << YAML::Key << "KaimosScene" << YAML::Value << data.Name.c_str();													// Save Scene as Key + SceneName as value
+
+		if (data.SceneColor)
+			output << YAML::Key << "SceneColor" << YAML::Value << *data.SceneColor;													// Save Scene Color
+		if (data.CameraUIDisplay)
+			output << YAML::Key << "CamUIDisplay" << YAML::Value << *data.CameraUIDisplay;											// Save Camera UI Display Option
+
+		output << YAML::Key << "PBRPipeline" << YAML::Value << data.PBRPipeline;													// Save if scene is PBR or not
+		if (data.EnvironmentMap)
+		{
+			output << YAML::Key << "EnvironmentMapTexture" << YAML::Value << *data.EnvironmentMap;									// Save Enviro Texture
+			output << YAML::Key << "EnviroMapRes" << YAML::Value << data.EnviroMapResolution;										// Save Enviro Texture Res
+			output << YAML::Key << "EnviroMapPrefRes" << YAML::Value << data.EnviroPrefilterResolution;								// Save Enviro Prefiltered Texture Res
+			output << YAML::Key << "EnviroMapIrrRes" << YAML::Value << data.EnviroIrradianceResolution;								// Save Enviro Irradiance Texture Res
+		}
 
 		// Save editor camera as a sequence (like an array)
-		output << YAML::Key << "EditorCamera" << YAML::Value << YAML::BeginSeq;
-		output << YAML::BeginMap;
+		if (data.EditorCamera)
+		{
+			const EditorCameraRecord& camera = *data.EditorCamera;
+			output << YAML::Key << "EditorCamera" << YAML::Value << YAML::BeginSeq;
+			output << YAML::BeginMap;
 
-		output << YAML::Key << "CameraPos" << YAML::Value << camera_control.GetPosition();
-		output << YAML::Key << "CameraRot" << YAML::Value << camera_control.GetOrientationAngles();
-
-		output << YAML::Key << "CameraMovSpeed" << YAML::Value << camera_control.m_MoveSpeed;
-		output << YAML::Key << "CameraSpeedMulti" << YAML::Value << camera_control.GetSpeedMultiplier();
-		output << YAML::Key << "MaxSpeedMultiplier" << YAML::Value << camera_control.m_MaxSpeedMultiplier;
-		output << YAML::Key << "CameraRotSpeed" << YAML::Value << camera_control.m_RotationSpeed;
-		output << YAML::Key << "CameraRotLock" << YAML::Value << camera_control.IsRotationLocked();
-		output << YAML::Key << "CameraPanSpeed" << YAML::Value << camera_control.m_PanSpeed;
-		output << YAML::Key << "CameraAdvanceSpeed" << YAML::Value << camera_control.m_AdvanceCameraSpeed;
-		output << YAML::Key << "CameraZoom" << YAML::Value << camera_control.m_ZoomLevel;
-		output << YAML::Key << "CameraMaxZoom" << YAML::Value << camera_control.m_MaxZoomSpeed;
-		output << YAML::Key << "CameraFOV" << YAML::Value << camera.GetFOV();
-		output << YAML::Key << "CameraNPlane" << YAML::Value << camera.GetNearPlane();
-		output << YAML::Key << "CameraFPlane" << YAML::Value << camera.GetFarPlane();
-		output << YAML::EndMap;
-		output << YAML::EndSeq;
+			output << YAML::Key << "CameraPos" << YAML::Value << camera.Position;
+			output << YAML::Key << "CameraRot" << YAML::Value << camera.Rotation;
+
+			output << YAML::Key << "CameraMovSpeed" << YAML::Value << camera.MoveSpeed;
+			output << YAML::Key << "CameraSpeedMulti" << YAML::Value << camera.SpeedMultiplier;
+			output << YAML::Key << "MaxSpeedMultiplier" << YAML::Value << camera.MaxSpeedMultiplier;
+			output << YAML::Key << "CameraRotSpeed" << YAML::Value << camera.RotationSpeed;
+			output << YAML::Key << "CameraRotLock" << YAML::Value << (bool)camera.RotationLocked;
+			output << YAML::Key << "CameraPanSpeed" << YAML::Value << camera.PanSpeed;
+			output << YAML::Key << "CameraAdvanceSpeed" << YAML::Value << camera.AdvanceSpeed;
+			output << YAML::Key << "CameraZoom" << YAML::Value << camera.Zoom;
+			output << YAML::Key << "CameraMaxZoom" << YAML::Value << camera.MaxZoomSpeed;
+			output << YAML::Key << "CameraFOV" << YAML::Value << camera.FOV;
+			output << YAML::Key << "CameraNPlane" << YAML::Value << camera.NearPlane;
+			output << YAML::Key << "CameraFPlane" << YAML::Value << camera.FarPlane;
+			output << YAML::EndMap;
+			output << YAML::EndSeq;
+		}
 
 		// Save Entities as a sequence (like an array)
 		output << YAML::Key << "Entities" << YAML::Value << YAML::BeginSeq;
+	}
 
-		uint entities_deserialized = 0;
-		m_Scene->m_Registry.each([&](auto entityID)
-			{
-				Entity entity = { entityID, m_Scene.get() };
-				if (!entity)
-					return;
-				
-				SerializeEntity(output, entity);
-				++entities_deserialized;
-			});
 
+	static void EndYAMLScene(YAML::Emitter& output)
+	{
 		output << YAML::EndSeq;
 		output << YAML::EndMap;		// Map is like the whole file
+	}
+
+
+	// Adds the entity and a record of each of its components to the data
+	static void GatherEntity(Entity entity, SceneData& data)
+	{
+		uint entity_index = (uint)data.Entities.size();
+		data.Entities.push_back(entity.GetID());
+
+		if (entity.HasComponent<TagComponent>())
+		{
+			const TagComponent& tag = entity.GetComponent<TagComponent>();
+			data.AddTag(entity_index, tag.Tag, tag.DuplicationCount);
+		}
+
+		if (entity.HasComponent<TransformComponent>())
+		{
+			const TransformComponent& transform = entity.GetComponent<TransformComponent>();
+			data.Transforms.push_back({ entity_index, transform.EntityActive, transform.Translation, transform.Rotation, transform.Scale });
+		}
+
+		if (entity.HasComponent<CameraComponent>())
+		{
+			const CameraComponent& cam_comp = entity.GetComponent<CameraComponent>();
+			const Camera& entity_camera = cam_comp.Camera;
+			data.Cameras.push_back({ entity_index, (int)entity_camera.GetProjectionType(), entity_camera.GetViewportSize(), entity_camera.GetFOV(),
+				entity_camera.GetNearPlane(), entity_camera.GetFarPlane(), entity_camera.GetSize(), cam_comp.Primary, cam_comp.FixedAspectRatio });
+		}
+
+		if (entity.HasComponent<DirectionalLightComponent>())
+		{
+			const DirectionalLightComponent& light_comp = entity.GetComponent<DirectionalLightComponent>();
+			data.DirectionalLights.push_back({ entity_index, light_comp.Visible, light_comp.Light->Radiance, light_comp.Light->Intensity, light_comp.Light->SpecularStrength,
+				light_comp.StoredLightMinRadius, light_comp.StoredLightMaxRadius, light_comp.StoredLightFalloff });
+		}
+
+		if (entity.HasComponent<PointLightComponent>())
+		{
+			const PointLightComponent& light_comp = entity.GetComponent<PointLightComponent>();
+			data.PointLights.push_back({ entity_index, light_comp.Visible, light_comp.Light->Radiance, light_comp.Light->Intensity, light_comp.Light->SpecularStrength,
+				light_comp.Light->FalloffMultiplier, light_comp.Light->GetMinRadius(), light_comp.Light->GetMaxRadius() });
+		}
+
+		if (entity.HasComponent<SpriteRendererComponent>())
+			data.Sprites.push_back({ entity_index, entity.GetComponent<SpriteRendererComponent>().SpriteMaterialID });
+
+		if (entity.HasComponent<MeshRendererComponent>())
+		{
+			const MeshRendererComponent& mesh_comp = entity.GetComponent<MeshRendererComponent>();
+			data.Meshes.push_back({ entity_index, mesh_comp.MaterialID, mesh_comp.MeshID });
+		}
+	}
+
+
+
+	// ----------------------- Global Static Deserialization Methods -------------------------------------
+	// Entities parsed from a YAML file, deserialized by a job into their own data
+	struct EntitiesChunk
+	{
+		std::vector<YAML::Node> Nodes;
+		SceneData Data;
+		std::string Error = "";
+	};
+
+	static constexpr uint s_EntitiesPerChunk = 256;
+	static constexpr uint s_MaxPendingChunks = 16;
+	static constexpr uint s_EvaluatedVerticesPerJob = 4096;
+
+
+	static void DeserializeEntity(const YAML::Node& entity, SceneData& data)
+	{
+		uint entity_index = (uint)data.Entities.size();
+		data.Entities.push_back(entity["Entity"].as<uint>());
+
+		auto tag_component = entity["TagComponent"];
+		if (tag_component)
+			data.AddTag(entity_index, tag_component["Tag"].as<std::string>(), tag_component["DuplicationCount"].as<uint>());
+
+		YAML::Node transform_node = entity["TransformComponent"];
+		if (transform_node)
+		{
+			TransformRecord transform;
+			transform.Entity = entity_index;
+			transform.EntityActive = transform_node["EntityActive"].as<bool>();
+			transform.Translation = transform_node["Translation"].as<glm::vec3>();
+			transform.Rotation = transform_node["Rotation"].as<glm::vec3>();
+			transform.Scale = transform_node["Scale"].as<glm::vec3>();
+			data.Transforms.push_back(transform);
+		}
+
+		YAML::Node cameracomp_node = entity["CameraComponent"];
+		if (cameracomp_node)
+		{
+			YAML::Node camera_node = cameracomp_node["Camera"];
+
+			CameraRecord camera;
+			camera.Entity = entity_index;
+			camera.ProjectionType = camera_node["ProjectionType"].as<int>();
+			camera.ViewSize = glm::ivec2(camera_node["ViewSize"].as<glm::vec2>());
+			camera.FOV = camera_node["FOV"].as<float>();
+			camera.NearClip = camera_node["NearClip"].as<float>();
+			camera.FarClip = camera_node["FarClip"].as<float>();
+			camera.OrthoSize = camera_node["OrthoSize"].as<float>();
+			camera.Primary = cameracomp_node["PrimaryCamera"].as<bool>();
+			camera.FixedAR = cameracomp_node["FixedAR"].as<bool>();
+			data.Cameras.push_back(camera);
+		}
+
+		YAML::Node dirlightcomp_node = entity["DirectionalLightComponent"];
+		if (dirlightcomp_node)
+		{
+			YAML::Node light_node = dirlightcomp_node["Light"];
+
+			DirectionalLightRecord light;
+			light.Entity = entity_index;
+			light.Visible = dirlightcomp_node["Visible"].as<bool>();
+			light.Radiance = light_node["Radiance"].as<glm::vec4>();
+			light.Intensity = light_node["Intensity"].as<float>();
+			light.SpecularStrength = light_node["SpecularStrength"].as<float>();
+
+			light.StoredMinRadius = dirlightcomp_node["StoredLightMinRadius"].as<float>();
+			light.StoredMaxRadius = dirlightcomp_node["StoredLightMaxRadius"].as<float>();
+			light.StoredFalloff = dirlightcomp_node["StoredLightFalloff"].as<float>();
+			data.DirectionalLights.push_back(light);
+		}
+
+		YAML::Node pointlightcomp_node = entity["PointLightComponent"];
+		if (pointlightcomp_node)
+		{
+			YAML::Node light_node = pointlightcomp_node["Light"];
+
+			PointLightRecord light;
+			light.Entity = entity_index;
+			light.Visible = pointlightcomp_node["Visible"].as<bool>();
+			light.Radiance = light_node["Radiance"].as<glm::vec4>();
+			light.Intensity = light_node["Intensity"].as<float>();
+			light.SpecularStrength = light_node["SpecularStrength"].as<float>();
+			light.FalloffMultiplier = light_node["FalloffMultiplier"].as<float>();
+			light.MinRadius = light_node["MinRadius"].as<float>();
+			light.MaxRadius = light_node["MaxRadius"].as<float>();
+			data.PointLights.push_back(light);
+		}
+
+		YAML::Node sprite_node = entity["SpriteRendererComponent"];
+		if (sprite_node)
+			data.Sprites.push_back({ entity_index, sprite_node["Material"].as<uint>() });
+
+		YAML::Node mesh_node = entity["MeshRendererComponent"];
+		if (mesh_node)
+			data.Meshes.push_back({ entity_index, mesh_node["Material"].as<uint>(), mesh_node["Mesh"].as<uint>() });
+	}
+
+
+	// Thread-safe for different chunks, each one owns its nodes (which are dropped once deserialized)
+	static void DeserializeEntitiesChunk(EntitiesChunk& chunk)
+	{
+		KS_PROFILE_FUNCTION();
+		try
+		{
+			for (const YAML::Node& entity : chunk.Nodes)
+				DeserializeEntity(entity, chunk.Data);
+		}
+		catch (const YAML::Exception& exception)
+		{
+			chunk.Error = exception.what();
+		}
+
+		chunk.Nodes.clear();
+		chunk.Nodes.shrink_to_fit();
+	}
+
+
+	// Material of a deserialized sprite or mesh, the default one (or a new one) if it doesn't exist anymore
+	static uint GetDeserializedMaterial(uint material_id)
+	{
+		uint mat_id = Renderer::GetMaterialIfExists(material_id);
+		if (mat_id == 0)
+		{
+			uint def_mat_id = Renderer::GetDefaultMaterialID();
+			if (def_mat_id != 0)
+				mat_id = def_mat_id;
+			else
+				mat_id = Renderer::CreateMaterial("Unnamed")->GetID();
+		}
+
+		return mat_id;
+	}
+
+
+	// Bulk-inserts a component into the entity of each record and then sets each one up from its record
+	// The inserted components are copies of the same default one, so they can't keep any shared reference from it
+	template<typename Component, typename Record, typename SetupFunction>
+	static void InsertComponents(entt::registry& registry, const std::vector<entt::entity>& entities, const std::vector<Record>& records, SetupFunction setup)
+	{
+		if (records.empty())
+			return;
+
+		std::vector<entt::entity> owners(records.size());
+		for (size_t i = 0; i < records.size(); ++i)
+			owners[i] = entities[records[i].Entity];
+
+		registry.insert<Component>(owners.begin(), owners.end());
+		for (size_t i = 0; i < records.size(); ++i)
+			setup(records[i], registry.get<Component>(owners[i]));
+	}
+
+
+	// Evaluates the vertices of the deserialized sprites & meshes with their materials, once per material (sprites) or per
+	// mesh & material pair (meshes), with the meshes ones split in vertex ranges evaluated by the Job System and shared through the
+	// VerticesCache by all the components of the pair
+	// Materials drawing randoms are evaluated per component instead, so each one gets its own random values
+	static void BindRendererVertices(entt::registry& registry, const std::vector<entt::entity>& entities, const SceneData& data)
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- Sprites (4 vertices per material, not worth a job) --
+		std::unordered_map<uint, std::array<QuadVertex, 4>> sprite_vertices;
+		for (const SpriteRecord& record : data.Sprites)
+		{
+			SpriteRendererComponent& sprite_comp = registry.get<SpriteRendererComponent>(entities[record.Entity]);
+			Ref<Material> material = Renderer::GetMaterial(sprite_comp.SpriteMaterialID);
+			if (!material)
+			{
+				sprite_comp.SetupVertices();
+				continue;
+			}
+
+			if (material->GetVertexAttributesProgram().HasRandoms())
+			{
+				sprite_comp.UpdateVertices();
+				continue;
+			}
+
+			auto it = sprite_vertices.find(sprite_comp.SpriteMaterialID);
+			if (it == sprite_vertices.end())
+			{
+				sprite_comp.UpdateVertices();
+				std::array<QuadVertex, 4> vertices;
+				std::copy(sprite_comp.QuadVertices, sprite_comp.QuadVertices + 4, vertices.begin());
+				sprite_vertices.emplace(sprite_comp.SpriteMaterialID, vertices);
+			}
+			else
+				sprite_comp.SetEvaluatedVertices(it->second.data(), *material);
+		}
+
+		// -- Gather Mesh & Material Pairs (programs are compiled & uniforms evaluated here, as they touch the graphs) --
+		struct VerticesBinding
+		{
+			Ref<Mesh> BindingMesh = nullptr;
+			Ref<Material> BindingMaterial = nullptr;
+			std::vector<glm::vec4> Uniforms;
+			Ref<std::vector<Vertex>> Vertices = nullptr;
+			bool Cached = false;
+		};
+
+		std::vector<VerticesBinding> bindings;
+		std::unordered_map<uint64_t, uint> bindings_indices;
+		std::vector<uint> meshes_bindings(data.Meshes.size(), UINT_MAX);
+
+		for (size_t i = 0; i < data.Meshes.size(); ++i)
+		{
+			const MeshRendererComponent& mesh_comp = registry.get<MeshRendererComponent>(entities[data.Meshes[i].Entity]);
+			uint64_t pair_key = ((uint64_t)mesh_comp.MeshID << 32) | mesh_comp.MaterialID;
+
+			auto it = bindings_indices.find(pair_key);
+			if (it != bindings_indices.end())
+			{
+				meshes_bindings[i] = it->second;
+				continue;
+			}
+
+			VerticesBinding binding = { Resources::ResourceManager::GetMesh(mesh_comp.MeshID), Renderer::GetMaterial(mesh_comp.MaterialID) };
+			bool shared_binding = !binding.BindingMaterial || !binding.BindingMaterial->GetVertexAttributesProgram().HasRandoms();
+			if (binding.BindingMesh && binding.BindingMaterial)
+			{
+				// Pairs already in the cache (like the ones of another loaded scene) aren't evaluated again
+				binding.Vertices = VerticesCache::FindVertices(mesh_comp.MeshID, *binding.BindingMaterial);
+				binding.Cached = binding.Vertices != nullptr;
+				if (!binding.Cached)
+				{
+					binding.Uniforms = binding.BindingMaterial->GetVertexAttributesProgram().EvaluateUniforms();
+					binding.Vertices = CreateRef<std::vector<Vertex>>(binding.BindingMesh->GetVertices());
+				}
+
+				meshes_bindings[i] = (uint)bindings.size();
+				bindings.push_back(std::move(binding));
+			}
+
+			if (shared_binding)
+				bindings_indices.emplace(pair_key, meshes_bindings[i]);
+		}
+
+		// -- Evaluate Pairs Vertices in Ranges --
+		for (VerticesBinding& binding : bindings)
+		{
+			if (binding.Cached)
+				continue;
+
+			const MaterialEditor::MaterialGraphProgram* program = &binding.BindingMaterial->GetVertexAttributesProgram();
+			std::vector<Vertex>& vertices = *binding.Vertices;
+			for (size_t first = 0; first < vertices.size(); first += s_EvaluatedVerticesPerJob)
+			{
+				size_t count = std::min(vertices.size() - first, (size_t)s_EvaluatedVerticesPerJob);
+				JobSystem::Execute([&binding, &vertices, program, first, count]()
+					{
+						program->EvaluateVertices(binding.Uniforms, vertices.data() + first, count, true, true, true);
+					});
+			}
+		}
+
+		JobSystem::Wait();
+
+		for (const VerticesBinding& binding : bindings)
+			if (!binding.Cached)
+				VerticesCache::AddVertices(binding.BindingMesh->GetID(), *binding.BindingMaterial, binding.Vertices);
+
+		// -- Bind Evaluated Vertices (shared by all the components of each pair) --
+		for (size_t i = 0; i < data.Meshes.size(); ++i)
+		{
+			MeshRendererComponent& mesh_comp = registry.get<MeshRendererComponent>(entities[data.Meshes[i].Entity]);
+			if (meshes_bindings[i] == UINT_MAX)
+				mesh_comp.ModifiedVertices = nullptr;
+			else
+				mesh_comp.SetEvaluatedVertices(bindings[meshes_bindings[i]].Vertices, *bindings[meshes_bindings[i]].BindingMaterial);
+		}
+	}
+
+
+
+	// ----------------------- Public Serialization Methods ----------------------------------------------
+	void SceneSerializer::Serialize(const std::string& filepath) const
+	{
+		KS_PROFILE_FUNCTION();
+		KS_INFO("\n\n--- SERIALIZING KAIMOS SCENE ---");
+
+		// -- Write File (YAML scenes are written while they are gathered) --
+		uint entities_serialized = 0;
+		bool written = false;
+		if (IsBinaryScene(filepath))
+		{
+			SceneData data;
+			GatherSceneData(data);
+			written = WriteBinary(data, filepath);
+			entities_serialized = (uint)data.Entities.size();
+		}
+		else
+			written = WriteSceneYAML(filepath, entities_serialized);
+
+		if (!written)
+		{
+			KS_ERROR("Error Saving '{0}' scene file\nError: Couldn't write it", filepath);
+			return;
+		}
 
-		std::ofstream file(filepath);
-		file << output.c_str();
 		m_Scene->SetPath(filepath);
-		KS_TRACE("Finished Serializing {0} Entities in '{1}' Scene", entities_deserialized, m_Scene->GetName());
+		KS_TRACE("Finished Serializing {0} Entities in '{1}' Scene", entities_serialized, m_Scene->GetName());
 	}
 
 
@@ -230,48 +582,170 @@ namespace Kaimos {
 		}
 
 		// -- File Load --
-		YAML::Node data;
-		try { data = YAML::LoadFile(filepath); }
-		catch (const YAML::ParserException& exception)
-		{
-			KS_ERROR("Error Loading '{0}' scene file\nError: {1}", filepath, exception.what());
+		SceneData data;
+		if (!ReadSceneFile(data, filepath))
 			return false;
-		}
 
-		if (!data["KaimosScene"])
+		// -- Scene Setup --
+		ApplySceneData(data);
+		m_Scene->SetPath(filepath);
+
+		KS_TRACE("Finished Deserializing {0} Entities in '{1}' Scene", data.Entities.size(), m_Scene->GetName());
+		return true;
+	}
+
+
+
+	// ----------------------- Public Conversion Methods -------------------------------------------------
+	bool SceneSerializer::ConvertScene(const std::string& src_filepath, const std::string& dst_filepath)
+	{
+		KS_PROFILE_FUNCTION();
+
+		SceneData data;
+		if (!ReadSceneFile(data, src_filepath))
+			return false;
+
+		if (!WriteSceneFile(data, dst_filepath))
 		{
-			KS_ERROR("Error Loading '{0}' scene file\nError: Wrong File, it has no 'KaimosScene' node", filepath);
+			KS_ERROR("Error Converting '{0}' scene file into '{1}'\nError: Couldn't write it", src_filepath, dst_filepath);
 			return false;
 		}
 
-		// -- Scene Setup --
-		std::string scene_name = data["KaimosScene"].as<std::string>();
-		KS_TRACE("Deserializing scene '{0}'", scene_name);
-		m_Scene->SetName(scene_name);
-		m_Scene->SetPath(filepath);
+		KS_TRACE("Converted '{0}' scene file into '{1}' ({2} Entities)", src_filepath, dst_filepath, data.Entities.size());
+		return true;
+	}
 
-		if (data["SceneColor"])
-			Renderer::SetSceneColor(data["SceneColor"].as<glm::vec3>());
 
-		if (data["CamUIDisplay"])
-			Renderer::SetCameraUIDisplayOption(data["CamUIDisplay"].as<uint>());
+	bool SceneSerializer::IsBinaryScene(const std::string& filepath)
+	{
+		return std::filesystem::path(filepath).extension().string() == s_BinarySceneExtension;
+	}
 
-		if (data["PBRPipeline"])
-			Renderer::SetPBRPipeline(data["PBRPipeline"].as<bool>());
-		else
-			Renderer::SetPBRPipeline(false);
 
-		if (data["EnvironmentMapTexture"])
-		{
-			std::string filepath = data["EnvironmentMapTexture"].as<std::string>();
-			if (!filepath.empty())
+
+	// ----------------------- Public Snapshot Methods ---------------------------------------------------
+	Ref<SceneSnapshot> SceneSerializer::TakeSnapshot(const SceneSnapshot* previous) const
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- Gather Entities --
+		SceneData data;
+		std::vector<Ref<std::vector<Vertex>>> meshes_vertices;
+		m_Scene->m_Registry.each([&](auto entityID)
 			{
-				uint map_res = data["EnviroMapRes"] ? data["EnviroMapRes"].as<uint>() : 1024;
-				uint pref_res = data["EnviroMapPrefRes"] ? data["EnviroMapPrefRes"].as<uint>() : 128;
-				uint irr_res = data["EnviroMapIrrRes"] ? data["EnviroMapIrrRes"].as<uint>() : 32;
+				Entity entity = { entityID, m_Scene.get() };
+				if (!entity)
+					return;
 
-				Renderer::SetEnvironmentMapFilepath(filepath, map_res, pref_res, irr_res);
-			}
+				GatherEntity(entity, data);
+				if (entity.HasComponent<MeshRendererComponent>())
+				{
+					const MeshRendererComponent& mesh_comp = entity.GetComponent<MeshRendererComponent>();
+					if (mesh_comp.ModifiedVertices && !mesh_comp.OwnsVertices)
+						meshes_vertices.push_back(mesh_comp.ModifiedVertices);
+				}
+			});
+
+		// -- Create Snapshot --
+		// Vertices are shared by many meshes, they are kept once
+		std::sort(meshes_vertices.begin(), meshes_vertices.end());
+		meshes_vertices.erase(std::unique(meshes_vertices.begin(), meshes_vertices.end()), meshes_vertices.end());
+
+		Ref<SceneSnapshot> snapshot = CreateRef<SceneSnapshot>(data, previous);
+		snapshot->KeepVertices(std::move(meshes_vertices));
+		return snapshot;
+	}
+
+
+	void SceneSerializer::RestoreSnapshot(const SceneSnapshot& snapshot) const
+	{
+		KS_PROFILE_FUNCTION();
+
+		SceneData data;
+		snapshot.GetData(data);
+
+		// -- Replace Entities --
+		// The registry is empty after clearing it, so the entities are created again with their same IDs (and versions)
+		m_Scene->UnsetPrimaryCamera();
+		m_Scene->m_Registry.clear();
+		ApplySceneEntities(data, true);
+
+		KS_TRACE("Restored {0} Entities of '{1}' Scene", data.Entities.size(), m_Scene->GetName());
+	}
+
+
+
+	// ----------------------- Private Scene Data Methods ------------------------------------------------
+	void SceneSerializer::GatherSceneData(SceneData& data) const
+	{
+		KS_PROFILE_FUNCTION();
+		GatherSceneSettings(data);
+
+		m_Scene->m_Registry.each([&](auto entityID)
+			{
+				Entity entity = { entityID, m_Scene.get() };
+				if (entity)
+					GatherEntity(entity, data);
+			});
+	}
+
+
+	void SceneSerializer::GatherSceneSettings(SceneData& data) const
+	{
+		KS_PROFILE_FUNCTION();
+		const CameraController& camera_control = m_Scene->GetEditorCamera();
+		const Camera& camera = m_Scene->GetEditorCamera().GetCamera();
+
+		// -- Scene Settings --
+		data.Name = m_Scene->GetName();
+		data.SceneColor = Renderer::GetSceneColor();
+		data.CameraUIDisplay = Renderer::GetCameraUIDisplayOption();
+		data.PBRPipeline = Renderer::IsSceneInPBRPipeline();
+		data.EnvironmentMap = Renderer::GetEnvironmentMapFilepath();
+		data.EnviroMapResolution = Renderer::GetEnvironmentMapResolution();
+		data.EnviroPrefilterResolution = Renderer::GetEnviroPrefilterMapResolution();
+		data.EnviroIrradianceResolution = Renderer::GetEnviroIrradianceMapResolution();
+
+		// -- Editor Camera --
+		EditorCameraRecord editor_camera;
+		editor_camera.Position = camera_control.GetPosition();
+		editor_camera.Rotation = camera_control.GetOrientationAngles();
+		editor_camera.MoveSpeed = camera_control.m_MoveSpeed;
+		editor_camera.SpeedMultiplier = camera_control.GetSpeedMultiplier();
+		editor_camera.MaxSpeedMultiplier = camera_control.m_MaxSpeedMultiplier;
+		editor_camera.RotationSpeed = camera_control.m_RotationSpeed;
+		editor_camera.RotationLocked = camera_control.IsRotationLocked();
+		editor_camera.PanSpeed = camera_control.m_PanSpeed;
+		editor_camera.AdvanceSpeed = camera_control.m_AdvanceCameraSpeed;
+		editor_camera.Zoom = camera_control.m_ZoomLevel;
+		editor_camera.MaxZoomSpeed = camera_control.m_MaxZoomSpeed;
+		editor_camera.FOV = camera.GetFOV();
+		editor_camera.NearPlane = camera.GetNearPlane();
+		editor_camera.FarPlane = camera.GetFarPlane();
+		data.EditorCamera = editor_camera;
+	}
+
+
+	void SceneSerializer::ApplySceneData(const SceneData& data) const
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- Scene Setup --
+		KS_TRACE("Deserializing scene '{0}'", data.Name);
+		m_Scene->SetName(data.Name);
+
+		if (data.SceneColor)
+			Renderer::SetSceneColor(*data.SceneColor);
+
+		if (data.CameraUIDisplay)
+			Renderer::SetCameraUIDisplayOption(*data.CameraUIDisplay);
+
+		Renderer::SetPBRPipeline(data.PBRPipeline);
+
+		if (data.EnvironmentMap)
+		{
+			if (!data.EnvironmentMap->empty())
+				Renderer::SetEnvironmentMapFilepath(*data.EnvironmentMap, data.EnviroMapResolution, data.EnviroPrefilterResolution, data.EnviroIrradianceResolution);
 			else
 				KS_ENGINE_TRACE("Scene has no Environment Map to load");
 		}
@@ -279,173 +753,302 @@ namespace Kaimos {
 			Renderer::RemoveEnvironmentMap();
 
 		// -- Deserialize Editor Camera --
-		YAML::Node camera_node = data["EditorCamera"];
-		if (camera_node)
+		if (data.EditorCamera)
 		{
-			auto cam_values = camera_node[0];
+			const EditorCameraRecord& cam_values = *data.EditorCamera;
 
-			m_Scene->GetEditorCamera().SetPosition(cam_values["CameraPos"].as<glm::vec3>());
-			m_Scene->GetEditorCamera().SetOrientation(cam_values["CameraRot"].as<glm::vec2>());
+			m_Scene->GetEditorCamera().SetPosition(cam_values.Position);
+			m_Scene->GetEditorCamera().SetOrientation(cam_values.Rotation);
 
-			m_Scene->GetEditorCamera().SetMoveSpeed(cam_values["CameraMovSpeed"].as<float>());
-			m_Scene->GetEditorCamera().SetSpeedMultiplier(cam_values["CameraSpeedMulti"].as<float>());
-			m_Scene->GetEditorCamera().m_MaxSpeedMultiplier = cam_values["MaxSpeedMultiplier"].as<float>();
-			m_Scene->GetEditorCamera().SetRotationSpeed(cam_values["CameraRotSpeed"].as<float>());
+			m_Scene->GetEditorCamera().SetMoveSpeed(cam_values.MoveSpeed);
+			m_Scene->GetEditorCamera().SetSpeedMultiplier(cam_values.SpeedMultiplier);
+			m_Scene->GetEditorCamera().m_MaxSpeedMultiplier = cam_values.MaxSpeedMultiplier;
+			m_Scene->GetEditorCamera().SetRotationSpeed(cam_values.RotationSpeed);
 
-			m_Scene->GetEditorCamera().LockRotation(cam_values["CameraRotLock"].as<bool>());
-			m_Scene->GetEditorCamera().m_PanSpeed = cam_values["CameraPanSpeed"].as<float>();
-			m_Scene->GetEditorCamera().m_AdvanceCameraSpeed = cam_values["CameraAdvanceSpeed"].as<float>();
+			m_Scene->GetEditorCamera().LockRotation(cam_values.RotationLocked);
+			m_Scene->GetEditorCamera().m_PanSpeed = cam_values.PanSpeed;
+			m_Scene->GetEditorCamera().m_AdvanceCameraSpeed = cam_values.AdvanceSpeed;
 
-			m_Scene->GetEditorCamera().SetZoomLevel(cam_values["CameraZoom"].as<float>());
-			m_Scene->GetEditorCamera().SetMaxZoomSpeed(cam_values["CameraMaxZoom"].as<float>()); //TODO: change name
+			m_Scene->GetEditorCamera().SetZoomLevel(cam_values.Zoom);
+			m_Scene->GetEditorCamera().SetMaxZoomSpeed(cam_values.MaxZoomSpeed); //TODO: change name
 
-			m_Scene->GetEditorCamera().m_Camera.SetFOV(cam_values["CameraFOV"].as<float>());
-			m_Scene->GetEditorCamera().m_Camera.SetNearPlane(cam_values["CameraNPlane"].as<float>());
-			m_Scene->GetEditorCamera().m_Camera.SetFarPlane(cam_values["CameraFPlane"].as<float>());
+			m_Scene->GetEditorCamera().m_Camera.SetFOV(cam_values.FOV);
+			m_Scene->GetEditorCamera().m_Camera.SetNearPlane(cam_values.NearPlane);
+			m_Scene->GetEditorCamera().m_Camera.SetFarPlane(cam_values.FarPlane);
 		}
-		
 
-		// -- Entities Load --
-		uint entities_deserialized = 0;
-		YAML::Node entities = data["Entities"];
-		if (entities)
+		ApplySceneEntities(data);
+	}
+
+
+	void SceneSerializer::ApplySceneEntities(const SceneData& data, bool exact_ids) const
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- Create Entities --
+		entt::registry& registry = m_Scene->m_Registry;
+		std::vector<entt::entity> entities(data.Entities.size());
+		for (size_t i = 0; i < entities.size(); ++i)
+		{
+			uint id = data.Entities[i] == 0 && !exact_ids ? (uint)Random::GetRandomInt() : data.Entities[i];
+			entities[i] = registry.create(entt::entity{ id });
+		}
+
+		// -- Insert Components (a whole array of each type at once) --
+		// Every entity has a tag and a transform (as when created), even if the file doesn't have them
+		registry.insert<TagComponent>(entities.begin(), entities.end(), TagComponent(""));
+		registry.insert<TransformComponent>(entities.begin(), entities.end());
+
+		for (const TagRecord& record : data.Tags)
 		{
-			for (auto entity : entities)
+			TagComponent& tag_comp = registry.get<TagComponent>(entities[record.Entity]);
+			tag_comp.Tag = data.GetTagName(record);
+			tag_comp.DuplicationCount = record.DuplicationCount;
+		}
+
+		for (const TransformRecord& record : data.Transforms)
+		{
+			TransformComponent& transform_comp = registry.get<TransformComponent>(entities[record.Entity]);
+			transform_comp.EntityActive = record.EntityActive;
+			transform_comp.Translation = record.Translation;
+			transform_comp.Rotation = record.Rotation;
+			transform_comp.Scale = record.Scale;
+		}
+
+		InsertComponents<CameraComponent>(registry, entities, data.Cameras, [](const CameraRecord& record, CameraComponent& cam_comp)
 			{
-				++entities_deserialized;
-				uint entity_id = entity["Entity"].as<uint>();
-				
-				std::string name;
-				uint duplication_count = 1;
-				auto tag_component = entity["TagComponent"];
-				if (tag_component)
-				{
-					name = tag_component["Tag"].as<std::string>();
-					duplication_count = tag_component["DuplicationCount"].as<uint>();
-				}
+				if (record.ProjectionType == static_cast<int>(Kaimos::CAMERA_PROJECTION::ORTHOGRAPHIC))
+					cam_comp.Camera.SetOrthographicParameters();
+				else
+					cam_comp.Camera.SetPerspectiveParameters();
+
+				cam_comp.Camera.SetViewport(record.ViewSize.x, record.ViewSize.y);
+				cam_comp.Camera.SetFOV(record.FOV);
+				cam_comp.Camera.SetNearPlane(record.NearClip);
+				cam_comp.Camera.SetFarPlane(record.FarClip);
+				cam_comp.Camera.SetSize(record.OrthoSize);
+
+				cam_comp.Primary = record.Primary;
+				cam_comp.FixedAspectRatio = record.FixedAR;
+			});
 
-				KS_TRACE("Deserialized Entity '{0}' (ID: {1})", name, entity_id);
-				Entity deserialized_entity = m_Scene->CreateEntity(name, entity_id);
-				deserialized_entity.GetComponent<TagComponent>().DuplicationCount = duplication_count;
+		InsertComponents<DirectionalLightComponent>(registry, entities, data.DirectionalLights, [](const DirectionalLightRecord& record, DirectionalLightComponent& light_comp)
+			{
+				light_comp.Light = CreateRef<Light>();
+				light_comp.Visible = record.Visible;
+				light_comp.SetComponentValues(record.StoredFalloff, record.StoredMinRadius, record.StoredMaxRadius);
+				light_comp.SetLightValues(record.Radiance, record.Intensity, record.SpecularStrength);
+			});
 
-				YAML::Node transform_node = entity["TransformComponent"];
-				if (transform_node)
-				{
-					TransformComponent& transform_comp = deserialized_entity.GetComponent<TransformComponent>();
+		InsertComponents<PointLightComponent>(registry, entities, data.PointLights, [](const PointLightRecord& record, PointLightComponent& light_comp)
+			{
+				light_comp.Light = CreateRef<PointLight>();
+				light_comp.Visible = record.Visible;
+				light_comp.SetLightValues(record.Radiance, record.Intensity, record.SpecularStrength);
+				light_comp.SetPointLightValues(record.FalloffMultiplier, record.MinRadius, record.MaxRadius);
+			});
 
-					transform_comp.EntityActive = transform_node["EntityActive"].as<bool>();
-					transform_comp.Translation = transform_node["Translation"].as<glm::vec3>();
-					transform_comp.Rotation = transform_node["Rotation"].as<glm::vec3>();
-					transform_comp.Scale = transform_node["Scale"].as<glm::vec3>();
-				}
+		// Vertices aren't evaluated here, but after all the components are inserted
+		InsertComponents<SpriteRendererComponent>(registry, entities, data.Sprites, [](const SpriteRecord& record, SpriteRendererComponent& sprite_comp)
+			{
+				sprite_comp.SpriteMaterialID = GetDeserializedMaterial(record.MaterialID);
+			});
 
-				YAML::Node cameracomp_node = entity["CameraComponent"];
-				if (cameracomp_node)
-				{
-					CameraComponent& cam_comp = deserialized_entity.AddComponent<CameraComponent>();
-					YAML::Node& camera_node = cameracomp_node["Camera"];
+		InsertComponents<MeshRendererComponent>(registry, entities, data.Meshes, [](const MeshRecord& record, MeshRendererComponent& mesh_comp)
+			{
+				mesh_comp.MeshID = Resources::ResourceManager::MeshExists(record.MeshID) ? record.MeshID : 0;
+				mesh_comp.MaterialID = GetDeserializedMaterial(record.MaterialID);
+			});
 
-					if (camera_node["ProjectionType"].as<int>() == static_cast<int>(Kaimos::CAMERA_PROJECTION::ORTHOGRAPHIC))
-						cam_comp.Camera.SetOrthographicParameters();
-					else
-						cam_comp.Camera.SetPerspectiveParameters();
+		BindRendererVertices(registry, entities, data);
 
-					glm::vec2 cam_view_size = camera_node["ViewSize"].as<glm::vec2>();
-					cam_comp.Camera.SetViewport(cam_view_size.x, cam_view_size.y);
+		// -- Set Primary Camera --
+		for (const CameraRecord& record : data.Cameras)
+		{
+			if (record.Primary)
+				m_Scene->SetPrimaryCamera({ entities[record.Entity], m_Scene.get() });
+		}
+	}
 
-					cam_comp.Camera.SetFOV(camera_node["FOV"].as<float>());
-					cam_comp.Camera.SetNearPlane(camera_node["NearClip"].as<float>());
-					cam_comp.Camera.SetFarPlane(camera_node["FarClip"].as<float>());
-					cam_comp.Camera.SetSize(camera_node["OrthoSize"].as<float>());
 
-					cam_comp.Primary = cameracomp_node["PrimaryCamera"].as<bool>();
-					cam_comp.FixedAspectRatio = cameracomp_node["FixedAR"].as<bool>();
 
-					if(cam_comp.Primary)
-						m_Scene->SetPrimaryCamera(deserialized_entity);
-				}
+	// ----------------------- Private Formats Methods ---------------------------------------------------
+	bool SceneSerializer::ReadSceneFile(SceneData& data, const std::string& filepath)
+	{
+		return IsBinaryScene(filepath) ? ReadBinary(data, filepath) : ReadYAML(data, filepath);
+	}
 
-				YAML::Node dirlightcomp_node = entity["DirectionalLightComponent"];
-				if (dirlightcomp_node)
-				{
-					DirectionalLightComponent& light_comp = deserialized_entity.AddComponent<DirectionalLightComponent>();
-					YAML::Node& light_node = dirlightcomp_node["Light"];
 
-					glm::vec4 radiance = light_node["Radiance"].as<glm::vec4>();
-					float intensity = light_node["Intensity"].as<float>();
-					float specular_strength = light_node["SpecularStrength"].as<float>();
+	bool SceneSerializer::WriteSceneFile(const SceneData& data, const std::string& filepath)
+	{
+		return IsBinaryScene(filepath) ? WriteBinary(data, filepath) : WriteYAML(data, filepath);
+	}
 
-					float min_rad = dirlightcomp_node["StoredLightMinRadius"].as<float>();
-					float max_rad = dirlightcomp_node["StoredLightMaxRadius"].as<float>();
-					float falloff = dirlightcomp_node["StoredLightFalloff"].as<float>();
 
-					light_comp.Visible = dirlightcomp_node["Visible"].as<bool>();
-					light_comp.SetComponentValues(falloff, min_rad, max_rad);
-					light_comp.SetLightValues(radiance, intensity, specular_strength);
-				}
 
-				YAML::Node pointlightcomp_node = entity["PointLightComponent"];
-				if (pointlightcomp_node)
-				{
-					PointLightComponent& light_comp = deserialized_entity.AddComponent<PointLightComponent>();
-					YAML::Node& light_node = pointlightcomp_node["Light"];
-
-					glm::vec4 radiance = light_node["Radiance"].as<glm::vec4>();
-					float intensity = light_node["Intensity"].as<float>();
-					float specular_strength = light_node["SpecularStrength"].as<float>();
-					float falloff = light_node["FalloffMultiplier"].as<float>();
-					float min_rad = light_node["MinRadius"].as<float>();
-					float max_rad = light_node["MaxRadius"].as<float>();
-
-					light_comp.Visible = pointlightcomp_node["Visible"].as<bool>();
-					light_comp.SetLightValues(radiance, intensity, specular_strength);
-					light_comp.SetPointLightValues(falloff, min_rad, max_rad);
-				}
+	// ----------------------- Private YAML Methods ------------------------------------------------------
+	bool SceneSerializer::ReadYAML(SceneData& data, const std::string& filepath)
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- File Load (entities are deserialized in chunks by the Job System while the file is parsed) --
+		std::deque<EntitiesChunk> chunks(1);
+
+		// Jobs point into the chunks, so they are waited on every way out of here (also if the parser throws)
+		struct ChunksJobsGuard { ~ChunksJobsGuard() { JobSystem::Wait(); } } chunks_jobs_guard;
 
-				YAML::Node sprite_node = entity["SpriteRendererComponent"];
-				if (sprite_node)
+		uint pending_chunks = 0;
+		auto on_entity = [&chunks, &pending_chunks](const YAML::Node& entity, const YAML::Node& root)
+		{
+			chunks.back().Nodes.push_back(entity);
+			if (chunks.back().Nodes.size() == s_EntitiesPerChunk)
+			{
+				// The parser can outrun the workers, so it waits for them before queueing too many chunks (and their nodes)
+				if (pending_chunks == s_MaxPendingChunks)
 				{
-					uint mat_node = sprite_node["Material"].as<uint>();
-					uint mat_id = Renderer::GetMaterialIfExists(mat_node);					
-					if (mat_id == 0)
-					{
-						uint def_mat_id = Renderer::GetDefaultMaterialID();
-						if (def_mat_id != 0)
-							mat_id = def_mat_id;
-						else
-							mat_id = Renderer::CreateMaterial("Unnamed")->GetID();
-					}
-					
-					SpriteRendererComponent& sprite_comp = deserialized_entity.AddComponent<SpriteRendererComponent>();
-					sprite_comp.SetMaterial(mat_id);
+					JobSystem::Wait();
+					pending_chunks = 0;
 				}
 
-				YAML::Node mesh_node = entity["MeshRendererComponent"];
-				if (mesh_node)
-				{
-					uint mat_node = mesh_node["Material"].as<uint>();
-					uint mesh_id_node = mesh_node["Mesh"].as<uint>();
-					if (!Resources::ResourceManager::MeshExists(mesh_id_node))
-						mesh_id_node = 0;
+				EntitiesChunk* chunk = &chunks.back();
+				JobSystem::Execute([chunk]() { DeserializeEntitiesChunk(*chunk); });
+				chunks.emplace_back();
+				++pending_chunks;
+			}
+		};
 
-					uint mat_id = Renderer::GetMaterialIfExists(mat_node);
-					if (mat_id == 0)
-					{
-						uint def_mat_id = Renderer::GetDefaultMaterialID();
-						if (def_mat_id != 0)
-							mat_id = def_mat_id;
-						else
-							mat_id = Renderer::CreateMaterial("Unnamed")->GetID();
-					}
-
-					MeshRendererComponent& mesh_comp = deserialized_entity.AddComponent<MeshRendererComponent>();
-					mesh_comp.SetMesh(mesh_id_node);
-					mesh_comp.SetMaterial(mat_id);
-				}
+		YAML::Node file_data;
+		try { file_data = LoadYAMLFileStreamed(filepath, "Entities", on_entity); }
+		catch (const YAML::ParserException& exception)
+		{
+			KS_ERROR("Error Loading '{0}' scene file\nError: {1}", filepath, exception.what());
+			return false;
+		}
+
+		// -- Gather Chunks (in order, so the entities keep the file's one) --
+		// The records of every entity are still held until the scene is applied, only the YAML nodes are dropped while parsing
+		DeserializeEntitiesChunk(chunks.back());
+		JobSystem::Wait();
+
+		for (EntitiesChunk& chunk : chunks)
+		{
+			if (!chunk.Error.empty())
+			{
+				KS_ERROR("Error Loading '{0}' scene file\nError: {1}", filepath, chunk.Error);
+				return false;
 			}
+
+			data.AppendEntities(chunk.Data);
+			chunk.Data = SceneData();		// Each chunk is released once appended, so its records aren't held twice
+		}
+
+		if (!file_data["KaimosScene"])
+		{
+			KS_ERROR("Error Loading '{0}' scene file\nError: Wrong File, it has no 'KaimosScene' node", filepath);
+			return false;
+		}
+
+		// -- Scene Settings --
+		data.Name = file_data["KaimosScene"].as<std::string>();
+
+		if (file_data["SceneColor"])
+			data.SceneColor = file_data["SceneColor"].as<glm::vec3>();
+
+		if (file_data["CamUIDisplay"])
+			data.CameraUIDisplay = file_data["CamUIDisplay"].as<uint>();
+
+		if (file_data["PBRPipeline"])
+			data.PBRPipeline = file_data["PBRPipeline"].as<bool>();
+
+		if (file_data["EnvironmentMapTexture"])
+		{
+			data.EnvironmentMap = file_data["EnvironmentMapTexture"].as<std::string>();
+			if (file_data["EnviroMapRes"])
+				data.EnviroMapResolution = file_data["EnviroMapRes"].as<uint>();
+			if (file_data["EnviroMapPrefRes"])
+				data.EnviroPrefilterResolution = file_data["EnviroMapPrefRes"].as<uint>();
+			if (file_data["EnviroMapIrrRes"])
+				data.EnviroIrradianceResolution = file_data["EnviroMapIrrRes"].as<uint>();
+		}
+
+		// -- Editor Camera --
+		YAML::Node camera_node = file_data["EditorCamera"];
+		if (camera_node)
+		{
+			auto cam_values = camera_node[0];
+
+			EditorCameraRecord editor_camera;
+			editor_camera.Position = cam_values["CameraPos"].as<glm::vec3>();
+			editor_camera.Rotation = cam_values["CameraRot"].as<glm::vec2>();
+			editor_camera.MoveSpeed = cam_values["CameraMovSpeed"].as<float>();
+			editor_camera.SpeedMultiplier = cam_values["CameraSpeedMulti"].as<float>();
+			editor_camera.MaxSpeedMultiplier = cam_values["MaxSpeedMultiplier"].as<float>();
+			editor_camera.RotationSpeed = cam_values["CameraRotSpeed"].as<float>();
+			editor_camera.RotationLocked = cam_values["CameraRotLock"].as<bool>();
+			editor_camera.PanSpeed = cam_values["CameraPanSpeed"].as<float>();
+			editor_camera.AdvanceSpeed = cam_values["CameraAdvanceSpeed"].as<float>();
+			editor_camera.Zoom = cam_values["CameraZoom"].as<float>();
+			editor_camera.MaxZoomSpeed = cam_values["CameraMaxZoom"].as<float>();
+			editor_camera.FOV = cam_values["CameraFOV"].as<float>();
+			editor_camera.NearPlane = cam_values["CameraNPlane"].as<float>();
+			editor_camera.FarPlane = cam_values["CameraFPlane"].as<float>();
+			data.EditorCamera = editor_camera;
 		}
 
-		KS_TRACE("Finished Deserializing {0} Entities in '{1}' Scene", entities_deserialized, m_Scene->GetName());
 		return true;
 	}
+
+
+	bool SceneSerializer::WriteYAML(const SceneData& data, const std::string& filepath)
+	{
+		KS_PROFILE_FUNCTION();
+
+		// The emitter writes into a temporary file as it goes, so a failed save never truncates the scene file
+		std::ofstream file(GetYAMLTempFilepath(filepath), std::ios::trunc);
+		if (!file.good())
+			return false;
+
+		YAML::Emitter output(file);
+		BeginYAMLScene(output, data);
+
+		std::array<size_t, 7> cursors = {};
+		for (uint i = 0; i < data.Entities.size(); ++i)
+			SerializeEntity(output, data, i, cursors);
+
+		EndYAMLScene(output);
+		return CommitYAMLFile(file, filepath, output.good());
+	}
+
+
+	bool SceneSerializer::WriteSceneYAML(const std::string& filepath, uint& entities_serialized) const
+	{
+		KS_PROFILE_FUNCTION();
+		std::ofstream file(GetYAMLTempFilepath(filepath), std::ios::trunc);
+		if (!file.good())
+			return false;
+
+		YAML::Emitter output(file);
+
+		SceneData data;
+		GatherSceneSettings(data);
+		BeginYAMLScene(output, data);
+
+		// Each entity is gathered and written on its own, so the memory used doesn't grow with the scene
+		m_Scene->m_Registry.each([&](auto entityID)
+			{
+				Entity entity = { entityID, m_Scene.get() };
+				if (!entity)
+					return;
+
+				data.ClearEntities();
+				GatherEntity(entity, data);
+
+				std::array<size_t, 7> cursors = {};
+				SerializeEntity(output, data, 0, cursors);
+				++entities_serialized;
+			});
+
+		EndYAMLScene(output);
+		return CommitYAMLFile(file, filepath, output.good());
+	}
 }
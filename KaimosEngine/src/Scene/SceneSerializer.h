@@ -5,6 +5,8 @@
 
 namespace Kaimos {
 
+	struct SceneData;
+	class SceneSnapshot;
 	class CameraController;
 	class SceneSerializer
 	{
@@ -14,11 +16,47 @@ namespace Kaimos {
 		SceneSerializer(const Ref<Scene>& scene) : m_Scene(scene) {}
 
 		// --- Public Serialization Methods ---
+		// Scene files are YAML (.kaimos), or binary if their extension is the binary one (.kaimosb)
 		void Serialize(const std::string& filepath) const;
 
 		// --- Public Deserialization Methods ---
 		bool Deserialize(const std::string& filepath) const;
 
+		// --- Public Conversion Methods ---
+		// Converts a scene file into the other format (given by the extensions), without loading it into any scene
+		static bool ConvertScene(const std::string& src_filepath, const std::string& dst_filepath);
+		static bool IsBinaryScene(const std::string& filepath);
+
+		// --- Public Snapshot Methods ---
+		// Snapshots only have the scene entities & components, restoring one replaces the scene entities but keeps its settings
+		Ref<SceneSnapshot> TakeSnapshot(const SceneSnapshot* previous = nullptr) const;
+		void RestoreSnapshot(const SceneSnapshot& snapshot) const;
+
+	private:
+
+		// --- Private Scene Data Methods ---
+		void GatherSceneData(SceneData& data) const;
+		void GatherSceneSettings(SceneData& data) const;
+		void ApplySceneData(const SceneData& data) const;
+
+		// Entities with a null ID (0) get a random one, unless exact_ids is set (like when restoring a snapshot)
+		void ApplySceneEntities(const SceneData& data, bool exact_ids = false) const;
+
+		// Writes the scene as YAML while gathering it, one entity at a time
+		bool WriteSceneYAML(const std::string& filepath, uint& entities_serialized) const;
+
+		// --- Private Formats Methods ---
+		static bool ReadSceneFile(SceneData& data, const std::string& filepath);
+		static bool WriteSceneFile(const SceneData& data, const std::string& filepath);
+
+		// YAML scene files are parsed and written as streams, entity by entity
+		static bool ReadYAML(SceneData& data, const std::string& filepath);
+		static bool WriteYAML(const SceneData& data, const std::string& filepath);
+
+		// Binary scene files have a contiguous array per component type, and are mapped to read them
+		static bool ReadBinary(SceneData& data, const std::string& filepath);
+		static bool WriteBinary(const SceneData& data, const std::string& filepath);
+
 	private:
 		Ref<Scene> m_Scene;
 	};
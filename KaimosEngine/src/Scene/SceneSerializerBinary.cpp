@@ -0,0 +1,305 @@
+#include "kspch.h"
+#include "SceneSerializer.h"
+#include "SceneData.h"
+
+#include "Core/Utils/PlatformUtils.h"
+
+#include <type_traits>
+
+
+namespace Kaimos {
+
+	// ----------------------- Globals -------------------------------------------------------------------
+	// --- Binary Scene File (.kaimosb) ---
+	// Header, then a table of sections and the sections: the entities IDs, the strings and a contiguous array of records
+	// per component type, aligned so the file can be mapped and its arrays read in place
+	// Unknown sections are skipped. Bump the version when changing any of this or any record of SceneData.h
+	static constexpr char s_SceneMagic[4] = { 'K', 'S', 'C', 'N' };
+	static constexpr uint s_SceneVersion = 1;
+	static constexpr uint64_t s_SceneAlignment = 16;
+
+	enum class SCENE_SECTION { ENTITIES = 0, TAGS_NAMES, SETTINGS_STRINGS, TAGS, TRANSFORMS, CAMERAS, DIRECTIONAL_LIGHTS, POINT_LIGHTS, SPRITES, MESHES };
+
+	// Optional scene settings in the file
+	enum SCENE_SETTINGS_FLAGS
+	{
+		SCENE_COLOR = BIT(0), CAMERA_UI_DISPLAY = BIT(1), ENVIRONMENT_MAP = BIT(2), EDITOR_CAMERA = BIT(3), PBR_PIPELINE = BIT(4)
+	};
+
+	struct SceneFileHeader
+	{
+		char Magic[4] = {};
+		uint Version = 0;
+		uint SettingsFlags = 0, SectionsCount = 0;
+
+		// Scene Settings (strings are in the settings strings section)
+		uint NameLength = 0, EnvironmentMapLength = 0;
+		uint CameraUIDisplay = 0;
+		uint EnviroMapResolution = 0, EnviroPrefilterResolution = 0, EnviroIrradianceResolution = 0;
+		glm::vec3 SceneColor = glm::vec3(0.0f);
+		EditorCameraRecord EditorCamera = {};
+	};
+
+	struct SceneFileSection
+	{
+		uint Type = 0, RecordSize = 0;
+		uint64_t Offset = 0, Count = 0;
+	};
+
+	static_assert(std::is_trivially_copyable_v<TagRecord> && std::is_trivially_copyable_v<TransformRecord> && std::is_trivially_copyable_v<CameraRecord>
+		&& std::is_trivially_copyable_v<DirectionalLightRecord> && std::is_trivially_copyable_v<PointLightRecord> && std::is_trivially_copyable_v<SpriteRecord>
+		&& std::is_trivially_copyable_v<MeshRecord> && std::is_trivially_copyable_v<EditorCameraRecord>, "Scene records are written & read as they are");
+
+
+	static uint64_t AlignSceneOffset(uint64_t offset)
+	{
+		return (offset + s_SceneAlignment - 1) & ~(s_SceneAlignment - 1);
+	}
+
+	template<typename T>
+	static std::pair<SceneFileSection, const void*> GetFileSection(SCENE_SECTION type, const T* records, size_t count)
+	{
+		SceneFileSection section;
+		section.Type = (uint)type;
+		section.RecordSize = sizeof(T);
+		section.Count = count;
+		return { section, records };
+	}
+
+	// Copies the section records (the file is unmapped after reading it), false if they aren't of the expected type
+	template<typename T>
+	static bool ReadFileSection(const char* file_data, const SceneFileSection& section, std::vector<T>& records)
+	{
+		if (section.RecordSize != sizeof(T))
+			return false;
+
+		const T* section_records = (const T*)(file_data + section.Offset);
+		records.assign(section_records, section_records + section.Count);
+		return true;
+	}
+
+	// Records must point to existing entities and be sorted by them, with one record per entity at most
+	template<typename T>
+	static bool CheckRecords(const std::vector<T>& records, size_t entities_count)
+	{
+		for (size_t i = 0; i < records.size(); ++i)
+		{
+			if (records[i].Entity >= entities_count || (i > 0 && records[i].Entity <= records[i - 1].Entity))
+				return false;
+		}
+
+		return true;
+	}
+
+
+
+	// ----------------------- Private Binary Methods ----------------------------------------------------
+	bool SceneSerializer::ReadBinary(SceneData& data, const std::string& filepath)
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- Map File --
+		MappedFile file;
+		if (!file.Open(filepath) || file.GetSize() < sizeof(SceneFileHeader))
+		{
+			KS_ERROR("Error Loading '{0}' scene file\nError: Couldn't read it", filepath);
+			return false;
+		}
+
+		const char* file_data = (const char*)file.GetData();
+		const SceneFileHeader* header = (const SceneFileHeader*)file_data;
+		const uint64_t file_size = file.GetSize();
+
+		// -- Check it's Valid --
+		if (memcmp(header->Magic, s_SceneMagic, sizeof(s_SceneMagic)) != 0)
+		{
+			KS_ERROR("Error Loading '{0}' scene file\nError: Wrong File, it's not a binary Kaimos scene", filepath);
+			return false;
+		}
+
+		if (header->Version != s_SceneVersion)
+		{
+			KS_ERROR("Error Loading '{0}' scene file\nError: Binary scene version {1} isn't supported (current one is {2})", filepath, header->Version, s_SceneVersion);
+			return false;
+		}
+
+		if (sizeof(SceneFileHeader) + (uint64_t)header->SectionsCount * sizeof(SceneFileSection) > file_size)
+		{
+			KS_ERROR("Error Loading '{0}' scene file\nError: The file is corrupted", filepath);
+			return false;
+		}
+
+		// -- Read Sections --
+		std::string settings_strings;
+		bool valid = true;
+
+		const SceneFileSection* sections = (const SceneFileSection*)(file_data + sizeof(SceneFileHeader));
+		for (uint i = 0; i < header->SectionsCount && valid; ++i)
+		{
+			const SceneFileSection& section = sections[i];
+			if (section.RecordSize == 0 || section.Offset > file_size || section.Count > (file_size - section.Offset) / section.RecordSize)
+			{
+				valid = false;
+				break;
+			}
+
+			switch ((SCENE_SECTION)section.Type)
+			{
+				case SCENE_SECTION::ENTITIES:			valid = ReadFileSection(file_data, section, data.Entities); break;
+				case SCENE_SECTION::TAGS:				valid = ReadFileSection(file_data, section, data.Tags); break;
+				case SCENE_SECTION::TRANSFORMS:			valid = ReadFileSection(file_data, section, data.Transforms); break;
+				case SCENE_SECTION::CAMERAS:			valid = ReadFileSection(file_data, section, data.Cameras); break;
+				case SCENE_SECTION::DIRECTIONAL_LIGHTS:	valid = ReadFileSection(file_data, section, data.DirectionalLights); break;
+				case SCENE_SECTION::POINT_LIGHTS:		valid = ReadFileSection(file_data, section, data.PointLights); break;
+				case SCENE_SECTION::SPRITES:			valid = ReadFileSection(file_data, section, data.Sprites); break;
+				case SCENE_SECTION::MESHES:				valid = ReadFileSection(file_data, section, data.Meshes); break;
+
+				case SCENE_SECTION::TAGS_NAMES:
+					valid = section.RecordSize == 1;
+					data.Strings.assign(file_data + section.Offset, section.Count);
+					break;
+
+				case SCENE_SECTION::SETTINGS_STRINGS:
+					valid = section.RecordSize == 1;
+					settings_strings.assign(file_data + section.Offset, section.Count);
+					break;
+
+				default:
+					KS_ENGINE_TRACE("Skipping unknown section {0} of binary scene '{1}'", section.Type, filepath);
+			}
+		}
+
+		// -- Check Records & Strings --
+		const size_t entities_count = data.Entities.size();
+		valid = valid && (uint64_t)header->NameLength + header->EnvironmentMapLength <= settings_strings.size()
+			&& CheckRecords(data.Tags, entities_count) && CheckRecords(data.Transforms, entities_count) && CheckRecords(data.Cameras, entities_count)
+			&& CheckRecords(data.DirectionalLights, entities_count) && CheckRecords(data.PointLights, entities_count)
+			&& CheckRecords(data.Sprites, entities_count) && CheckRecords(data.Meshes, entities_count);
+
+		for (size_t i = 0; i < data.Tags.size() && valid; ++i)
+			valid = (uint64_t)data.Tags[i].NameOffset + data.Tags[i].NameLength <= data.Strings.size();
+
+		if (!valid)
+		{
+			KS_ERROR("Error Loading '{0}' scene file\nError: The file is corrupted", filepath);
+			return false;
+		}
+
+		// -- Scene Settings --
+		data.Name = settings_strings.substr(0, header->NameLength);
+		data.PBRPipeline = header->SettingsFlags & PBR_PIPELINE;
+		data.EnviroMapResolution = header->EnviroMapResolution;
+		data.EnviroPrefilterResolution = header->EnviroPrefilterResolution;
+		data.EnviroIrradianceResolution = header->EnviroIrradianceResolution;
+
+		if (header->SettingsFlags & SCENE_COLOR)
+			data.SceneColor = header->SceneColor;
+		if (header->SettingsFlags & CAMERA_UI_DISPLAY)
+			data.CameraUIDisplay = header->CameraUIDisplay;
+		if (header->SettingsFlags & ENVIRONMENT_MAP)
+			data.EnvironmentMap = settings_strings.substr(header->NameLength, header->EnvironmentMapLength);
+		if (header->SettingsFlags & EDITOR_CAMERA)
+			data.EditorCamera = header->EditorCamera;
+
+		return true;
+	}
+
+
+	bool SceneSerializer::WriteBinary(const SceneData& data, const std::string& filepath)
+	{
+		KS_PROFILE_FUNCTION();
+
+		// -- Setup Header --
+		SceneFileHeader header;
+		memcpy(header.Magic, s_SceneMagic, sizeof(s_SceneMagic));
+		header.Version = s_SceneVersion;
+		header.EnviroMapResolution = data.EnviroMapResolution;
+		header.EnviroPrefilterResolution = data.EnviroPrefilterResolution;
+		header.EnviroIrradianceResolution = data.EnviroIrradianceResolution;
+
+		std::string settings_strings = data.Name;
+		header.NameLength = (uint)data.Name.size();
+
+		if (data.PBRPipeline)
+			header.SettingsFlags |= PBR_PIPELINE;
+
+		if (data.SceneColor)
+		{
+			header.SettingsFlags |= SCENE_COLOR;
+			header.SceneColor = *data.SceneColor;
+		}
+
+		if (data.CameraUIDisplay)
+		{
+			header.SettingsFlags |= CAMERA_UI_DISPLAY;
+			header.CameraUIDisplay = *data.CameraUIDisplay;
+		}
+
+		if (data.EnvironmentMap)
+		{
+			header.SettingsFlags |= ENVIRONMENT_MAP;
+			header.EnvironmentMapLength = (uint)data.EnvironmentMap->size();
+			settings_strings += *data.EnvironmentMap;
+		}
+
+		if (data.EditorCamera)
+		{
+			header.SettingsFlags |= EDITOR_CAMERA;
+			header.EditorCamera = *data.EditorCamera;
+		}
+
+		// -- Setup Sections --
+		std::vector<std::pair<SceneFileSection, const void*>> sections = {
+			GetFileSection(SCENE_SECTION::ENTITIES, data.Entities.data(), data.Entities.size()),
+			GetFileSection(SCENE_SECTION::TAGS_NAMES, data.Strings.data(), data.Strings.size()),
+			GetFileSection(SCENE_SECTION::SETTINGS_STRINGS, settings_strings.data(), settings_strings.size()),
+			GetFileSection(SCENE_SECTION::TAGS, data.Tags.data(), data.Tags.size()),
+			GetFileSection(SCENE_SECTION::TRANSFORMS, data.Transforms.data(), data.Transforms.size()),
+			GetFileSection(SCENE_SECTION::CAMERAS, data.Cameras.data(), data.Cameras.size()),
+			GetFileSection(SCENE_SECTION::DIRECTIONAL_LIGHTS, data.DirectionalLights.data(), data.DirectionalLights.size()),
+			GetFileSection(SCENE_SECTION::POINT_LIGHTS, data.PointLights.data(), data.PointLights.size()),
+			GetFileSection(SCENE_SECTION::SPRITES, data.Sprites.data(), data.Sprites.size()),
+			GetFileSection(SCENE_SECTION::MESHES, data.Meshes.data(), data.Meshes.size())
+		};
+
+		header.SectionsCount = (uint)sections.size();
+		uint64_t offset = sizeof(SceneFileHeader) + sections.size() * sizeof(SceneFileSection);
+		for (std::pair<SceneFileSection, const void*>& section : sections)
+		{
+			section.first.Offset = AlignSceneOffset(offset);
+			offset = section.first.Offset + section.first.Count * section.first.RecordSize;
+		}
+
+		// -- Write File (into a temporary one, so a failed write never leaves a half scene behind) --
+		const std::string temp_filepath = filepath + ".tmp";
+		std::ofstream file(temp_filepath, std::ios::binary | std::ios::trunc);
+		if (!file.good())
+			return false;
+
+		static const char s_Padding[s_SceneAlignment] = {};
+		file.write((const char*)&header, sizeof(SceneFileHeader));
+		for (const std::pair<SceneFileSection, const void*>& section : sections)
+			file.write((const char*)&section.first, sizeof(SceneFileSection));
+
+		for (const std::pair<SceneFileSection, const void*>& section : sections)
+		{
+			file.write(s_Padding, section.first.Offset - (uint64_t)file.tellp());
+			file.write((const char*)section.second, section.first.Count * section.first.RecordSize);
+		}
+
+		bool written = file.good();
+		file.close();
+
+		std::error_code error;
+		if (written)
+			std::filesystem::rename(temp_filepath, filepath, error);
+
+		if (!written || error)
+		{
+			std::filesystem::remove(temp_filepath, error);
+			return false;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,163 @@
+#include "kspch.h"
+#include "SceneSnapshot.h"
+#include "SceneData.h"
+
+namespace Kaimos {
+
+	// ----------------------- Globals --------------------------------------------------------------------
+	// Bit of each component in the mask that starts the records of an entity slot, in the order they follow it
+	enum SNAPSHOT_COMPONENT : uint
+	{
+		TAG = 1 << 0, TRANSFORM = 1 << 1, CAMERA = 1 << 2, DIRECTIONAL_LIGHT = 1 << 3,
+		POINT_LIGHT = 1 << 4, SPRITE = 1 << 5, MESH = 1 << 6
+	};
+
+
+	// Records are stored with a 0 entity index, so an entity slot only differs from its previous one if its values do
+	template<typename Record>
+	static uint StoreRecord(const std::vector<Record>& records, uint entity_index, size_t& cursor, SNAPSHOT_COMPONENT component, std::vector<uint8_t>& page)
+	{
+		if (cursor >= records.size() || records[cursor].Entity != entity_index)
+			return 0;
+
+		Record record = records[cursor++];
+		record.Entity = 0;
+
+		const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&record);
+		page.insert(page.end(), bytes, bytes + sizeof(Record));
+		return component;
+	}
+
+
+	template<typename Record>
+	static void LoadRecord(const uint8_t*& bytes, uint mask, SNAPSHOT_COMPONENT component, uint entity_index, std::vector<Record>& records)
+	{
+		if ((mask & component) == 0)
+			return;
+
+		Record& record = records.emplace_back();
+		std::memcpy(&record, bytes, sizeof(Record));
+		record.Entity = entity_index;
+		bytes += sizeof(Record);
+	}
+
+
+
+	// ----------------------- Public Class Methods -------------------------------------------------------
+	SceneSnapshot::SceneSnapshot(const SceneData& data, const SceneSnapshot* previous)
+	{
+		KS_PROFILE_FUNCTION();
+		m_Changed = previous == nullptr || previous->m_Entities.size() != data.Entities.size();
+		m_Entities.reserve(data.Entities.size());
+
+		Page page;
+		std::array<size_t, 7> cursors = {};
+		for (uint i = 0; i < data.Entities.size(); ++i)
+		{
+			uint id = data.Entities[i];
+			StoreEntity(data, i, cursors, page);
+
+			// -- Share the Previous Snapshot Slot of the Entity if Equal --
+			if (previous)
+			{
+				auto previous_slot = std::lower_bound(previous->m_Entities.begin(), previous->m_Entities.end(), id,
+					[](const EntitySlot& slot, uint slot_id) { return slot.ID < slot_id; });
+
+				if (previous_slot != previous->m_Entities.end() && previous_slot->ID == id && *previous_slot->Records == page)
+				{
+					m_Entities.push_back(*previous_slot);
+					continue;
+				}
+			}
+
+			// -- Copy the Slot otherwise --
+			m_Entities.push_back({ id, CreateRef<const Page>(page) });
+			m_Changed = true;
+		}
+
+		// Entities are gathered in the registry order, slots are kept by ID to find them from the next snapshot
+		std::sort(m_Entities.begin(), m_Entities.end(), [](const EntitySlot& a, const EntitySlot& b) { return a.ID < b.ID; });
+	}
+
+
+
+	// ----------------------- Public Snapshot Methods ----------------------------------------------------
+	void SceneSnapshot::GetData(SceneData& data) const
+	{
+		KS_PROFILE_FUNCTION();
+		data.ClearEntities();
+
+		data.Entities.reserve(m_Entities.size());
+		for (const EntitySlot& slot : m_Entities)
+		{
+			LoadEntity(*slot.Records, (uint)data.Entities.size(), data);
+			data.Entities.push_back(slot.ID);
+		}
+	}
+
+
+
+	// ----------------------- Getters --------------------------------------------------------------------
+	size_t SceneSnapshot::GetMemory() const
+	{
+		size_t memory = 0;
+		for (const EntitySlot& slot : m_Entities)
+			memory += slot.Records->size();
+
+		return memory;
+	}
+
+
+
+	// ----------------------- Private Snapshot Methods ---------------------------------------------------
+	void SceneSnapshot::StoreEntity(const SceneData& data, uint entity_index, std::array<size_t, 7>& cursors, Page& page)
+	{
+		// -- Components Records --
+		uint mask = 0;
+		page.assign(sizeof(uint), 0);
+
+		size_t first_tag = cursors[0];
+		mask |= StoreRecord(data.Tags, entity_index, cursors[0], TAG, page);
+		mask |= StoreRecord(data.Transforms, entity_index, cursors[1], TRANSFORM, page);
+		mask |= StoreRecord(data.Cameras, entity_index, cursors[2], CAMERA, page);
+		mask |= StoreRecord(data.DirectionalLights, entity_index, cursors[3], DIRECTIONAL_LIGHT, page);
+		mask |= StoreRecord(data.PointLights, entity_index, cursors[4], POINT_LIGHT, page);
+		mask |= StoreRecord(data.Sprites, entity_index, cursors[5], SPRITE, page);
+		mask |= StoreRecord(data.Meshes, entity_index, cursors[6], MESH, page);
+		std::memcpy(page.data(), &mask, sizeof(uint));
+
+		// -- Tag Name (its offset in the data strings is stored as 0 too) --
+		if (mask & TAG)
+		{
+			const TagRecord& tag = data.Tags[first_tag];
+			size_t tag_offset = sizeof(uint) + offsetof(TagRecord, NameOffset);
+			std::memset(page.data() + tag_offset, 0, sizeof(uint));
+			page.insert(page.end(), data.Strings.begin() + tag.NameOffset, data.Strings.begin() + tag.NameOffset + tag.NameLength);
+		}
+	}
+
+
+	void SceneSnapshot::LoadEntity(const Page& page, uint entity_index, SceneData& data)
+	{
+		uint mask = 0;
+		std::memcpy(&mask, page.data(), sizeof(uint));
+		const uint8_t* bytes = page.data() + sizeof(uint);
+
+		// -- Components Records --
+		LoadRecord(bytes, mask, TAG, entity_index, data.Tags);
+		LoadRecord(bytes, mask, TRANSFORM, entity_index, data.Transforms);
+		LoadRecord(bytes, mask, CAMERA, entity_index, data.Cameras);
+		LoadRecord(bytes, mask, DIRECTIONAL_LIGHT, entity_index, data.DirectionalLights);
+		LoadRecord(bytes, mask, POINT_LIGHT, entity_index, data.PointLights);
+		LoadRecord(bytes, mask, SPRITE, entity_index, data.Sprites);
+		LoadRecord(bytes, mask, MESH, entity_index, data.Meshes);
+
+		// -- Tag Name (what's left of the slot) --
+		if (mask & TAG)
+		{
+			TagRecord& tag = data.Tags.back();
+			tag.NameOffset = (uint)data.Strings.size();
+			data.Strings.append(reinterpret_cast<const char*>(bytes), tag.NameLength);
+		}
+	}
+}
@@ -0,0 +1,59 @@
+#ifndef _SCENE_SNAPSHOT_H_
+#define _SCENE_SNAPSHOT_H_
+
+namespace Kaimos {
+
+	struct SceneData;
+	struct Vertex;
+
+	// ---- SCENE SNAPSHOT -----------------------------------------
+	// In-memory copy of the scene entities & components (not of its settings), to restore them later (undo/redo, play/stop)
+	// The records of each entity are stored in their own slot, keyed by the entity ID, and the slots equal to the ones of the same
+	// entity in the previous snapshot are shared with it instead of copied (copy-on-write), so a snapshot only allocates the slots
+	// of the entities that changed since the previous one, no matter where the (random) IDs of the created/deleted ones fall
+	class SceneSnapshot
+	{
+		friend class SceneHistory;
+	public:
+
+		// --- Public Class Methods ---
+		SceneSnapshot(const SceneData& data, const SceneSnapshot* previous = nullptr);
+
+		// --- Public Snapshot Methods ---
+		// Rebuilds the entities & records of the snapshot into the data
+		void GetData(SceneData& data) const;
+
+		// Keeps the evaluated vertices of the snapshot meshes alive (so cached), so restoring it doesn't evaluate them again
+		void KeepVertices(std::vector<Ref<std::vector<Vertex>>>&& vertices) { m_MeshesVertices = std::move(vertices); }
+
+		// --- Getters ---
+		// False if all its slots are the previous snapshot ones (the scene didn't change since then)
+		inline bool HasChanges()			const { return m_Changed; }
+		inline uint GetEntitiesCount()		const { return (uint)m_Entities.size(); }
+
+		size_t GetMemory() const;		// Bytes of all its slots, as if they weren't shared
+
+	private:
+
+		using Page = std::vector<uint8_t>;
+		struct EntitySlot
+		{
+			uint ID = 0;
+			Ref<const Page> Records = nullptr;	// Components mask, then each component record (and the tag name)
+		};
+
+		// --- Private Snapshot Methods ---
+		// Serializes the records of the entity at entity_index of the data into the page (cursors walk each records array)
+		static void StoreEntity(const SceneData& data, uint entity_index, std::array<size_t, 7>& cursors, Page& page);
+		static void LoadEntity(const Page& page, uint entity_index, SceneData& data);
+
+	private:
+
+		std::vector<EntitySlot> m_Entities;		// Sorted by ID
+		std::vector<Ref<std::vector<Vertex>>> m_MeshesVertices;
+
+		bool m_Changed = false;
+	};
+}
+
+#endif //_SCENE_SNAPSHOT_H_